@@ -0,0 +1,272 @@
+#include "BitmapCacheWP.h"
+#include "vstgui/lib/cstream.h"
+#include "vstgui/uidescription/xmlparser.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+#if defined _WINDOWS || defined _WINDLL
+#include <objbase.h>
+#endif
+
+namespace VSTGUI {
+
+std::mutex CBitmapCacheWP::m_ClientMutex;
+CBitmapCacheWP* CBitmapCacheWP::m_pCache = NULL;
+unsigned int CBitmapCacheWP::m_uClients = 0;
+
+// --- <bitmap name= path= nineparttiled-offsets=> declarations, and the value of
+//     every other element's "...bitmap" attributes (bitmap, handle-bitmap,
+//     off-bitmap, background-bitmap...) in the order they appear
+class CBitmapCacheWP::CReferenceCollector : public Xml::IParserHandler
+{
+public:
+	CReferenceCollector(bitmapMap& declared, std::vector<std::string>& referenced)
+	: m_Declared(declared)
+	, m_Referenced(referenced)
+	{
+	}
+
+	void startXmlElement(Xml::Parser* parser, IdStringPtr elementName, UTF8StringPtr* elementAttributes)
+	{
+		if(strcmp(elementName, "bitmap") == 0)
+		{
+			bitmapEntry entry = {"", "", true, BITMAP_QUEUED, NULL};
+			std::string name;
+			for(int i = 0; elementAttributes[i] && elementAttributes[i + 1]; i += 2)
+			{
+				if(strcmp(elementAttributes[i], "name") == 0)
+					name = elementAttributes[i + 1];
+				else if(strcmp(elementAttributes[i], "path") == 0)
+					entry.path = elementAttributes[i + 1];
+				else if(strcmp(elementAttributes[i], "nineparttiled-offsets") == 0)
+					entry.nineParts = elementAttributes[i + 1];
+			}
+
+			if(!name.empty() && !entry.path.empty())
+				m_Declared[name] = entry;
+			return;
+		}
+
+		for(int i = 0; elementAttributes[i] && elementAttributes[i + 1]; i += 2)
+		{
+			size_t uLength = strlen(elementAttributes[i]);
+			if(uLength < 6 || strcmp(elementAttributes[i] + uLength - 6, "bitmap") != 0)
+				continue;
+
+			std::string name(elementAttributes[i + 1]);
+			if(!name.empty() && std::find(m_Referenced.begin(), m_Referenced.end(), name) == m_Referenced.end())
+				m_Referenced.push_back(name);
+		}
+	}
+
+	void endXmlElement(Xml::Parser* parser, IdStringPtr name) {}
+	void xmlCharData(Xml::Parser* parser, const int8_t* data, int32_t length) {}
+	void xmlComment(Xml::Parser* parser, IdStringPtr comment) {}
+
+protected:
+	bitmapMap& m_Declared;
+	std::vector<std::string>& m_Referenced;
+};
+
+CBitmapCacheWP::CBitmapCacheWP(void)
+{
+	m_bParsed = false;
+	m_bStop = false;
+}
+
+// --- the last client is gone; the editors and their views have released
+//     their references by now, so this drops the last ones
+CBitmapCacheWP::~CBitmapCacheWP(void)
+{
+	m_bStop = true;
+	if(m_Worker.joinable())
+		m_Worker.join();
+
+	for(bitmapMap::iterator it = m_Bitmaps.begin(); it != m_Bitmaps.end(); it++)
+	{
+		if(it->second.pBitmap)
+			it->second.pBitmap->forget();
+	}
+}
+
+void CBitmapCacheWP::addClient()
+{
+	std::lock_guard<std::mutex> lock(m_ClientMutex);
+	if(m_uClients++ == 0)
+		m_pCache = new CBitmapCacheWP;
+}
+
+void CBitmapCacheWP::removeClient()
+{
+	CBitmapCacheWP* pCache = NULL;
+	{
+		std::lock_guard<std::mutex> lock(m_ClientMutex);
+		if(m_uClients == 0)
+			return;
+
+		if(--m_uClients == 0)
+		{
+			pCache = m_pCache;
+			m_pCache = NULL;
+		}
+	}
+
+	// --- outside the lock: this waits for the worker's current decode
+	delete pCache;
+}
+
+CBitmapCacheWP* CBitmapCacheWP::getCache()
+{
+	std::lock_guard<std::mutex> lock(m_ClientMutex);
+	return m_pCache;
+}
+
+void CBitmapCacheWP::prefetch(UTF8StringPtr xmlFile)
+{
+	CBitmapCacheWP* pCache = getCache();
+	if(!pCache || !xmlFile)
+		return;
+
+	std::lock_guard<std::mutex> lock(pCache->m_Mutex);
+	if(!pCache->m_Worker.joinable())
+		pCache->m_Worker = std::thread(&CBitmapCacheWP::decodeReferenced, pCache, std::string(xmlFile));
+}
+
+CBitmap* CBitmapCacheWP::getBitmap(UTF8StringPtr name, bool bDeclaredOnly)
+{
+	CBitmapCacheWP* pCache = getCache();
+	if(!pCache || !name || !*name)
+		return NULL;
+
+	std::unique_lock<std::mutex> lock(pCache->m_Mutex);
+
+	// --- the names and paths come from the worker's parse; a few ms at most
+	while(pCache->m_Worker.joinable() && !pCache->m_bParsed)
+		pCache->m_Changed.wait(lock);
+
+	if(bDeclaredOnly)
+	{
+		bitmapMap::iterator it = pCache->m_Bitmaps.find(name);
+		if(it == pCache->m_Bitmaps.end() || !it->second.bDeclared)
+			return NULL;
+	}
+
+	return pCache->acquire(lock, name);
+}
+
+UTF8StringPtr CBitmapCacheWP::lookupBitmapName(const CBitmap* bitmap)
+{
+	CBitmapCacheWP* pCache = getCache();
+	if(!pCache || !bitmap)
+		return NULL;
+
+	std::lock_guard<std::mutex> lock(pCache->m_Mutex);
+	for(bitmapMap::iterator it = pCache->m_Bitmaps.begin(); it != pCache->m_Bitmaps.end(); it++)
+	{
+		if(it->second.pBitmap == bitmap)
+			return it->first.c_str();
+	}
+
+	return NULL;
+}
+
+// --- the entry stays where it is in the map while the lock is dropped; whoever
+//     set BITMAP_DECODING is the only one to write it until BITMAP_READY
+CBitmap* CBitmapCacheWP::acquire(std::unique_lock<std::mutex>& lock, const std::string& name)
+{
+	bitmapMap::iterator it = m_Bitmaps.find(name);
+	if(it == m_Bitmaps.end())
+	{
+		bitmapEntry entry = {name + ".png", "", false, BITMAP_QUEUED, NULL};
+		it = m_Bitmaps.insert(bitmapMap::value_type(name, entry)).first;
+	}
+
+	bitmapEntry& entry = it->second;
+	while(entry.nState == BITMAP_DECODING)
+		m_Changed.wait(lock);
+
+	if(entry.nState == BITMAP_QUEUED)
+	{
+		entry.nState = BITMAP_DECODING;
+		bitmapEntry job = entry;
+
+		lock.unlock();
+		CBitmap* pBitmap = decode(job);
+		lock.lock();
+
+		entry.pBitmap = pBitmap;
+		entry.nState = BITMAP_READY;
+		m_Changed.notify_all();
+	}
+
+	return entry.pBitmap;
+}
+
+CBitmap* CBitmapCacheWP::decode(const bitmapEntry& entry)
+{
+	CResourceDescription resource(entry.path.c_str());
+
+	// --- as UIDescription does it: a nine part bitmap if it has offsets
+	double left, top, right, bottom;
+	if(!entry.nineParts.empty() && sscanf(entry.nineParts.c_str(), "%lf, %lf, %lf, %lf", &left, &top, &right, &bottom) == 4)
+		return new CNinePartTiledBitmap(resource, CNinePartTiledDescription(left, top, right, bottom));
+
+	return new CBitmap(resource);
+}
+
+// --- worker: parse, then decode what the views reference, skipping anything
+//     the GUI thread has already decoded or is decoding
+void CBitmapCacheWP::decodeReferenced(std::string xmlFile)
+{
+#if defined _WINDOWS || defined _WINDLL
+	// --- the WIC/GDI+ decoders are COM objects
+	CoInitializeEx(NULL, COINIT_MULTITHREADED);
+#endif
+
+	bitmapMap declared;
+	std::vector<std::string> referenced;
+	parseUIDescription(xmlFile, declared, referenced);
+
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	for(bitmapMap::iterator it = declared.begin(); it != declared.end(); it++)
+		m_Bitmaps.insert(*it);
+	m_bParsed = true;
+	m_Changed.notify_all();
+
+	for(size_t i = 0; i < referenced.size() && !m_bStop; i++)
+		acquire(lock, referenced[i]);
+
+	lock.unlock();
+
+#if defined _WINDOWS || defined _WINDLL
+	CoUninitialize();
+#endif
+}
+
+bool CBitmapCacheWP::parseUIDescription(const std::string& xmlFile, bitmapMap& declared, std::vector<std::string>& referenced)
+{
+	CResourceInputStream resourceStream;
+	if(!resourceStream.open(CResourceDescription(xmlFile.c_str())))
+		return false;
+
+	Xml::InputStreamContentProvider contentProvider(resourceStream);
+	CReferenceCollector collector(declared, referenced);
+	Xml::Parser parser;
+	return parser.parse(&contentProvider, &collector);
+}
+
+// --- CSharedBitmapUIDescriptionWP
+CBitmap* CSharedBitmapUIDescriptionWP::getBitmap(UTF8StringPtr name) const
+{
+	CBitmap* pBitmap = CBitmapCacheWP::getBitmap(name, true);
+	return pBitmap ? pBitmap : UIDescription::getBitmap(name);
+}
+
+UTF8StringPtr CSharedBitmapUIDescriptionWP::lookupBitmapName(const CBitmap* bitmap) const
+{
+	UTF8StringPtr name = CBitmapCacheWP::lookupBitmapName(bitmap);
+	return name ? name : UIDescription::lookupBitmapName(bitmap);
+}
+
+}
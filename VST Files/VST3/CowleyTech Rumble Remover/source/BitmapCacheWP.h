@@ -0,0 +1,103 @@
+#pragma once
+#include "vstgui/lib/cbitmap.h"
+#include "vstgui/uidescription/uidescription.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+
+namespace VSTGUI {
+
+// --- process-wide cache of the editor's bitmaps
+//
+//     The bundle ships every RackAFX bitmap but a uidesc only uses a few. The
+//     first editor to open starts a worker that parses the uidesc, collects the
+//     bitmaps its views reference (any attribute named "...bitmap") and decodes
+//     just those, while the frame is being built. Every instance in the process
+//     then gets the same CBitmap objects: opening the 20th editor decodes
+//     nothing and holds no copy of its own.
+//
+//     The cache lives from the first addClient() (Processor::initialize()) to
+//     the last removeClient() (Processor::terminate()), so closing and opening
+//     editors never decodes twice. Everything but the decoding runs on the GUI
+//     thread; the worker hands bitmaps over under the lock and never touches
+//     their reference counts afterwards.
+class CBitmapCacheWP
+{
+public:
+	// --- one per plugin instance
+	static void addClient();
+	static void removeClient();
+
+	// --- editor open; the first call starts the worker, later ones return at once
+	static void prefetch(UTF8StringPtr xmlFile);
+
+	// --- GUI thread; the shared bitmap for a name in the uidesc (its <bitmap> path,
+	//     else name.png), decoded here and now if the worker has not got to it.
+	//     The cache keeps its reference: remember() it to hold on to it (views do).
+	//     A missing resource gives an empty bitmap, as new CBitmap() would;
+	//     bDeclaredOnly returns NULL for names with no <bitmap> entry instead
+	static CBitmap* getBitmap(UTF8StringPtr name, bool bDeclaredOnly = false);
+
+	// --- reverse of getBitmap(); NULL if the bitmap is not one of ours
+	static UTF8StringPtr lookupBitmapName(const CBitmap* bitmap);
+
+protected:
+	enum {BITMAP_QUEUED, BITMAP_DECODING, BITMAP_READY};
+
+	typedef struct
+	{
+		std::string path;
+		std::string nineParts;		// nineparttiled-offsets, "" if a plain bitmap
+		bool bDeclared;				// has a <bitmap> entry
+		int nState;
+		CBitmap* pBitmap;
+	} bitmapEntry;
+
+	typedef std::map<std::string, bitmapEntry> bitmapMap;
+
+	CBitmapCacheWP(void);
+	~CBitmapCacheWP(void);
+
+	static CBitmapCacheWP* getCache();
+
+	// --- Xml::IParserHandler for parseUIDescription()
+	class CReferenceCollector;
+
+	// --- worker
+	void decodeReferenced(std::string xmlFile);
+	bool parseUIDescription(const std::string& xmlFile, bitmapMap& declared, std::vector<std::string>& referenced);
+
+	// --- either thread, lock not held
+	static CBitmap* decode(const bitmapEntry& entry);
+
+	// --- lock held; decodes outside it if nobody else is
+	CBitmap* acquire(std::unique_lock<std::mutex>& lock, const std::string& name);
+
+	std::mutex m_Mutex;
+	std::condition_variable m_Changed;
+	bitmapMap m_Bitmaps;
+	bool m_bParsed;
+	std::thread m_Worker;
+	std::atomic<bool> m_bStop;
+
+	static std::mutex m_ClientMutex;
+	static CBitmapCacheWP* m_pCache;
+	static unsigned int m_uClients;
+};
+
+// --- the editor's description: bitmaps come from the shared cache instead of
+//     being decoded again for each editor
+class CSharedBitmapUIDescriptionWP : public UIDescription
+{
+public:
+	CSharedBitmapUIDescriptionWP(const CResourceDescription& xmlFile) : UIDescription(xmlFile) {}
+
+	CBitmap* getBitmap(UTF8StringPtr name) const VSTGUI_OVERRIDE_VMETHOD;
+	UTF8StringPtr lookupBitmapName(const CBitmap* bitmap) const VSTGUI_OVERRIDE_VMETHOD;
+};
+
+}
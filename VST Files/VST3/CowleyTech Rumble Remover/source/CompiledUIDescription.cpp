@@ -0,0 +1,388 @@
+#include "CompiledUIDescription.h"
+#include <string.h>
+#include <stdlib.h>
+
+// CCompiledUIDescription Implementation ----------------------------------------------
+//
+CCompiledUIDescription::CCompiledUIDescription(void)
+{
+	unload();
+}
+
+void CCompiledUIDescription::unload()
+{
+	m_pHeader = NULL;
+	m_pStringOffsets = NULL;
+	m_pNodes = NULL;
+	m_pAttributes = NULL;
+	m_pTags = NULL;
+	m_pStrings = NULL;
+}
+
+uint32_t CCompiledUIDescription::hashSource(const void* pXML, UINT uSize)
+{
+	const unsigned char* p = (const unsigned char*)pXML;
+	uint32_t uHash = 2166136261u;
+	for(UINT i = 0; i < uSize; i++)
+	{
+		if(p[i] == '\r')
+			continue;
+		uHash ^= p[i];
+		uHash *= 16777619u;
+	}
+	return uHash;
+}
+
+bool CCompiledUIDescription::matchesSource(const void* pXML, UINT uSize) const
+{
+	if(!m_pHeader)
+		return false;
+
+	return m_pHeader->uSourceHash == hashSource(pXML, uSize);
+}
+
+bool CCompiledUIDescription::load(const void* pData, UINT uSize)
+{
+	unload();
+
+	if(!pData || uSize < sizeof(uidescBinaryHeader) || ((uintptr_t)pData & 3) != 0)
+		return false;
+
+	const uidescBinaryHeader* pHeader = (const uidescBinaryHeader*)pData;
+	if(memcmp(pHeader->cMagic, UIDESC_BINARY_MAGIC, 4) != 0 || pHeader->uVersion != UIDESC_BINARY_VERSION)
+		return false;
+
+	// --- the sections, in 64 bits so no count can wrap the sum
+	uint64_t uOffset = sizeof(uidescBinaryHeader);
+	const uint64_t uStringOffsets = uOffset;
+	uOffset += 4*(uint64_t)pHeader->uStringCount;
+	const uint64_t uNodes = uOffset;
+	uOffset += sizeof(uidescBinaryNode)*(uint64_t)pHeader->uNodeCount;
+	const uint64_t uAttributes = uOffset;
+	uOffset += 8*(uint64_t)pHeader->uAttributeCount;
+	const uint64_t uTags = uOffset;
+	uOffset += sizeof(uidescBinaryTag)*(uint64_t)pHeader->uTagCount;
+	const uint64_t uStrings = uOffset;
+	uOffset += pHeader->uStringBytes;
+
+	if(uOffset != uSize || pHeader->uNodeCount == 0)
+		return false;
+
+	const char* pBase = (const char*)pData;
+	const uint32_t* pStringOffsets = (const uint32_t*)(pBase + uStringOffsets);
+	const uidescBinaryNode* pNodes = (const uidescBinaryNode*)(pBase + uNodes);
+	const uint32_t* pAttributes = (const uint32_t*)(pBase + uAttributes);
+	const uidescBinaryTag* pTags = (const uidescBinaryTag*)(pBase + uTags);
+	const char* pStrings = pBase + uStrings;
+
+	// --- every string starts inside the bytes and is terminated before their end
+	if(pHeader->uStringBytes == 0 || pStrings[pHeader->uStringBytes - 1] != 0)
+		return false;
+	for(UINT i = 0; i < pHeader->uStringCount; i++)
+	{
+		if(pStringOffsets[i] >= pHeader->uStringBytes)
+			return false;
+	}
+
+	// --- a tree in document order with one root spanning it all
+	if(pNodes[0].uParent != UIDESC_NO_STRING || pNodes[0].uEnd != pHeader->uNodeCount)
+		return false;
+
+	UINT uAttributeTotal = 0;
+	UINT uDepth = 0;
+	for(UINT i = 0; i < pHeader->uNodeCount; i++)
+	{
+		const uidescBinaryNode& node = pNodes[i];
+		if(node.uName >= pHeader->uStringCount)
+			return false;
+		if(node.uText != UIDESC_NO_STRING && node.uText >= pHeader->uStringCount)
+			return false;
+		if(node.uEnd <= i || node.uEnd > pHeader->uNodeCount)
+			return false;
+		if(node.uAttributeCount > pHeader->uMaxAttributes || node.uFirstAttribute != uAttributeTotal)
+			return false;
+		uAttributeTotal += node.uAttributeCount;
+		if(uAttributeTotal > pHeader->uAttributeCount)
+			return false;
+
+		if(i > 0)
+		{
+			// --- the parent is open: it started earlier and its subtree covers this one
+			if(node.uParent >= i || pNodes[node.uParent].uEnd < node.uEnd)
+				return false;
+
+			uDepth = 1;
+			for(uint32_t uParent = node.uParent; pNodes[uParent].uParent != UIDESC_NO_STRING; uParent = pNodes[uParent].uParent)
+				uDepth++;
+			if(uDepth > pHeader->uMaxDepth)
+				return false;
+		}
+	}
+	if(uAttributeTotal != pHeader->uAttributeCount)
+		return false;
+
+	// --- siblings must tile their parent: the next node after a subtree is either
+	//     its sibling or belongs further up
+	for(UINT i = 1; i < pHeader->uNodeCount; i++)
+	{
+		uint32_t uPrevious = i - 1;
+		if(pNodes[i].uParent != uPrevious)
+		{
+			// --- climb from the previous node to the one whose child this is
+			while(uPrevious != UIDESC_NO_STRING && uPrevious != pNodes[i].uParent)
+			{
+				if(pNodes[uPrevious].uEnd != i)
+					return false;
+				uPrevious = pNodes[uPrevious].uParent;
+			}
+			if(uPrevious == UIDESC_NO_STRING)
+				return false;
+		}
+	}
+	for(uint32_t uOpen = pHeader->uNodeCount - 1; uOpen != UIDESC_NO_STRING; uOpen = pNodes[uOpen].uParent)
+	{
+		if(pNodes[uOpen].uEnd != pHeader->uNodeCount)
+			return false;
+	}
+
+	for(UINT i = 0; i < 2*pHeader->uAttributeCount; i++)
+	{
+		if(pAttributes[i] >= pHeader->uStringCount)
+			return false;
+	}
+
+	for(UINT i = 0; i < pHeader->uTagCount; i++)
+	{
+		if(pTags[i].uName >= pHeader->uStringCount)
+			return false;
+		if(i > 0 && strcmp(pStrings + pStringOffsets[pTags[i - 1].uName], pStrings + pStringOffsets[pTags[i].uName]) >= 0)
+			return false;
+	}
+
+	m_pHeader = pHeader;
+	m_pStringOffsets = pStringOffsets;
+	m_pNodes = pNodes;
+	m_pAttributes = pAttributes;
+	m_pTags = pTags;
+	m_pStrings = pStrings;
+	return true;
+}
+
+void CCompiledUIDescription::replay(IUIDescriptionHandler* pHandler) const
+{
+	if(!m_pHeader || !pHandler)
+		return;
+
+	std::vector<const char*> attributes(2*m_pHeader->uMaxAttributes + 1);
+	std::vector<uint32_t> open;
+	open.reserve(m_pHeader->uMaxDepth + 1);
+
+	for(UINT i = 0; i < m_pHeader->uNodeCount; i++)
+	{
+		// --- close everything this node is not inside of
+		while(!open.empty() && m_pNodes[open.back()].uEnd <= i)
+		{
+			pHandler->endElement(getString(m_pNodes[open.back()].uName));
+			open.pop_back();
+		}
+
+		const uidescBinaryNode& node = m_pNodes[i];
+		const uint32_t* pPair = &m_pAttributes[2*node.uFirstAttribute];
+		for(UINT a = 0; a < 2*node.uAttributeCount; a++)
+			attributes[a] = m_pStrings + m_pStringOffsets[pPair[a]];
+		attributes[2*node.uAttributeCount] = NULL;
+
+		pHandler->startElement(getString(node.uName), &attributes[0]);
+		if(node.uText != UIDESC_NO_STRING)
+		{
+			const char* pText = getString(node.uText);
+			pHandler->characters(pText, (UINT)strlen(pText));
+		}
+		open.push_back(i);
+	}
+
+	while(!open.empty())
+	{
+		pHandler->endElement(getString(m_pNodes[open.back()].uName));
+		open.pop_back();
+	}
+}
+
+bool CCompiledUIDescription::findTag(const char* pName, int& nTag) const
+{
+	if(!m_pHeader || !pName)
+		return false;
+
+	UINT uLow = 0;
+	UINT uHigh = m_pHeader->uTagCount;
+	while(uLow < uHigh)
+	{
+		UINT uMid = (uLow + uHigh)/2;
+		int nCompare = strcmp(pName, getString(m_pTags[uMid].uName));
+		if(nCompare == 0)
+		{
+			nTag = m_pTags[uMid].nTag;
+			return true;
+		}
+
+		if(nCompare < 0)
+			uHigh = uMid;
+		else
+			uLow = uMid + 1;
+	}
+
+	return false;
+}
+
+// CUIDescriptionCompiler Implementation ----------------------------------------------
+//
+CUIDescriptionCompiler::CUIDescriptionCompiler(void)
+{
+	m_uMaxAttributes = 0;
+	m_uMaxDepth = 0;
+}
+
+uint32_t CUIDescriptionCompiler::intern(const std::string& str)
+{
+	std::map<std::string, uint32_t>::iterator it = m_StringIDs.find(str);
+	if(it != m_StringIDs.end())
+		return it->second;
+
+	uint32_t uID = (uint32_t)m_Strings.size();
+	m_Strings.push_back(str);
+	m_StringIDs[str] = uID;
+	return uID;
+}
+
+void CUIDescriptionCompiler::startElement(const char* pName, const char** ppAttributes)
+{
+	uidescBinaryNode node;
+	node.uName = intern(pName);
+	node.uParent = m_Open.empty() ? UIDESC_NO_STRING : m_Open.back();
+	node.uEnd = 0;
+	node.uFirstAttribute = (uint32_t)m_Attributes.size()/2;
+	node.uAttributeCount = 0;
+	node.uText = UIDESC_NO_STRING;
+
+	const char* pTagName = NULL;
+	const char* pTagValue = NULL;
+	for(UINT i = 0; ppAttributes && ppAttributes[i] && ppAttributes[i + 1]; i += 2)
+	{
+		m_Attributes.push_back(intern(ppAttributes[i]));
+		m_Attributes.push_back(intern(ppAttributes[i + 1]));
+		node.uAttributeCount++;
+
+		if(strcmp(ppAttributes[i], "name") == 0)
+			pTagName = ppAttributes[i + 1];
+		else if(strcmp(ppAttributes[i], "tag") == 0)
+			pTagValue = ppAttributes[i + 1];
+	}
+
+	// --- only plain numbers are resolved here; anything else (four char codes...)
+	//     is left to the description. The first of a name wins, as in VSTGUI
+	if(strcmp(pName, "control-tag") == 0 && pTagName && pTagValue && *pTagValue)
+	{
+		char* pEnd = NULL;
+		long nTag = strtol(pTagValue, &pEnd, 10);
+		if(*pEnd == 0 && m_Tags.find(pTagName) == m_Tags.end())
+			m_Tags[pTagName] = (int32_t)nTag;
+	}
+
+	if(node.uAttributeCount > m_uMaxAttributes)
+		m_uMaxAttributes = node.uAttributeCount;
+	if(m_Open.size() > m_uMaxDepth)
+		m_uMaxDepth = (uint32_t)m_Open.size();
+
+	m_Open.push_back((uint32_t)m_Nodes.size());
+	m_Nodes.push_back(node);
+	m_Text.push_back(std::string());
+}
+
+void CUIDescriptionCompiler::characters(const char* pText, UINT uLength)
+{
+	if(!m_Open.empty())
+		m_Text[m_Open.back()].append(pText, uLength);
+}
+
+void CUIDescriptionCompiler::endElement()
+{
+	if(m_Open.empty())
+		return;
+
+	uint32_t uNode = m_Open.back();
+	m_Open.pop_back();
+	m_Nodes[uNode].uEnd = (uint32_t)m_Nodes.size();
+
+	const std::string& text = m_Text[uNode];
+	size_t uFirst = text.find_first_not_of(" \t\r\n");
+	if(uFirst != std::string::npos)
+	{
+		size_t uLast = text.find_last_not_of(" \t\r\n");
+		m_Nodes[uNode].uText = intern(text.substr(uFirst, uLast - uFirst + 1));
+	}
+}
+
+bool CUIDescriptionCompiler::finish(const void* pXML, UINT uSize, std::vector<unsigned char>& binary)
+{
+	// --- exactly one root, closed
+	if(m_Nodes.empty() || !m_Open.empty() || m_Nodes[0].uEnd != m_Nodes.size())
+		return false;
+
+	// --- tags reference their names, so intern before the string table is final
+	std::vector<uidescBinaryTag> tags;
+	for(std::map<std::string, int32_t>::iterator it = m_Tags.begin(); it != m_Tags.end(); it++)
+	{
+		uidescBinaryTag tag = {intern(it->first), it->second};
+		tags.push_back(tag);
+	}
+
+	std::vector<uint32_t> stringOffsets(m_Strings.size());
+	std::string strings;
+	for(size_t i = 0; i < m_Strings.size(); i++)
+	{
+		stringOffsets[i] = (uint32_t)strings.size();
+		strings.append(m_Strings[i]);
+		strings.push_back(0);
+	}
+
+	// --- pad so a following section would stay 4 byte aligned
+	while(strings.size() & 3)
+		strings.push_back(0);
+
+	uidescBinaryHeader header;
+	memcpy(header.cMagic, UIDESC_BINARY_MAGIC, 4);
+	header.uVersion = UIDESC_BINARY_VERSION;
+	header.uSourceSize = uSize;
+	header.uSourceHash = CCompiledUIDescription::hashSource(pXML, uSize);
+	header.uStringCount = (uint32_t)m_Strings.size();
+	header.uStringBytes = (uint32_t)strings.size();
+	header.uNodeCount = (uint32_t)m_Nodes.size();
+	header.uAttributeCount = (uint32_t)m_Attributes.size()/2;
+	header.uTagCount = (uint32_t)tags.size();
+	header.uMaxAttributes = m_uMaxAttributes;
+	header.uMaxDepth = m_uMaxDepth;
+
+	binary.clear();
+	const unsigned char* p = (const unsigned char*)&header;
+	binary.insert(binary.end(), p, p + sizeof(header));
+	if(!stringOffsets.empty())
+	{
+		p = (const unsigned char*)&stringOffsets[0];
+		binary.insert(binary.end(), p, p + 4*stringOffsets.size());
+	}
+	p = (const unsigned char*)&m_Nodes[0];
+	binary.insert(binary.end(), p, p + sizeof(uidescBinaryNode)*m_Nodes.size());
+	if(!m_Attributes.empty())
+	{
+		p = (const unsigned char*)&m_Attributes[0];
+		binary.insert(binary.end(), p, p + 4*m_Attributes.size());
+	}
+	if(!tags.empty())
+	{
+		p = (const unsigned char*)&tags[0];
+		binary.insert(binary.end(), p, p + sizeof(uidescBinaryTag)*tags.size());
+	}
+	binary.insert(binary.end(), strings.begin(), strings.end());
+
+	return true;
+}
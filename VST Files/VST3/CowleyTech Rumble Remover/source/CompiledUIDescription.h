@@ -0,0 +1,140 @@
+#pragma once
+
+#include "pluginconstants.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <map>
+
+// --- precompiled .uidesc
+//
+//     tools/UidescCompiler turns RackAFX.uidesc into RackAFX.uidescbin, which
+//     ships next to it. The binary is the XML document as a flat node array in
+//     document order (each node knows its parent and where its subtree ends),
+//     every element/attribute name and value interned once in a string table,
+//     and the <control-tag> name -> tag pairs resolved to numbers and sorted.
+//     Loading is one validation pass over the data, after which the editor's
+//     description replays the nodes into its XML handler without any XML
+//     tokenizing, and looks tags up by binary search.
+//
+//     The binary records the size and hash of the XML it came from; a description
+//     whose XML no longer matches (edited in the WYSIWYG editor, compiler not
+//     re-run) is parsed from the XML as before.
+//
+//     Layout, all 32 bit little endian:
+//         uidescBinaryHeader
+//         uint32_t           string offsets into the string bytes [uStringCount]
+//         uidescBinaryNode   [uNodeCount]
+//         uint32_t           attribute name, value string pairs [2*uAttributeCount]
+//         uidescBinaryTag    sorted by name [uTagCount]
+//         char               NUL terminated strings [uStringBytes]
+const uint32_t UIDESC_BINARY_VERSION = 1;
+const uint32_t UIDESC_NO_STRING = 0xFFFFFFFF;
+const char UIDESC_BINARY_MAGIC[4] = {'R', 'U', 'I', 'B'};
+
+typedef struct
+{
+	char cMagic[4];
+	uint32_t uVersion;
+	uint32_t uSourceSize;		// the XML this was compiled from, for information
+	uint32_t uSourceHash;		// hashSource() of it
+	uint32_t uStringCount;
+	uint32_t uStringBytes;
+	uint32_t uNodeCount;
+	uint32_t uAttributeCount;
+	uint32_t uTagCount;
+	uint32_t uMaxAttributes;	// most on one node
+	uint32_t uMaxDepth;
+} uidescBinaryHeader;
+
+typedef struct
+{
+	uint32_t uName;				// element name
+	uint32_t uParent;			// node index; UIDESC_NO_STRING for the root
+	uint32_t uEnd;				// one past the last node of this subtree
+	uint32_t uFirstAttribute;
+	uint32_t uAttributeCount;
+	uint32_t uText;				// character data, trimmed; UIDESC_NO_STRING if none
+} uidescBinaryNode;
+
+typedef struct
+{
+	uint32_t uName;
+	int32_t nTag;
+} uidescBinaryTag;
+
+// --- receives a replayed document; attributes are name, value, ..., NULL as
+//     VSTGUI's Xml::IParserHandler gets them
+class IUIDescriptionHandler
+{
+public:
+	virtual ~IUIDescriptionHandler(void) {}
+	virtual void startElement(const char* pName, const char** ppAttributes) = 0;
+	virtual void characters(const char* pText, UINT uLength) = 0;
+	virtual void endElement(const char* pName) = 0;
+};
+
+class CCompiledUIDescription
+{
+public:
+	CCompiledUIDescription(void);
+
+	// --- checks every offset, index and string once; false (and nothing loaded) if
+	//     anything is out of place. The data is not copied and must stay valid
+	bool load(const void* pData, UINT uSize);
+	void unload();
+	bool isLoaded() const {return m_pHeader != NULL;}
+
+	// --- FNV-1a of the XML, carriage returns skipped so a CRLF checkout of the
+	//     same file still matches
+	static uint32_t hashSource(const void* pXML, UINT uSize);
+
+	// --- true if this was compiled from this XML
+	bool matchesSource(const void* pXML, UINT uSize) const;
+
+	UINT getNodeCount() const {return m_pHeader ? m_pHeader->uNodeCount : 0;}
+	const uidescBinaryNode& getNode(UINT uIndex) const {return m_pNodes[uIndex];}
+	const char* getString(uint32_t uID) const {return uID == UIDESC_NO_STRING ? NULL : m_pStrings + m_pStringOffsets[uID];}
+
+	// --- the whole document, in order
+	void replay(IUIDescriptionHandler* pHandler) const;
+
+	// --- a <control-tag> with a numeric tag; false if there is none by that name
+	bool findTag(const char* pName, int& nTag) const;
+
+protected:
+	const uidescBinaryHeader* m_pHeader;
+	const uint32_t* m_pStringOffsets;
+	const uidescBinaryNode* m_pNodes;
+	const uint32_t* m_pAttributes;
+	const uidescBinaryTag* m_pTags;
+	const char* m_pStrings;
+};
+
+// --- builds the binary from a document's events (the compiler feeds it from
+//     expat; anything that can walk the XML will do)
+class CUIDescriptionCompiler
+{
+public:
+	CUIDescriptionCompiler(void);
+
+	void startElement(const char* pName, const char** ppAttributes);
+	void characters(const char* pText, UINT uLength);
+	void endElement();
+
+	// --- false if the elements did not balance or there was no document
+	bool finish(const void* pXML, UINT uSize, std::vector<unsigned char>& binary);
+
+protected:
+	uint32_t intern(const std::string& str);
+
+	std::map<std::string, uint32_t> m_StringIDs;
+	std::vector<std::string> m_Strings;
+	std::vector<uidescBinaryNode> m_Nodes;
+	std::vector<uint32_t> m_Attributes;
+	std::vector<std::string> m_Text;		// per node, untrimmed
+	std::vector<uint32_t> m_Open;
+	std::map<std::string, int32_t> m_Tags;
+	uint32_t m_uMaxAttributes;
+	uint32_t m_uMaxDepth;
+};
@@ -0,0 +1,102 @@
+#include "CompiledUIDescriptionWP.h"
+#include "vstgui/lib/cstream.h"
+#include <string.h>
+
+namespace VSTGUI {
+
+CCompiledUIDescriptionWP::CCompiledUIDescriptionWP(UTF8StringPtr xmlFile)
+: CSharedBitmapUIDescriptionWP(CResourceDescription(xmlFile))
+, m_XMLFile(xmlFile ? xmlFile : "")
+{
+}
+
+bool CCompiledUIDescriptionWP::readResource(const std::string& name, std::vector<unsigned char>& data)
+{
+	CResourceInputStream resourceStream;
+	if(name.empty() || !resourceStream.open(CResourceDescription(name.c_str())))
+		return false;
+
+	unsigned char buffer[8192];
+	for(;;)
+	{
+		uint32_t uRead = resourceStream.readRaw(buffer, sizeof(buffer));
+		if(uRead == 0 || uRead > sizeof(buffer))	// end, or kStreamIOError
+			break;
+		data.insert(data.end(), buffer, buffer + uRead);
+	}
+
+	return !data.empty();
+}
+
+// --- the binary, if there is one and it was made from the XML in this build
+bool CCompiledUIDescriptionWP::loadCompiled()
+{
+	std::vector<unsigned char> binary;
+	if(!readResource(m_XMLFile + "bin", binary))
+		return false;
+
+	m_Binary.resize((binary.size() + 3)/4);
+	memcpy(&m_Binary[0], &binary[0], binary.size());
+	if(!m_Compiled.load(&m_Binary[0], (UINT)binary.size()))
+		return false;
+
+	// --- UIDescription stops at any other root
+	if(strcmp(m_Compiled.getString(m_Compiled.getNode(0).uName), "vstgui-ui-description") != 0)
+	{
+		m_Compiled.unload();
+		return false;
+	}
+
+	std::vector<unsigned char> xml;
+	if(!readResource(m_XMLFile, xml) || !m_Compiled.matchesSource(&xml[0], (UINT)xml.size()))
+	{
+		m_Compiled.unload();
+		return false;
+	}
+
+	return true;
+}
+
+bool CCompiledUIDescriptionWP::parse()
+{
+	if(parsed())
+		return true;
+
+	if(loadCompiled())
+	{
+		m_Compiled.replay(this);
+		if(parsed())
+			return true;
+
+		m_Compiled.unload();
+	}
+
+	return UIDescription::parse();
+}
+
+int32_t CCompiledUIDescriptionWP::getTagForName(UTF8StringPtr name) const
+{
+#if !VSTGUI_LIVE_EDITING
+	int nTag;
+	if(m_Compiled.findTag(name, nTag))
+		return nTag;
+#endif
+	return UIDescription::getTagForName(name);
+}
+
+void CCompiledUIDescriptionWP::startElement(const char* pName, const char** ppAttributes)
+{
+	startXmlElement(&m_Parser, pName, ppAttributes);
+}
+
+void CCompiledUIDescriptionWP::characters(const char* pText, UINT uLength)
+{
+	xmlCharData(&m_Parser, (const int8_t*)pText, (int32_t)uLength);
+}
+
+void CCompiledUIDescriptionWP::endElement(const char* pName)
+{
+	endXmlElement(&m_Parser, pName);
+}
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "BitmapCacheWP.h"
+#include "CompiledUIDescription.h"
+#include "vstgui/uidescription/xmlparser.h"
+#include <string>
+#include <vector>
+
+namespace VSTGUI {
+
+// --- the editor's description, read from the precompiled <xmlFile>bin resource
+//     (RackAFX.uidescbin, rafx.uidescbin on Windows) when it was compiled from
+//     the XML as it is now: the nodes are replayed straight into UIDescription's
+//     XML handler and control tags are looked up in the binary's sorted table.
+//     Without a binary, or with a stale one, parse() reads the XML as before.
+//
+//     In VSTGUI_LIVE_EDITING builds the WYSIWYG editor can change tags, so they
+//     always come from the description's own nodes there.
+class CCompiledUIDescriptionWP : public CSharedBitmapUIDescriptionWP, protected IUIDescriptionHandler
+{
+public:
+	CCompiledUIDescriptionWP(UTF8StringPtr xmlFile);
+
+	bool parse() VSTGUI_OVERRIDE_VMETHOD;
+	int32_t getTagForName(UTF8StringPtr name) const VSTGUI_OVERRIDE_VMETHOD;
+
+	// --- true if the last parse() came from the binary
+	bool isCompiled() const {return m_Compiled.isLoaded();}
+
+protected:
+	static bool readResource(const std::string& name, std::vector<unsigned char>& data);
+	bool loadCompiled();
+
+	// --- IUIDescriptionHandler: on to UIDescription's Xml::IParserHandler
+	void startElement(const char* pName, const char** ppAttributes);
+	void characters(const char* pText, UINT uLength);
+	void endElement(const char* pName);
+
+	std::string m_XMLFile;
+	std::vector<uint32_t> m_Binary;		// uint32_t so the tables are aligned
+	CCompiledUIDescription m_Compiled;
+	Xml::Parser m_Parser;				// only passed through; nothing is parsed with it
+};
+
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "pluginconstants.h"
+#include <atomic>
+
+// --- typed messages to the controller
+//
+//     Every message is an ID plus a POD payload, dispatched with one switch.
+//     The editor hands its messages straight to the controller (same thread);
+//     the audio thread writes its messages in place into a single producer,
+//     single consumer queue of fixed size slots that the controller drains on
+//     the GUI timer. A bulk update (all of the meters for one block) is one
+//     message, written once and read once, and the audio thread never waits:
+//     when the queue is full it simply has nothing to send this buffer.
+enum controllerMessageID
+{
+	CONTROLLER_MSG_TIMER_PING,		// editor: the GUI timer ticked
+	CONTROLLER_MSG_RECREATE_VIEW,	// editor: the view was rebuilt (uidesc editing)
+	CONTROLLER_MSG_METER_FRAME,		// audio: one block of every meter, see CMeterEngine
+};
+
+const UINT CONTROLLER_QUEUE_SIZE = 64;			// slots, power of 2
+const UINT CONTROLLER_MAX_METERS = 64;			// meters past this are not shown, multiple of 4
+
+// --- payloads
+typedef struct
+{
+	UINT uChannels;		// CMeterEngine::getChannelCount() it was made with
+	float fFrame[(METER_READINGS + 1)*CONTROLLER_MAX_METERS];	// CMeterEngine::endBlock() layout
+} meterFrameMessage;
+
+typedef struct
+{
+	UINT uID;			// controllerMessageID
+	union
+	{
+		meterFrameMessage meterFrame;
+	};
+} controllerMessage;
+
+class IControllerMessageReceiver
+{
+public:
+	virtual ~IControllerMessageReceiver(void) {}
+
+	// --- GUI thread
+	virtual void receiveMessage(const controllerMessage& message) = 0;
+};
+
+// --- one producer, one consumer; the slots are allocated once, so neither
+//     side ever allocates, locks or copies a payload
+class CControllerMessageQueue
+{
+public:
+	CControllerMessageQueue(void)
+	{
+		m_pSlots = new controllerMessage[CONTROLLER_QUEUE_SIZE];
+		m_uWriteIndex.store(0);
+		m_uReadIndex.store(0);
+	}
+	~CControllerMessageQueue(void) {delete [] m_pSlots;}
+
+	// --- producer: the next free slot to fill in, NULL if the queue is full;
+	//     nothing is sent until push()
+	controllerMessage* beginPush(UINT uID)
+	{
+		UINT uWrite = m_uWriteIndex.load(std::memory_order_relaxed);
+		if(uWrite - m_uReadIndex.load(std::memory_order_acquire) >= CONTROLLER_QUEUE_SIZE)
+			return NULL;
+
+		controllerMessage* pMessage = &m_pSlots[uWrite & (CONTROLLER_QUEUE_SIZE - 1)];
+		pMessage->uID = uID;
+		return pMessage;
+	}
+	void push() {m_uWriteIndex.store(m_uWriteIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);}
+
+	// --- consumer: the oldest message, NULL if there is none; valid until pop()
+	const controllerMessage* front()
+	{
+		UINT uRead = m_uReadIndex.load(std::memory_order_relaxed);
+		if(uRead == m_uWriteIndex.load(std::memory_order_acquire))
+			return NULL;
+
+		return &m_pSlots[uRead & (CONTROLLER_QUEUE_SIZE - 1)];
+	}
+	void pop() {m_uReadIndex.store(m_uReadIndex.load(std::memory_order_relaxed) + 1, std::memory_order_release);}
+
+protected:
+	controllerMessage* m_pSlots;
+	std::atomic<UINT> m_uWriteIndex;
+	std::atomic<UINT> m_uReadIndex;
+};
@@ -0,0 +1,811 @@
+#include "FFTConvolver.h"
+#include <condition_variable>
+
+// --- SSE complex multiply-accumulate where the target has it; plain loop otherwise
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAFX_CONVOLVER_SSE 1
+#include <xmmintrin.h>
+#endif
+
+// --- acc += x * h over uCount bins; uCount is a multiple of 4
+static inline void complexMultiplyAccumulate(float* pAccRe, float* pAccIm,
+											 const float* pXRe, const float* pXIm,
+											 const float* pHRe, const float* pHIm, UINT uCount)
+{
+#if RAFX_CONVOLVER_SSE
+	for(UINT i = 0; i < uCount; i += 4)
+	{
+		__m128 xr = _mm_loadu_ps(pXRe + i);
+		__m128 xi = _mm_loadu_ps(pXIm + i);
+		__m128 hr = _mm_loadu_ps(pHRe + i);
+		__m128 hi = _mm_loadu_ps(pHIm + i);
+
+		__m128 re = _mm_sub_ps(_mm_mul_ps(xr, hr), _mm_mul_ps(xi, hi));
+		__m128 im = _mm_add_ps(_mm_mul_ps(xr, hi), _mm_mul_ps(xi, hr));
+
+		_mm_storeu_ps(pAccRe + i, _mm_add_ps(_mm_loadu_ps(pAccRe + i), re));
+		_mm_storeu_ps(pAccIm + i, _mm_add_ps(_mm_loadu_ps(pAccIm + i), im));
+	}
+#else
+	for(UINT i = 0; i < uCount; i++)
+	{
+		pAccRe[i] += pXRe[i]*pHRe[i] - pXIm[i]*pHIm[i];
+		pAccIm[i] += pXRe[i]*pHIm[i] + pXIm[i]*pHRe[i];
+	}
+#endif
+}
+
+static UINT nextPowerOfTwo(UINT u)
+{
+	UINT n = 1;
+	while(n < u)
+		n <<= 1;
+	return n;
+}
+
+// --- CRealFFT ---------------------------------------------------------------------------
+CRealFFT::CRealFFT(void)
+{
+	m_uSize = 0;
+	m_uHalfSize = 0;
+	m_pBitReverse = NULL;
+	m_pCos = NULL;
+	m_pSin = NULL;
+	m_pStageCos = NULL;
+	m_pStageSin = NULL;
+	m_pSplitCos = NULL;
+	m_pSplitSin = NULL;
+	m_pWorkRe = NULL;
+	m_pWorkIm = NULL;
+}
+
+CRealFFT::~CRealFFT(void)
+{
+	destroy();
+}
+
+void CRealFFT::destroy()
+{
+	delete [] m_pBitReverse;
+	delete [] m_pCos;
+	delete [] m_pSin;
+	delete [] m_pStageCos;
+	delete [] m_pStageSin;
+	delete [] m_pSplitCos;
+	delete [] m_pSplitSin;
+	delete [] m_pWorkRe;
+	delete [] m_pWorkIm;
+
+	m_pBitReverse = NULL;
+	m_pCos = NULL;
+	m_pSin = NULL;
+	m_pStageCos = NULL;
+	m_pStageSin = NULL;
+	m_pSplitCos = NULL;
+	m_pSplitSin = NULL;
+	m_pWorkRe = NULL;
+	m_pWorkIm = NULL;
+	m_uSize = 0;
+	m_uHalfSize = 0;
+}
+
+void CRealFFT::init(UINT uSize)
+{
+	if(uSize == m_uSize)
+		return;
+
+	destroy();
+
+	m_uSize = uSize;
+	m_uHalfSize = uSize/2;
+
+	m_pBitReverse = new UINT[m_uHalfSize];
+	m_pCos = new float[m_uHalfSize/2];
+	m_pSin = new float[m_uHalfSize/2];
+	m_pStageCos = new float[m_uHalfSize];
+	m_pStageSin = new float[m_uHalfSize];
+	m_pSplitCos = new float[m_uHalfSize + 1];
+	m_pSplitSin = new float[m_uHalfSize + 1];
+	m_pWorkRe = new float[m_uHalfSize];
+	m_pWorkIm = new float[m_uHalfSize];
+
+	// --- bit reversal for the N/2 complex FFT
+	UINT uBits = 0;
+	while((1u << uBits) < m_uHalfSize)
+		uBits++;
+
+	for(UINT i = 0; i < m_uHalfSize; i++)
+	{
+		UINT r = 0;
+		for(UINT b = 0; b < uBits; b++)
+			r |= ((i >> b) & 1) << (uBits - 1 - b);
+		m_pBitReverse[i] = r;
+	}
+
+	for(UINT k = 0; k < m_uHalfSize/2; k++)
+	{
+		m_pCos[k] = (float)cos(2.0*pi*(double)k/(double)m_uHalfSize);
+		m_pSin[k] = (float)sin(2.0*pi*(double)k/(double)m_uHalfSize);
+	}
+
+	// --- stage with half-length h reads W^(j*M/2h), j < h, from offset h - 1
+	for(UINT uHalf = 1; uHalf < m_uHalfSize; uHalf <<= 1)
+	{
+		UINT uStep = m_uHalfSize/(2*uHalf);
+		for(UINT j = 0; j < uHalf; j++)
+		{
+			m_pStageCos[uHalf - 1 + j] = m_pCos[j*uStep];
+			m_pStageSin[uHalf - 1 + j] = m_pSin[j*uStep];
+		}
+	}
+
+	for(UINT k = 0; k <= m_uHalfSize; k++)
+	{
+		m_pSplitCos[k] = (float)cos(2.0*pi*(double)k/(double)m_uSize);
+		m_pSplitSin[k] = (float)sin(2.0*pi*(double)k/(double)m_uSize);
+	}
+}
+
+void CRealFFT::complexFFT(bool bInverse)
+{
+	UINT M = m_uHalfSize;
+
+	for(UINT i = 0; i < M; i++)
+	{
+		UINT j = m_pBitReverse[i];
+		if(j > i)
+		{
+			float t = m_pWorkRe[i]; m_pWorkRe[i] = m_pWorkRe[j]; m_pWorkRe[j] = t;
+			t = m_pWorkIm[i]; m_pWorkIm[i] = m_pWorkIm[j]; m_pWorkIm[j] = t;
+		}
+	}
+
+	float fSign = bInverse ? 1.0f : -1.0f;
+
+	for(UINT uLen = 2; uLen <= M; uLen <<= 1)
+	{
+		UINT uHalf = uLen/2;
+		const float* pCos = m_pStageCos + uHalf - 1;
+		const float* pSin = m_pStageSin + uHalf - 1;
+
+#if RAFX_CONVOLVER_SSE
+		// --- 4 butterflies at a time once the stage is wide enough; same
+		//     operations in the same order as the scalar loop
+		if(uHalf >= 4)
+		{
+			__m128 vSign = _mm_set1_ps(fSign);
+
+			for(UINT i = 0; i < M; i += uLen)
+			{
+				float* pARe = m_pWorkRe + i;
+				float* pAIm = m_pWorkIm + i;
+				float* pBRe = pARe + uHalf;
+				float* pBIm = pAIm + uHalf;
+
+				for(UINT j = 0; j < uHalf; j += 4)
+				{
+					__m128 wr = _mm_loadu_ps(pCos + j);
+					__m128 wi = _mm_mul_ps(vSign, _mm_loadu_ps(pSin + j));
+					__m128 br = _mm_loadu_ps(pBRe + j);
+					__m128 bi = _mm_loadu_ps(pBIm + j);
+					__m128 ar = _mm_loadu_ps(pARe + j);
+					__m128 ai = _mm_loadu_ps(pAIm + j);
+
+					__m128 tr = _mm_sub_ps(_mm_mul_ps(wr, br), _mm_mul_ps(wi, bi));
+					__m128 ti = _mm_add_ps(_mm_mul_ps(wr, bi), _mm_mul_ps(wi, br));
+
+					_mm_storeu_ps(pBRe + j, _mm_sub_ps(ar, tr));
+					_mm_storeu_ps(pBIm + j, _mm_sub_ps(ai, ti));
+					_mm_storeu_ps(pARe + j, _mm_add_ps(ar, tr));
+					_mm_storeu_ps(pAIm + j, _mm_add_ps(ai, ti));
+				}
+			}
+			continue;
+		}
+#endif
+
+		for(UINT i = 0; i < M; i += uLen)
+		{
+			for(UINT j = 0; j < uHalf; j++)
+			{
+				float wr = pCos[j];
+				float wi = fSign*pSin[j];
+
+				UINT a = i + j;
+				UINT b = a + uHalf;
+
+				float tr = wr*m_pWorkRe[b] - wi*m_pWorkIm[b];
+				float ti = wr*m_pWorkIm[b] + wi*m_pWorkRe[b];
+
+				m_pWorkRe[b] = m_pWorkRe[a] - tr;
+				m_pWorkIm[b] = m_pWorkIm[a] - ti;
+				m_pWorkRe[a] += tr;
+				m_pWorkIm[a] += ti;
+			}
+		}
+	}
+}
+
+void CRealFFT::forward(const float* pInput, float* pRe, float* pIm)
+{
+	UINT M = m_uHalfSize;
+
+	// --- pack even/odd samples as one complex sequence
+	for(UINT n = 0; n < M; n++)
+	{
+		m_pWorkRe[n] = pInput[2*n];
+		m_pWorkIm[n] = pInput[2*n + 1];
+	}
+
+	complexFFT(false);
+
+	// --- split: X[k] = Xe[k] + W^k Xo[k]
+	for(UINT k = 0; k <= M; k++)
+	{
+		UINT k1 = k == M ? 0 : k;
+		UINT k2 = k == 0 ? 0 : M - k;
+
+		float ar = m_pWorkRe[k1], ai = m_pWorkIm[k1];
+		float br = m_pWorkRe[k2], bi = -m_pWorkIm[k2];
+
+		float er = 0.5f*(ar + br);
+		float ei = 0.5f*(ai + bi);
+		float or_ = 0.5f*(ai - bi);
+		float oi = -0.5f*(ar - br);
+
+		float c = m_pSplitCos[k], s = m_pSplitSin[k];
+
+		pRe[k] = er + c*or_ + s*oi;
+		pIm[k] = ei + c*oi - s*or_;
+	}
+}
+
+void CRealFFT::inverse(const float* pRe, const float* pIm, float* pOutput)
+{
+	UINT M = m_uHalfSize;
+
+	// --- merge: Z[k] = Xe[k] + i Xo[k]
+	for(UINT k = 0; k < M; k++)
+	{
+		float ar = pRe[k], ai = pIm[k];
+		float br = pRe[M - k], bi = -pIm[M - k];
+
+		float er = 0.5f*(ar + br);
+		float ei = 0.5f*(ai + bi);
+		float dr = 0.5f*(ar - br);
+		float di = 0.5f*(ai - bi);
+
+		// --- Xo = d * conj(W^k)
+		float c = m_pSplitCos[k], s = m_pSplitSin[k];
+		float or_ = dr*c - di*s;
+		float oi = dr*s + di*c;
+
+		m_pWorkRe[k] = er - oi;
+		m_pWorkIm[k] = ei + or_;
+	}
+
+	complexFFT(true);
+
+	float fScale = 1.0f/(float)M;
+	for(UINT n = 0; n < M; n++)
+	{
+		pOutput[2*n] = m_pWorkRe[n]*fScale;
+		pOutput[2*n + 1] = m_pWorkIm[n]*fScale;
+	}
+}
+
+// --- CPartitionedConvolver ---------------------------------------------------------------
+CPartitionedConvolver::CPartitionedConvolver(void)
+{
+	m_uBlockSize = 0;
+	m_uBins = 0;
+	m_uBinStride = 0;
+	m_uMaxPartitions = 0;
+	m_uChannels = 0;
+	for(UINT i = 0; i < 2; i++)
+	{
+		m_pIRRe[i] = NULL;
+		m_pIRIm[i] = NULL;
+		m_uPartitions[i] = 0;
+	}
+	m_uActive = 0;
+	m_uIRState.store(IR_IDLE);
+	m_pIRTime = NULL;
+	m_pFadeTime = NULL;
+	m_pFDLRe = NULL;
+	m_pFDLIm = NULL;
+	m_uFDLIndex = 0;
+	m_pInput = NULL;
+	m_pOutput = NULL;
+	m_pAccRe = NULL;
+	m_pAccIm = NULL;
+	m_pTime = NULL;
+	m_uCount = 0;
+}
+
+CPartitionedConvolver::~CPartitionedConvolver(void)
+{
+	destroy();
+}
+
+void CPartitionedConvolver::destroy()
+{
+	for(UINT i = 0; i < 2; i++)
+	{
+		delete [] m_pIRRe[i];
+		delete [] m_pIRIm[i];
+		m_pIRRe[i] = NULL;
+		m_pIRIm[i] = NULL;
+	}
+	delete [] m_pIRTime;
+	delete [] m_pFadeTime;
+	delete [] m_pFDLRe;
+	delete [] m_pFDLIm;
+	delete [] m_pInput;
+	delete [] m_pOutput;
+	delete [] m_pAccRe;
+	delete [] m_pAccIm;
+	delete [] m_pTime;
+
+	m_pIRTime = NULL;
+	m_pFadeTime = NULL;
+	m_pFDLRe = NULL;
+	m_pFDLIm = NULL;
+	m_pInput = NULL;
+	m_pOutput = NULL;
+	m_pAccRe = NULL;
+	m_pAccIm = NULL;
+	m_pTime = NULL;
+}
+
+void CPartitionedConvolver::init(UINT uBlockSize, UINT uMaxIRLength, UINT uChannels)
+{
+	destroy();
+
+	m_uBlockSize = uBlockSize;
+	m_uBins = uBlockSize + 1;
+	m_uBinStride = (m_uBins + 3) & ~3u;
+	m_uMaxPartitions = (uMaxIRLength + uBlockSize - 1)/uBlockSize;
+	m_uChannels = uChannels;
+
+	m_FFT.init(2*uBlockSize);
+	m_IRFFT.init(2*uBlockSize);
+
+	// --- padding bins past B + 1 stay zero for the SIMD MAC
+	UINT uSpectra = m_uMaxPartitions*m_uBinStride;
+	for(UINT i = 0; i < 2; i++)
+	{
+		m_pIRRe[i] = new float[uSpectra];
+		m_pIRIm[i] = new float[uSpectra];
+		memset(m_pIRRe[i], 0, uSpectra*sizeof(float));
+		memset(m_pIRIm[i], 0, uSpectra*sizeof(float));
+		m_uPartitions[i] = 0;
+	}
+	m_uActive = 0;
+	m_uIRState.store(IR_IDLE);
+
+	m_pIRTime = new float[2*uBlockSize];
+	m_pFadeTime = new float[2*uBlockSize];
+	m_pFDLRe = new float[uSpectra*uChannels];
+	m_pFDLIm = new float[uSpectra*uChannels];
+	m_pInput = new float[2*uBlockSize*uChannels];
+	m_pOutput = new float[uBlockSize*uChannels];
+	m_pAccRe = new float[m_uBinStride];
+	m_pAccIm = new float[m_uBinStride];
+	m_pTime = new float[2*uBlockSize];
+
+	memset(m_pAccRe, 0, m_uBinStride*sizeof(float));
+	memset(m_pAccIm, 0, m_uBinStride*sizeof(float));
+
+	reset();
+}
+
+void CPartitionedConvolver::reset()
+{
+	if(!m_pFDLRe)
+		return;
+
+	UINT uSpectra = m_uMaxPartitions*m_uBinStride*m_uChannels;
+	memset(m_pFDLRe, 0, uSpectra*sizeof(float));
+	memset(m_pFDLIm, 0, uSpectra*sizeof(float));
+	memset(m_pInput, 0, 2*m_uBlockSize*m_uChannels*sizeof(float));
+	memset(m_pOutput, 0, m_uBlockSize*m_uChannels*sizeof(float));
+	m_uFDLIndex = 0;
+	m_uCount = 0;
+}
+
+void CPartitionedConvolver::transformIR(UINT uSlot, const float* pIR, UINT uLength)
+{
+	UINT uMaxLength = m_uMaxPartitions*m_uBlockSize;
+	if(uLength > uMaxLength)
+		uLength = uMaxLength;
+
+	UINT uPartitions = (uLength + m_uBlockSize - 1)/m_uBlockSize;
+
+	for(UINT p = 0; p < uPartitions; p++)
+	{
+		// --- partition in the first half, zeros in the second
+		UINT uStart = p*m_uBlockSize;
+		UINT uCount = uLength - uStart < m_uBlockSize ? uLength - uStart : m_uBlockSize;
+
+		memset(m_pIRTime, 0, 2*m_uBlockSize*sizeof(float));
+		memcpy(m_pIRTime, pIR + uStart, uCount*sizeof(float));
+
+		m_IRFFT.forward(m_pIRTime, m_pIRRe[uSlot] + p*m_uBinStride, m_pIRIm[uSlot] + p*m_uBinStride);
+	}
+
+	m_uPartitions[uSlot] = uPartitions;
+}
+
+void CPartitionedConvolver::setImpulseResponse(const float* pIR, UINT uLength)
+{
+	if(!m_pIRRe[0])
+		return;
+
+	// --- a prepared IR that was never picked up is dropped
+	m_uIRState.store(IR_IDLE);
+	transformIR(m_uActive, pIR, uLength);
+}
+
+// --- IR_IDLE: the spare spectra are ours. IR_READY: they hold an IR the audio
+//     thread has not taken yet; taking them back (IR_READY -> IR_IDLE) races
+//     the audio thread taking them (IR_READY -> IR_FADING), and whoever loses
+//     the exchange leaves them alone. IR_FADING: the audio thread reads both
+//     sets until it stores IR_IDLE at the end of the block
+bool CPartitionedConvolver::prepareImpulseResponse(const float* pIR, UINT uLength)
+{
+	if(!m_pIRRe[0])
+		return false;
+
+	UINT uState = m_uIRState.load(std::memory_order_acquire);
+	if(uState == IR_FADING)
+		return false;
+	if(uState == IR_READY && !m_uIRState.compare_exchange_strong(uState, IR_IDLE, std::memory_order_acq_rel))
+		return false;
+
+	transformIR(m_uActive ^ 1, pIR, uLength);
+	m_uIRState.store(IR_READY, std::memory_order_release);
+	return true;
+}
+
+void CPartitionedConvolver::processFrame(const float* pInput, float* pOutput)
+{
+	for(UINT c = 0; c < m_uChannels; c++)
+	{
+		pOutput[c] = m_pOutput[c*m_uBlockSize + m_uCount];
+		m_pInput[c*2*m_uBlockSize + m_uBlockSize + m_uCount] = pInput[c];
+	}
+
+	if(++m_uCount == m_uBlockSize)
+	{
+		processBlock();
+		m_uCount = 0;
+	}
+}
+
+// --- Y = sum X[k - p] * H[p] for one set of IR spectra, back to 2B samples
+void CPartitionedConvolver::convolve(UINT uSlot, const float* pFDLRe, const float* pFDLIm, float* pOutput)
+{
+	memset(m_pAccRe, 0, m_uBinStride*sizeof(float));
+	memset(m_pAccIm, 0, m_uBinStride*sizeof(float));
+
+	UINT uFDLSlot = m_uFDLIndex;
+	for(UINT p = 0; p < m_uPartitions[uSlot]; p++)
+	{
+		complexMultiplyAccumulate(m_pAccRe, m_pAccIm,
+								  pFDLRe + uFDLSlot*m_uBinStride, pFDLIm + uFDLSlot*m_uBinStride,
+								  m_pIRRe[uSlot] + p*m_uBinStride, m_pIRIm[uSlot] + p*m_uBinStride, m_uBinStride);
+
+		uFDLSlot = uFDLSlot == 0 ? m_uMaxPartitions - 1 : uFDLSlot - 1;
+	}
+
+	m_FFT.inverse(m_pAccRe, m_pAccIm, pOutput);
+}
+
+void CPartitionedConvolver::processBlock()
+{
+	UINT uSpectra = m_uMaxPartitions*m_uBinStride;
+
+	// --- a prepared IR takes over with this block
+	bool bFade = false;
+	UINT uReady = IR_READY;
+	if(m_uIRState.load(std::memory_order_relaxed) == IR_READY &&
+	   m_uIRState.compare_exchange_strong(uReady, IR_FADING, std::memory_order_acq_rel))
+	{
+		m_uActive ^= 1;
+		bFade = true;
+	}
+
+	for(UINT c = 0; c < m_uChannels; c++)
+	{
+		float* pWindow = m_pInput + c*2*m_uBlockSize;
+		float* pFDLRe = m_pFDLRe + c*uSpectra;
+		float* pFDLIm = m_pFDLIm + c*uSpectra;
+		float* pOutput = m_pOutput + c*m_uBlockSize;
+
+		// --- newest input spectrum into the FDL
+		m_FFT.forward(pWindow, pFDLRe + m_uFDLIndex*m_uBinStride, pFDLIm + m_uFDLIndex*m_uBinStride);
+
+		// --- overlap-save: the last B samples are the linear convolution
+		convolve(m_uActive, pFDLRe, pFDLIm, m_pTime);
+		memcpy(pOutput, m_pTime + m_uBlockSize, m_uBlockSize*sizeof(float));
+
+		// --- the old IR's output, blended out across the block
+		if(bFade)
+		{
+			convolve(m_uActive ^ 1, pFDLRe, pFDLIm, m_pFadeTime);
+
+			const float* pOld = m_pFadeTime + m_uBlockSize;
+			float fStep = 1.0f/(float)m_uBlockSize;
+			for(UINT n = 0; n < m_uBlockSize; n++)
+				pOutput[n] = pOld[n] + (float)(n + 1)*fStep*(pOutput[n] - pOld[n]);
+		}
+
+		// --- slide the window
+		memcpy(pWindow, pWindow + m_uBlockSize, m_uBlockSize*sizeof(float));
+	}
+
+	m_uFDLIndex = m_uFDLIndex + 1 == m_uMaxPartitions ? 0 : m_uFDLIndex + 1;
+
+	// --- the old spectra are spare again
+	if(bFade)
+		m_uIRState.store(IR_IDLE, std::memory_order_release);
+}
+
+// --- CLinearPhaseDesigner ----------------------------------------------------------------
+// --- the design thread shared by every CLinearPhaseHPF
+class CLinearPhaseDesigner
+{
+public:
+	// --- not while the design thread may be using the filter's buffers
+	static void addFilter(CLinearPhaseHPF* pFilter);
+	static void removeFilter(CLinearPhaseHPF* pFilter);
+
+protected:
+	CLinearPhaseDesigner(void);
+	~CLinearPhaseDesigner(void);
+
+	void run();
+
+	std::mutex m_Mutex;					// held while designing, so removeFilter() waits for it
+	std::condition_variable m_Wake;		// to stop
+	std::vector<CLinearPhaseHPF*> m_Filters;
+	bool m_bStop;
+	std::thread m_Worker;
+
+	static std::mutex m_ClientMutex;
+	static CLinearPhaseDesigner* m_pDesigner;
+};
+
+std::mutex CLinearPhaseDesigner::m_ClientMutex;
+CLinearPhaseDesigner* CLinearPhaseDesigner::m_pDesigner = NULL;
+
+CLinearPhaseDesigner::CLinearPhaseDesigner(void)
+{
+	m_bStop = false;
+	m_Worker = std::thread(&CLinearPhaseDesigner::run, this);
+}
+
+CLinearPhaseDesigner::~CLinearPhaseDesigner(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_bStop = true;
+	}
+	m_Wake.notify_one();
+	m_Worker.join();
+}
+
+void CLinearPhaseDesigner::addFilter(CLinearPhaseHPF* pFilter)
+{
+	std::lock_guard<std::mutex> lock(m_ClientMutex);
+	if(!m_pDesigner)
+		m_pDesigner = new CLinearPhaseDesigner;
+
+	std::lock_guard<std::mutex> filterLock(m_pDesigner->m_Mutex);
+	m_pDesigner->m_Filters.push_back(pFilter);
+}
+
+void CLinearPhaseDesigner::removeFilter(CLinearPhaseHPF* pFilter)
+{
+	CLinearPhaseDesigner* pDesigner = NULL;
+	{
+		std::lock_guard<std::mutex> lock(m_ClientMutex);
+		if(!m_pDesigner)
+			return;
+
+		{
+			std::lock_guard<std::mutex> filterLock(m_pDesigner->m_Mutex);
+			std::vector<CLinearPhaseHPF*>& filters = m_pDesigner->m_Filters;
+			for(UINT i = 0; i < filters.size(); i++)
+			{
+				if(filters[i] == pFilter)
+				{
+					filters[i] = filters.back();
+					filters.pop_back();
+					break;
+				}
+			}
+			if(filters.empty())
+				pDesigner = m_pDesigner;
+		}
+
+		if(pDesigner)
+			m_pDesigner = NULL;
+	}
+
+	// --- outside the lock: this waits for the thread to finish its round
+	delete pDesigner;
+}
+
+// --- setCutoff() is one store, so the audio thread never wakes this thread
+//     (a system call that can hand it the CPU); it looks every
+//     LINEAR_PHASE_POLL_MSEC instead
+void CLinearPhaseDesigner::run()
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	while(!m_bStop)
+	{
+		for(UINT i = 0; i < m_Filters.size(); i++)
+			m_Filters[i]->designIfChanged();
+
+		m_Wake.wait_for(lock, std::chrono::milliseconds(LINEAR_PHASE_POLL_MSEC));
+	}
+}
+
+// --- CLinearPhaseHPF ---------------------------------------------------------------------
+CLinearPhaseHPF::CLinearPhaseHPF(void)
+{
+	m_dSampleRate = 0.0;
+	m_uLength = 0;
+	m_pTaps = NULL;
+	m_pDesignTaps = NULL;
+	m_dCutoff_Hz.store(-1.0);
+	m_dDesignedCutoff_Hz = -1.0;
+	m_uDesignCount.store(0);
+	m_bDesigning = false;
+}
+
+CLinearPhaseHPF::~CLinearPhaseHPF(void)
+{
+	if(m_bDesigning)
+		CLinearPhaseDesigner::removeFilter(this);
+
+	delete [] m_pTaps;
+	delete [] m_pDesignTaps;
+}
+
+void CLinearPhaseHPF::init(double dSampleRate, UINT uChannels)
+{
+	// --- already set up for this rate: just flush; the design thread only
+	//     touches the taps and the spare IR spectra
+	if(m_pTaps && dSampleRate == m_dSampleRate)
+	{
+		reset();
+		return;
+	}
+
+	// --- the design thread uses everything below
+	if(m_bDesigning)
+		CLinearPhaseDesigner::removeFilter(this);
+	m_bDesigning = false;
+
+	m_dSampleRate = dSampleRate;
+
+	// --- about fs/6 taps (8191 at 44.1k/48k) keeps the Blackman transition
+	//     band near 30Hz; must be odd for a type I high-pass
+	m_uLength = nextPowerOfTwo((UINT)(dSampleRate/6.0)) - 1;
+	if(m_uLength < 255)
+		m_uLength = 255;
+
+	// --- block size tracks sqrt(length) so cost per sample grows as O(sqrt(N))
+	UINT uBlockSize = nextPowerOfTwo((UINT)(2.0*sqrt((double)m_uLength)));
+	if(uBlockSize < 64) uBlockSize = 64;
+	if(uBlockSize > 1024) uBlockSize = 1024;
+
+	delete [] m_pTaps;
+	delete [] m_pDesignTaps;
+	m_pTaps = new float[m_uLength];
+	m_pDesignTaps = new float[m_uLength];
+	memset(m_pTaps, 0, m_uLength*sizeof(float));
+
+	m_Convolver.init(uBlockSize, m_uLength, uChannels);
+
+	// --- the first design at the new rate is made here, so playback starts with it
+	double dCutoff = m_dCutoff_Hz.load();
+	m_dDesignedCutoff_Hz = dCutoff;
+	if(dCutoff > 0.0)
+	{
+		designHPF(m_pTaps, m_uLength, dCutoff, m_dSampleRate);
+		m_Convolver.setImpulseResponse(m_pTaps, m_uLength);
+		m_uDesignCount.fetch_add(1, std::memory_order_release);
+	}
+
+	CLinearPhaseDesigner::addFilter(this);
+	m_bDesigning = true;
+}
+
+// --- one store; the design thread picks it up within LINEAR_PHASE_POLL_MSEC
+void CLinearPhaseHPF::setCutoff(double dCutoff_Hz)
+{
+	m_dCutoff_Hz.store(dCutoff_Hz, std::memory_order_relaxed);
+}
+
+void CLinearPhaseHPF::designIfChanged()
+{
+	double dCutoff = m_dCutoff_Hz.load();
+	if(dCutoff <= 0.0 || dCutoff == m_dDesignedCutoff_Hz)
+		return;
+
+	designHPF(m_pDesignTaps, m_uLength, dCutoff, m_dSampleRate);
+
+	// --- refused only while the audio thread is mid-crossfade, inside one
+	//     processBlock(), so this does not spin for long
+	while(!m_Convolver.prepareImpulseResponse(m_pDesignTaps, m_uLength))
+		std::this_thread::yield();
+
+	// --- for displays; the count tells them to redraw
+	memcpy(m_pTaps, m_pDesignTaps, m_uLength*sizeof(float));
+	m_dDesignedCutoff_Hz = dCutoff;
+	m_uDesignCount.fetch_add(1, std::memory_order_release);
+}
+
+UINT CLinearPhaseHPF::getLatencyInSamples()
+{
+	if(m_uLength == 0)
+		return 0;
+
+	return m_Convolver.getLatencyInSamples() + (m_uLength - 1)/2;
+}
+
+void CLinearPhaseHPF::designHPF(float* pTaps, UINT uLength, double dCutoff_Hz, double dSampleRate)
+{
+	int nCenter = (int)(uLength - 1)/2;
+	double fc = dCutoff_Hz/dSampleRate;
+	double dSum = 0.0;
+
+	// --- this runs on every cutoff change, so the sinc and the Blackman window
+	//     use sin/cos recurrences instead of ~3N libm calls:
+	//     sin((m + 1)w) = 2cos(w)sin(mw) - sin((m - 1)w)
+	double dSincStep = 2.0*cos(2.0*pi*fc);
+	double dSin_1 = 0.0;					// sin(0)
+	double dSin = sin(2.0*pi*fc);			// sin(w)
+
+	double dWinStep1 = 2.0*cos(2.0*pi/(double)(uLength - 1));
+	double dWinStep2 = 2.0*cos(4.0*pi/(double)(uLength - 1));
+
+	// --- window is symmetric; walk outward from the center
+	double dCos1_1 = cos(2.0*pi*(double)(nCenter - 1)/(double)(uLength - 1));
+	double dCos1 = cos(2.0*pi*(double)nCenter/(double)(uLength - 1));
+	double dCos2_1 = cos(4.0*pi*(double)(nCenter - 1)/(double)(uLength - 1));
+	double dCos2 = cos(4.0*pi*(double)nCenter/(double)(uLength - 1));
+
+	pTaps[nCenter] = (float)(2.0*fc*(0.42 - 0.5*dCos1 + 0.08*dCos2));
+	dSum = 2.0*fc*(0.42 - 0.5*dCos1 + 0.08*dCos2);
+
+	for(int m = 1; m <= nCenter; m++)
+	{
+		// --- advance the window cosines to n = nCenter + m
+		double dNext1 = dWinStep1*dCos1 - dCos1_1;
+		double dNext2 = dWinStep2*dCos2 - dCos2_1;
+		dCos1_1 = dCos1; dCos1 = dNext1;
+		dCos2_1 = dCos2; dCos2 = dNext2;
+
+		double dWindow = 0.42 - 0.5*dCos1 + 0.08*dCos2;
+		double dTap = dSin/(pi*(double)m)*dWindow;
+
+		pTaps[nCenter + m] = (float)dTap;
+		pTaps[nCenter - m] = (float)dTap;
+		dSum += 2.0*dTap;
+
+		double dNextSin = dSincStep*dSin - dSin_1;
+		dSin_1 = dSin; dSin = dNextSin;
+	}
+
+	// --- normalize to unity DC gain, then spectral inversion: h = delta - lpf
+	double dScale = -1.0/dSum;
+	for(UINT n = 0; n < uLength; n++)
+		pTaps[n] = (float)((double)pTaps[n]*dScale);
+
+	pTaps[nCenter] += 1.0f;
+}
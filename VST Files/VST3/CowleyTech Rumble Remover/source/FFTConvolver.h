@@ -0,0 +1,181 @@
+#pragma once
+
+#include "pluginconstants.h"
+
+// --- uniformly partitioned overlap-save (UPOLS) FFT convolution
+//
+//     The impulse response is cut into P partitions of B samples; each one is
+//     zero-padded to 2B and transformed once. Every B input samples the newest
+//     2B-sample input window is transformed into a frequency-domain delay line
+//     (FDL) and the output block is the inverse transform of
+//
+//         Y = sum(p = 0..P-1) X[k - p] * H[p]
+//
+//     so the cost per sample is O(log B + P). With B tracking sqrt(IR length)
+//     that is O(sqrt(N)) instead of the O(N) of direct convolution.
+//     Latency is B samples.
+//
+//     The IR spectra are double buffered so a new IR can be transformed on
+//     another thread while the old one plays. The audio thread picks it up at
+//     its next block and crossfades from the old IR to the new one across that
+//     block; both run on the same FDL, so the change is a smooth blend of two
+//     filters of the same input rather than a jump.
+
+// --- real-input radix-2 FFT; spectra are N/2 + 1 bins in split re/im arrays
+class CRealFFT
+{
+public:
+	CRealFFT(void);
+	~CRealFFT(void);
+
+	// --- uSize is a power of 2, >= 4; allocates, call from prepareForPlay()
+	void init(UINT uSize);
+	UINT getSize(){return m_uSize;}
+
+	// --- N real samples -> N/2 + 1 complex bins
+	void forward(const float* pInput, float* pRe, float* pIm);
+
+	// --- N/2 + 1 complex bins -> N real samples (scaled by 1/N)
+	void inverse(const float* pRe, const float* pIm, float* pOutput);
+
+protected:
+	// --- in-place complex FFT of size N/2 on the work arrays
+	void complexFFT(bool bInverse);
+	void destroy();
+
+	UINT m_uSize;
+	UINT m_uHalfSize;
+	UINT* m_pBitReverse;	// N/2 entries
+	float* m_pCos;			// N/4 twiddles for the N/2 complex FFT
+	float* m_pSin;
+	float* m_pStageCos;		// the same twiddles, contiguous per stage (N/2 - 1)
+	float* m_pStageSin;
+	float* m_pSplitCos;		// N/2 + 1 twiddles for the real/complex split
+	float* m_pSplitSin;
+	float* m_pWorkRe;		// N/2
+	float* m_pWorkIm;
+};
+
+// --- multi-channel UPOLS convolver; all channels share one impulse response
+class CPartitionedConvolver
+{
+public:
+	CPartitionedConvolver(void);
+	~CPartitionedConvolver(void);
+
+	// --- uBlockSize is a power of 2; allocates for IRs up to uMaxIRLength
+	void init(UINT uBlockSize, UINT uMaxIRLength, UINT uChannels);
+
+	// --- transform and store a new IR, replacing the current one at once; not
+	//     while processing
+	void setImpulseResponse(const float* pIR, UINT uLength);
+
+	// --- one non-audio thread: transform a new IR into the spare spectra for
+	//     the audio thread to crossfade to at its next block. A newer IR
+	//     replaces one that has not been picked up yet. false (nothing done)
+	//     while the audio thread is mid-crossfade, which lasts one block
+	bool prepareImpulseResponse(const float* pIR, UINT uLength);
+
+	// --- flush the FDL and the I/O blocks
+	void reset();
+
+	// --- one sample per channel in, one out; output is delayed by the block size
+	void processFrame(const float* pInput, float* pOutput);
+
+	UINT getLatencyInSamples(){return m_uBlockSize;}
+	UINT getBlockSize(){return m_uBlockSize;}
+
+protected:
+	// --- the spare spectra's hand over, see prepareImpulseResponse()
+	enum {IR_IDLE, IR_READY, IR_FADING};
+
+	void processBlock();
+	void convolve(UINT uSlot, const float* pFDLRe, const float* pFDLIm, float* pOutput);
+	void transformIR(UINT uSlot, const float* pIR, UINT uLength);
+	void destroy();
+
+	CRealFFT m_FFT;
+	CRealFFT m_IRFFT;			// the IR's side, so it never shares scratch with the audio thread
+
+	UINT m_uBlockSize;
+	UINT m_uBins;				// B + 1
+	UINT m_uBinStride;			// bins rounded up to 4 for the SIMD MAC
+	UINT m_uMaxPartitions;
+	UINT m_uChannels;
+
+	float* m_pIRRe[2];			// m_uMaxPartitions spectra each; [m_uActive] plays
+	float* m_pIRIm[2];
+	UINT m_uPartitions[2];		// partitions in each IR
+	UINT m_uActive;				// flipped by the audio thread only, in IR_FADING
+	std::atomic<UINT> m_uIRState;
+	float* m_pIRTime;			// 2B scratch for transformIR()
+	float* m_pFadeTime;			// 2B, the old IR's output while fading
+	float* m_pFDLRe;			// m_uMaxPartitions spectra per channel, ring buffer
+	float* m_pFDLIm;
+	UINT m_uFDLIndex;
+
+	float* m_pInput;			// 2B sliding window per channel
+	float* m_pOutput;			// B output samples per channel
+	float* m_pAccRe;			// spectrum accumulator
+	float* m_pAccIm;
+	float* m_pTime;				// 2B scratch
+	UINT m_uCount;				// samples into the current block
+};
+
+// --- linear phase FIR high-pass: windowed-sinc design run on a CPartitionedConvolver
+//
+//     Cutoff changes only post the new cutoff; a design thread makes the FIR
+//     and transforms it, and the convolver crossfades to it over one block.
+//     The audio thread never designs, and a sweep of the cutoff designs only
+//     the latest value each time the thread gets round to it. One design
+//     thread serves every filter in the process, from the first init() to the
+//     last filter's destruction.
+const UINT LINEAR_PHASE_POLL_MSEC = 5;		// how often the design thread looks for a new cutoff
+
+class CLinearPhaseDesigner;
+
+class CLinearPhaseHPF
+{
+public:
+	CLinearPhaseHPF(void);
+	~CLinearPhaseHPF(void);
+
+	// --- picks the FIR length and block size for the sample rate, allocates
+	//     and designs the current cutoff in place; not while processing
+	void init(double dSampleRate, UINT uChannels);
+
+	// --- any thread, the audio thread included; the design follows shortly
+	void setCutoff(double dCutoff_Hz);
+
+	void reset(){m_Convolver.reset();}
+	void processFrame(const float* pInput, float* pOutput){m_Convolver.processFrame(pInput, pOutput);}
+
+	// --- block latency plus the (N - 1)/2 group delay of the FIR
+	UINT getLatencyInSamples();
+	UINT getLength(){return m_uLength;}
+
+	// --- the latest design, for displays; NULL before init(). The count moves
+	//     every time a new design is handed to the convolver
+	const float* getTaps(){return m_pTaps;}
+	UINT getDesignCount(){return m_uDesignCount.load(std::memory_order_acquire);}
+
+	// --- Blackman windowed sinc, uLength odd; zero gain at DC
+	static void designHPF(float* pTaps, UINT uLength, double dCutoff_Hz, double dSampleRate);
+
+protected:
+	friend class CLinearPhaseDesigner;
+
+	// --- design thread: designs the cutoff asked for and hands it over, if it is new
+	void designIfChanged();
+
+	CPartitionedConvolver m_Convolver;
+	double m_dSampleRate;
+	UINT m_uLength;
+	float* m_pTaps;				// published design
+	float* m_pDesignTaps;		// the design thread's
+
+	std::atomic<double> m_dCutoff_Hz;		// asked for
+	double m_dDesignedCutoff_Hz;			// design thread (or init()) only
+	std::atomic<UINT> m_uDesignCount;
+	bool m_bDesigning;						// known to the design thread
+};
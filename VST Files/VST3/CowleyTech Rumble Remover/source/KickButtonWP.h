@@ -5,7 +5,6 @@
 
 #include "vstgui/lib/controls/cvumeter.h"
 #include "vstgui/lib/cbitmap.h"
-#include "RackAFXMeterDetector.h"
 
 
 namespace VSTGUI {
@@ -9,6 +9,7 @@
 
 #include "pluginconstants.h"
 #include "plugin.h"
+#include "ResponseCurve.h"
 
 
 // abstract base class for DSP filters
@@ -88,6 +89,11 @@ public:	// Plug-In API Functions
 	void calculateMMALPFCoeffs(float fCutoffFreq, float fQ);
 	void calculateResonatorCoeffs(float fCutoffFreq, float fQ);
 	void calculateImprovedResonatorCoeffs(float fCutoffFreq, float fQ);
+
+	// --- response curve of m_LeftLPF (both channels share its coefficients)
+	CResponseCurve m_ResponseCurve;
+	virtual CResponseCurve* __stdcall getResponseCurve();
+	virtual bool __stdcall getFilterResponse(CFilterDescription& description);
 	// END OF USER CODE -------------------------------------------------------------- //
 
 
@@ -0,0 +1,315 @@
+#include "ResponseCurve.h"
+#include "plugin.h"
+
+// --- SSE section loop where the target has it; plain loop otherwise
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAFX_RESPONSE_SSE 1
+#include <xmmintrin.h>
+#endif
+
+void CFilterDescription::clear()
+{
+	m_uBranches = 0;
+	m_pFIRTaps = NULL;
+	m_uFIRLength = 0;
+}
+
+bool CFilterDescription::addBranch(float fGain)
+{
+	if(m_uBranches == RESPONSE_MAX_BRANCHES)
+		return false;
+
+	m_fGain[m_uBranches] = fGain;
+	m_uSections[m_uBranches] = 0;
+	m_uBranches++;
+	return true;
+}
+
+bool CFilterDescription::addSection(float a0, float a1, float a2, float b1, float b2)
+{
+	if(m_uBranches == 0)
+		return false;
+
+	UINT uBranch = m_uBranches - 1;
+	UINT uSection = m_uSections[uBranch];
+	if(uSection == RESPONSE_MAX_SECTIONS)
+		return false;
+
+	float* pCoeffs = &m_fCoeffs[uBranch][5*uSection];
+	pCoeffs[0] = a0;
+	pCoeffs[1] = a1;
+	pCoeffs[2] = a2;
+	pCoeffs[3] = b1;
+	pCoeffs[4] = b2;
+	m_uSections[uBranch]++;
+	return true;
+}
+
+bool CFilterDescription::addSections(const float* pCoeffs, UINT uSections)
+{
+	for(UINT k = 0; k < uSections; k++)
+	{
+		if(!addSection(pCoeffs[5*k], pCoeffs[5*k + 1], pCoeffs[5*k + 2], pCoeffs[5*k + 3], pCoeffs[5*k + 4]))
+			return false;
+	}
+	return true;
+}
+
+void CFilterDescription::setLinearPhaseFIR(const float* pTaps, UINT uLength)
+{
+	m_pFIRTaps = pTaps;
+	m_uFIRLength = pTaps ? uLength : 0;
+}
+
+// CResponseCurve Implementation ----------------------------------------------------------------
+//
+// --- the display points are the same for every instance, so they are worked out once
+struct responseCurveFrequencies
+{
+	float fHz[RESPONSE_CURVE_POINTS];
+
+	responseCurveFrequencies()
+	{
+		for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+			fHz[i] = RESPONSE_CURVE_MIN_HZ*pow(RESPONSE_CURVE_MAX_HZ/RESPONSE_CURVE_MIN_HZ, (double)i/(double)(RESPONSE_CURVE_POINTS - 1));
+	}
+};
+
+CResponseCurve::CResponseCurve(void)
+{
+	m_pSource = NULL;
+	m_uVersion.store(0);
+	m_uSampleRate.store(44100);
+
+	m_uTableRate = 0;
+	m_bCached = false;
+	m_uSnapshotVersion = 0;
+
+	static const responseCurveFrequencies frequencies;
+	memcpy(m_fFrequencies, frequencies.fHz, sizeof(m_fFrequencies));
+}
+
+void CResponseCurve::setSampleRate(float fSampleRate)
+{
+	m_uSampleRate.store((UINT)fSampleRate, std::memory_order_relaxed);
+	invalidate();
+}
+
+// --- points above Nyquist are clamped to just below it
+void CResponseCurve::setupTables(UINT uSampleRate)
+{
+	m_uTableRate = uSampleRate;
+
+	double dMaxOmega = 0.999*pi;
+	for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+	{
+		double w = 2.0*pi*m_fFrequencies[i]/(double)uSampleRate;
+		if(w > dMaxOmega)
+			w = dMaxOmega;
+
+		m_dOmega[i] = w;
+		m_dTwoCos[i] = 2.0*cos(w);
+		m_fVersin1[i] = 2.0*sin(0.5*w)*sin(0.5*w);	// 1 - cos(w), without the cancellation
+		m_fSin1[i] = sin(w);
+		m_fVersin2[i] = 2.0*sin(w)*sin(w);
+		m_fSin2[i] = sin(2.0*w);
+	}
+}
+
+responseSnapshotPtr CResponseCurve::getSnapshot()
+{
+	UINT uVersion = m_uVersion.load(std::memory_order_acquire);
+	if(m_bCached && uVersion == m_uSnapshotVersion)
+		return m_pSnapshot;
+
+	m_bCached = true;
+	m_uSnapshotVersion = uVersion;
+	m_pSnapshot.reset();
+
+	m_Description.clear();
+	if(!m_pSource || !m_pSource->getFilterResponse(m_Description))
+		return m_pSnapshot;
+
+	CResponseSnapshot* pSnapshot = new CResponseSnapshot;
+	evaluate(m_Description, pSnapshot);
+	pSnapshot->m_uVersion = uVersion;
+
+	m_pSnapshot = responseSnapshotPtr(pSnapshot);
+	return m_pSnapshot;
+}
+
+void CResponseCurve::evaluate(const CFilterDescription& description, CResponseSnapshot* pSnapshot)
+{
+	UINT uSampleRate = m_uSampleRate.load(std::memory_order_relaxed);
+	if(uSampleRate != m_uTableRate)
+		setupTables(uSampleRate);
+
+	evaluateBranches(description);
+
+	if(description.m_pFIRTaps && description.m_uFIRLength > 0)
+		applyLinearPhaseFIR(description.m_pFIRTaps, description.m_uFIRLength);
+
+	// --- complex -> dB and phase
+	for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+	{
+		double dPower = (double)m_fHRe[i]*m_fHRe[i] + (double)m_fHIm[i]*m_fHIm[i];
+		float fdB = dPower > 1e-12 ? 10.0*log10(dPower) : RESPONSE_CURVE_FLOOR_DB;
+
+		pSnapshot->m_fFrequencies[i] = m_fFrequencies[i];
+		pSnapshot->m_fMagnitude_dB[i] = fdB > RESPONSE_CURVE_FLOOR_DB ? fdB : RESPONSE_CURVE_FLOOR_DB;
+		pSnapshot->m_fPhase[i] = atan2(m_fHIm[i], m_fHRe[i]);
+	}
+}
+
+// --- H = sum(branch) g prod(section) N/D, with N = a0 + a1z^-1 + a2z^-2 and
+//     D = 1 + b1z^-1 + b2z^-2; each section is divided out as it is applied so a
+//     long cascade of small values cannot underflow.
+//
+//     The real parts are taken as (a0 + a1 + a2) - a1(1 - cos(w)) - a2(1 - cos(2w)):
+//     at low frequencies a0 + a1cos(w) + a2cos(2w) is a small difference of terms
+//     near 1 and loses most of its float precision, where the coefficient sum is
+//     exact for the float coefficients the filter actually runs with
+void CResponseCurve::evaluateBranches(const CFilterDescription& description)
+{
+	if(description.m_uBranches == 0)
+	{
+		for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+		{
+			m_fHRe[i] = 1.0;
+			m_fHIm[i] = 0.0;
+		}
+		return;
+	}
+
+#if RAFX_RESPONSE_SSE
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i += 4)
+	{
+		__m128 v1 = _mm_loadu_ps(&m_fVersin1[i]);
+		__m128 s1 = _mm_loadu_ps(&m_fSin1[i]);
+		__m128 v2 = _mm_loadu_ps(&m_fVersin2[i]);
+		__m128 s2 = _mm_loadu_ps(&m_fSin2[i]);
+
+		__m128 sumRe = _mm_setzero_ps();
+		__m128 sumIm = _mm_setzero_ps();
+
+		for(UINT b = 0; b < description.m_uBranches; b++)
+		{
+			__m128 hRe = _mm_set1_ps(description.m_fGain[b]);
+			__m128 hIm = _mm_setzero_ps();
+
+			const float* pCoeffs = &description.m_fCoeffs[b][0];
+			for(UINT k = 0; k < description.m_uSections[b]; k++, pCoeffs += 5)
+			{
+				__m128 sumA = _mm_set1_ps((float)((double)pCoeffs[0] + pCoeffs[1] + pCoeffs[2]));
+				__m128 a1 = _mm_set1_ps(pCoeffs[1]);
+				__m128 a2 = _mm_set1_ps(pCoeffs[2]);
+				__m128 sumB = _mm_set1_ps((float)(1.0 + pCoeffs[3] + pCoeffs[4]));
+				__m128 b1 = _mm_set1_ps(pCoeffs[3]);
+				__m128 b2 = _mm_set1_ps(pCoeffs[4]);
+
+				// --- N and D at e^-jw (the imaginary parts are negated sines)
+				__m128 nRe = _mm_sub_ps(sumA, _mm_add_ps(_mm_mul_ps(a1, v1), _mm_mul_ps(a2, v2)));
+				__m128 nIm = _mm_add_ps(_mm_mul_ps(a1, s1), _mm_mul_ps(a2, s2));
+				__m128 dRe = _mm_sub_ps(sumB, _mm_add_ps(_mm_mul_ps(b1, v1), _mm_mul_ps(b2, v2)));
+				__m128 dIm = _mm_add_ps(_mm_mul_ps(b1, s1), _mm_mul_ps(b2, s2));
+
+				// --- q = N/D = N conj(D)/|D|^2; the sign of both imaginary parts
+				//     cancels in the real part and is restored in the imaginary
+				__m128 invD = _mm_div_ps(one, _mm_add_ps(_mm_mul_ps(dRe, dRe), _mm_mul_ps(dIm, dIm)));
+				__m128 qRe = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(nRe, dRe), _mm_mul_ps(nIm, dIm)), invD);
+				__m128 qIm = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(nRe, dIm), _mm_mul_ps(nIm, dRe)), invD);
+
+				__m128 t = _mm_sub_ps(_mm_mul_ps(hRe, qRe), _mm_mul_ps(hIm, qIm));
+				hIm = _mm_add_ps(_mm_mul_ps(hRe, qIm), _mm_mul_ps(hIm, qRe));
+				hRe = t;
+			}
+
+			sumRe = _mm_add_ps(sumRe, hRe);
+			sumIm = _mm_add_ps(sumIm, hIm);
+		}
+
+		_mm_storeu_ps(&m_fHRe[i], sumRe);
+		_mm_storeu_ps(&m_fHIm[i], sumIm);
+	}
+#else
+	for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+	{
+		float sumRe = 0.0;
+		float sumIm = 0.0;
+
+		for(UINT b = 0; b < description.m_uBranches; b++)
+		{
+			float hRe = description.m_fGain[b];
+			float hIm = 0.0;
+
+			const float* pCoeffs = &description.m_fCoeffs[b][0];
+			for(UINT k = 0; k < description.m_uSections[b]; k++, pCoeffs += 5)
+			{
+				float sumA = (float)((double)pCoeffs[0] + pCoeffs[1] + pCoeffs[2]);
+				float sumB = (float)(1.0 + pCoeffs[3] + pCoeffs[4]);
+
+				float nRe = sumA - pCoeffs[1]*m_fVersin1[i] - pCoeffs[2]*m_fVersin2[i];
+				float nIm = pCoeffs[1]*m_fSin1[i] + pCoeffs[2]*m_fSin2[i];
+				float dRe = sumB - pCoeffs[3]*m_fVersin1[i] - pCoeffs[4]*m_fVersin2[i];
+				float dIm = pCoeffs[3]*m_fSin1[i] + pCoeffs[4]*m_fSin2[i];
+
+				float invD = 1.0f/(dRe*dRe + dIm*dIm);
+				float qRe = (nRe*dRe + nIm*dIm)*invD;
+				float qIm = (nRe*dIm - nIm*dRe)*invD;
+
+				float t = hRe*qRe - hIm*qIm;
+				hIm = hRe*qIm + hIm*qRe;
+				hRe = t;
+			}
+
+			sumRe += hRe;
+			sumIm += hIm;
+		}
+
+		m_fHRe[i] = sumRe;
+		m_fHIm[i] = sumIm;
+	}
+#endif
+}
+
+// --- type I: H = e^-jwc (h[c] + 2 sum(m = 1..c) h[c + m] cos(mw)), c = (N - 1)/2;
+//     the tap loop is outside so every point's cosine recurrence advances
+//     together (and vectorizes); double, since the recurrence runs for
+//     thousands of steps
+void CResponseCurve::applyLinearPhaseFIR(const float* pTaps, UINT uLength)
+{
+	UINT uCenter = (uLength - 1)/2;
+
+	for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+	{
+		m_dCos_1[i] = 1.0;		// cos(0)
+		m_dCos[i] = 0.5*m_dTwoCos[i];
+		m_dSum[i] = pTaps[uCenter];
+	}
+
+	for(UINT m = 1; m <= uCenter; m++)
+	{
+		double dTap = 2.0*pTaps[uCenter + m];
+		for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+		{
+			m_dSum[i] += dTap*m_dCos[i];
+
+			double dNext = m_dTwoCos[i]*m_dCos[i] - m_dCos_1[i];
+			m_dCos_1[i] = m_dCos[i];
+			m_dCos[i] = dNext;
+		}
+	}
+
+	for(UINT i = 0; i < RESPONSE_CURVE_POINTS; i++)
+	{
+		double dDelay = m_dOmega[i]*uCenter;
+		double dRe = m_dSum[i]*cos(dDelay);
+		double dIm = -m_dSum[i]*sin(dDelay);
+
+		double t = m_fHRe[i]*dRe - m_fHIm[i]*dIm;
+		m_fHIm[i] = m_fHRe[i]*dIm + m_fHIm[i]*dRe;
+		m_fHRe[i] = t;
+	}
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "pluginconstants.h"
+#include <atomic>
+#include <memory>
+
+class CPlugIn;
+
+// --- frequency response curve service for the editor
+//
+//     The plug-in owns one CResponseCurve and calls invalidate() whenever its
+//     coefficients change (any thread, the audio thread included: it is one
+//     atomic add). Views call getSnapshot() on each timer tick; while the
+//     version has not moved that is one atomic load and returns the same
+//     snapshot. Otherwise the plug-in's getFilterResponse() describes the
+//     filter as a CFilterDescription and every point is evaluated in one pass
+//     over the sections, 4 points per SSE vector, from tables of e^-jw and
+//     e^-j2w made once per sample rate.
+//
+//     Snapshots are immutable and reference counted: a view keeps the one it
+//     drew from and compares pointers to see if the curve changed.
+const UINT RESPONSE_CURVE_POINTS = 256;		// multiple of 4
+const float RESPONSE_CURVE_MIN_HZ = 10.0;
+const float RESPONSE_CURVE_MAX_HZ = 20000.0;
+const float RESPONSE_CURVE_FLOOR_DB = -120.0;
+const UINT RESPONSE_MAX_BRANCHES = 4;
+const UINT RESPONSE_MAX_SECTIONS = 8;		// per branch
+
+// --- a filter as the sum of up to RESPONSE_MAX_BRANCHES gains times cascades of
+//     biquads (a0, a1, a2, b1, b2 per section, the CBiQuad coefficients), in
+//     series with an optional type I linear phase FIR. No branches is a flat
+//     (unity) response.
+class CFilterDescription
+{
+public:
+	CFilterDescription(void){clear();}
+
+	void clear();
+
+	// --- starts a new parallel branch; false if there are already RESPONSE_MAX_BRANCHES
+	bool addBranch(float fGain);
+
+	// --- to the last branch; false if there is none or it is full
+	bool addSection(float a0, float a1, float a2, float b1, float b2);
+	bool addSections(const float* pCoeffs, UINT uSections);
+
+	// --- odd length, symmetric; the taps are read, not copied, so they must stay
+	//     valid until the description has been evaluated
+	void setLinearPhaseFIR(const float* pTaps, UINT uLength);
+
+	UINT m_uBranches;
+	float m_fGain[RESPONSE_MAX_BRANCHES];
+	UINT m_uSections[RESPONSE_MAX_BRANCHES];
+	float m_fCoeffs[RESPONSE_MAX_BRANCHES][5*RESPONSE_MAX_SECTIONS];
+	const float* m_pFIRTaps;
+	UINT m_uFIRLength;
+};
+
+// --- one evaluated curve; never changes once published
+class CResponseSnapshot
+{
+public:
+	UINT getCount() const {return RESPONSE_CURVE_POINTS;}
+	UINT getVersion() const {return m_uVersion;}
+	const float* getFrequencies() const {return &m_fFrequencies[0];}	// Hz, log spaced
+	const float* getMagnitude_dB() const {return &m_fMagnitude_dB[0];}
+	const float* getPhase() const {return &m_fPhase[0];}				// radians, -pi to pi
+
+protected:
+	friend class CResponseCurve;
+
+	UINT m_uVersion;
+	float m_fFrequencies[RESPONSE_CURVE_POINTS];
+	float m_fMagnitude_dB[RESPONSE_CURVE_POINTS];
+	float m_fPhase[RESPONSE_CURVE_POINTS];
+};
+
+typedef std::shared_ptr<const CResponseSnapshot> responseSnapshotPtr;
+
+class CResponseCurve
+{
+public:
+	CResponseCurve(void);
+
+	// --- the plug-in whose getFilterResponse() is called
+	void setSource(CPlugIn* pSource){m_pSource = pSource;}
+
+	// --- from prepareForPlay(); also invalidates
+	void setSampleRate(float fSampleRate);
+
+	// --- any thread: the coefficients changed
+	void invalidate(){m_uVersion.fetch_add(1, std::memory_order_release);}
+
+	// --- GUI thread; the current curve, recomputed only if invalidated since the
+	//     last call; NULL if the source has no response to show
+	responseSnapshotPtr getSnapshot();
+
+	// --- GUI thread; evaluates a description at the points of the current sample
+	//     rate, without touching the cache
+	void evaluate(const CFilterDescription& description, CResponseSnapshot* pSnapshot);
+
+protected:
+	void setupTables(UINT uSampleRate);
+	void evaluateBranches(const CFilterDescription& description);
+	void applyLinearPhaseFIR(const float* pTaps, UINT uLength);
+
+	CPlugIn* m_pSource;
+	std::atomic<UINT> m_uVersion;
+	std::atomic<UINT> m_uSampleRate;
+
+	// --- GUI thread
+	UINT m_uTableRate;			// what the tables below were made for
+	responseSnapshotPtr m_pSnapshot;	// NULL if the source had no response
+	bool m_bCached;				// m_pSnapshot is the result for m_uSnapshotVersion
+	UINT m_uSnapshotVersion;
+	CFilterDescription m_Description;
+
+	// --- per point: frequency, e^-jw = cos(w) - jsin(w) and e^-j2w with the
+	//     cosines as versines (1 - cos), 2cos(w) for the FIR's cosine recurrence
+	float m_fFrequencies[RESPONSE_CURVE_POINTS];
+	float m_fVersin1[RESPONSE_CURVE_POINTS];
+	float m_fSin1[RESPONSE_CURVE_POINTS];
+	float m_fVersin2[RESPONSE_CURVE_POINTS];
+	float m_fSin2[RESPONSE_CURVE_POINTS];
+	double m_dOmega[RESPONSE_CURVE_POINTS];
+	double m_dTwoCos[RESPONSE_CURVE_POINTS];
+
+	// --- complex response being evaluated; FIR recurrence state
+	float m_fHRe[RESPONSE_CURVE_POINTS];
+	float m_fHIm[RESPONSE_CURVE_POINTS];
+	double m_dCos_1[RESPONSE_CURVE_POINTS];
+	double m_dCos[RESPONSE_CURVE_POINTS];
+	double m_dSum[RESPONSE_CURVE_POINTS];
+};
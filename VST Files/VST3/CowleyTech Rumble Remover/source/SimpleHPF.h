@@ -12,6 +12,10 @@
 
 // base class
 #include "plugin.h"
+#include "FFTConvolver.h"
+#include "SpectrumAnalyzer.h"
+#include "StereoAnalyzer.h"
+#include "ResponseCurve.h"
 
 
 // un-comment for advanced GUI API: see www.willpirkle.com for details and sample code
@@ -95,6 +99,17 @@ public:
 	// --- process aux inputs (for sidechain capability; optional, not used in FX book projects)
 	virtual bool __stdcall processAuxInputBus(audioProcessData* pAudioProcessData);
 
+	// --- spectrum view: analyzer of the input, response of the current mode
+	virtual CSpectrumAnalyzer* __stdcall getSpectrumAnalyzer();
+	virtual CResponseCurve* __stdcall getResponseCurve();
+	virtual bool __stdcall getFilterResponse(CFilterDescription& description);
+
+	// --- stereo views: correlation and mid/side of the input and of the output
+	virtual CStereoAnalyzer* __stdcall getStereoAnalyzer(bool bOutput);
+
+	// --- Mode and TP Limit change the latency
+	virtual UINT __stdcall getLatencyForControls(const float* pCookedValues);
+
 	// Add your code here: ----------------------------------------------------------- //
 	float m_f_a0_left;
 	float m_f_a1_left;
@@ -104,6 +119,44 @@ public:
 	float m_f_z1_right;
 	float m_fVolume;
 
+	// --- linear phase mode
+	CLinearPhaseHPF m_LinearPhaseHPF;
+	UINT m_uLinearPhaseDesign;	// design count the curve was last invalidated at
+	void updateLatency();
+	UINT calculateLatency(UINT uFilterMode, UINT uTruePeakLimit);
+
+	// --- dynamic mode; detects on the sidechain when it is connected
+	CDynamicHPF m_DynamicHPF;
+	float* m_pSidechainFrameBuffer;
+	bool m_bSidechainEnabled;
+	UINT m_uSidechainChannelCount;
+
+	// --- crossover mode: LR4 split at the cutoff, low band attenuated instead of cut
+	CLinkwitzRileyCrossover m_Crossover;
+	void updateCrossover();
+
+	// --- true peak ceiling after the volume stage, every mode
+	CTruePeakLimiter m_TruePeakLimiter;
+
+	// --- R128 loudness of the final output, published on the LUFS meters
+	CLoudnessMeter m_LoudnessMeter;
+
+	// --- ceiling and metering; the last thing every mode does
+	void processOutputStage(float* pOutputBuffer, UINT uNumOutputChannels);
+
+	// --- spectrum of the input, so the view shows the rumble the filter removes
+	CSpectrumAnalyzer m_SpectrumAnalyzer;
+
+	// --- phase problems in the rumble show up as negative correlation at the
+	//     input; the output shows what the filter left of them
+	CStereoAnalyzer m_InputStereo;
+	CStereoAnalyzer m_OutputStereo;
+
+	// --- curve of the current mode's filter; invalidated by every control that
+	//     changes it and, in dynamic mode, by the audio thread when the cutoff moves
+	CResponseCurve m_ResponseCurve;
+	float m_fResponseAmount;	// dynamic cutoff position the curve was last invalidated at
+
 	// END OF USER CODE -------------------------------------------------------------- //
 
 
@@ -112,6 +165,18 @@ public:
 
 	float m_fSlider_a1;
 	float m_fVolume_dB;
+	float m_fCutoff_Hz;
+	UINT m_uFilterMode;
+	enum{IIR,LINEAR_PHASE,DYNAMIC,CROSSOVER};
+	float m_fDynMaxCutoff_Hz;
+	float m_fDynThreshold_dB;
+	float m_fLowBandGain_dB;
+	UINT m_uTruePeakLimit;
+	enum{SWITCH_OFF,SWITCH_ON};
+	float m_fTruePeakCeiling_dB;
+	float m_fMomentaryLoudness;
+	float m_fShortTermLoudness;
+	float m_fIntegratedLoudness;
 
 	// **--0x1A7F--**
 	// ------------------------------------------------------------------------------- //
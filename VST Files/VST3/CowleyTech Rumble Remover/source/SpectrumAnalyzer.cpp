@@ -0,0 +1,263 @@
+#include "SpectrumAnalyzer.h"
+#include <chrono>
+
+// --- SSE window and power loops where the target has it; plain loops otherwise
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAFX_ANALYZER_SSE 1
+#include <xmmintrin.h>
+#endif
+
+static const UINT SPECTRUM_FRESH = 4;	// set in m_uMiddle when it holds an unread spectrum
+
+// --- the display points are the same for every instance, so they are worked out once
+struct spectrumFrequencies
+{
+	float fHz[SPECTRUM_POINTS];
+
+	spectrumFrequencies()
+	{
+		for(UINT i = 0; i < SPECTRUM_POINTS; i++)
+			fHz[i] = SPECTRUM_MIN_HZ*pow(SPECTRUM_MAX_HZ/SPECTRUM_MIN_HZ, (double)i/(double)(SPECTRUM_POINTS - 1));
+	}
+};
+
+CSpectrumAnalyzer::CSpectrumAnalyzer(void)
+{
+	// --- the ring is cleared by start(), so an instance no view ever opens
+	//     never touches its 128 KB
+	m_uWriteIndex.store(0);
+	m_uSampleRate.store(44100);
+	m_bRunning.store(false);
+
+	m_nViewers = 0;
+	m_uAnalysisRate = 0;
+	m_uLastWrite = 0;
+	m_fBandScale = 1.0;
+	m_fBinScale = 1.0;
+	m_fReleaseCoeff = exp(-(double)SPECTRUM_UPDATE_MSEC/SPECTRUM_RELEASE_MSEC);
+
+	// --- the bin ranges wait for setupAnalysis(), which the first analyze() runs
+	static const spectrumFrequencies frequencies;
+	memcpy(m_fFrequencies, frequencies.fHz, sizeof(m_fFrequencies));
+	for(UINT i = 0; i < SPECTRUM_POINTS; i++)
+		m_fSmoothed[i] = SPECTRUM_FLOOR_DB;
+
+	for(UINT b = 0; b < 3; b++)
+		for(UINT i = 0; i < SPECTRUM_POINTS; i++)
+			m_fSnapshots[b][i] = SPECTRUM_FLOOR_DB;
+
+	m_uMiddle.store(1);
+	m_uBack = 0;
+	m_uFront = 2;
+}
+
+CSpectrumAnalyzer::~CSpectrumAnalyzer(void)
+{
+	// --- a view that outlived its plug-in never stops it
+	m_bRunning.store(false);
+	if(m_Worker.joinable())
+		m_Worker.join();
+}
+
+void CSpectrumAnalyzer::setSampleRate(float fSampleRate)
+{
+	m_uSampleRate.store((UINT)fSampleRate, std::memory_order_relaxed);
+}
+
+void CSpectrumAnalyzer::processBlock(float** ppInput, UINT uChannels, UINT uFrames)
+{
+	if(!m_bRunning.load(std::memory_order_relaxed))
+		return;
+
+	UINT uWrite = m_uWriteIndex.load(std::memory_order_relaxed);
+	for(UINT i = 0; i < uFrames; i++)
+	{
+		float fMono = uChannels == 2 ? 0.5f*(ppInput[0][i] + ppInput[1][i]) : ppInput[0][i];
+		m_fRing[(uWrite + i) & (SPECTRUM_RING_SIZE - 1)] = fMono;
+	}
+	m_uWriteIndex.store(uWrite + uFrames, std::memory_order_release);
+}
+
+void CSpectrumAnalyzer::start()
+{
+	if(m_nViewers++ > 0)
+		return;
+
+	// --- stale history would show up as one old spectrum; the audio thread
+	//     does not write while the analyzer is stopped
+	memset(m_fRing, 0, sizeof(m_fRing));
+	m_uLastWrite = m_uWriteIndex.load();
+	for(UINT i = 0; i < SPECTRUM_POINTS; i++)
+		m_fSmoothed[i] = SPECTRUM_FLOOR_DB;
+
+	m_bRunning.store(true);
+	m_Worker = std::thread(&CSpectrumAnalyzer::run, this);
+}
+
+void CSpectrumAnalyzer::stop()
+{
+	if(m_nViewers == 0 || --m_nViewers > 0)
+		return;
+
+	m_bRunning.store(false);
+	if(m_Worker.joinable())
+		m_Worker.join();
+}
+
+void CSpectrumAnalyzer::run()
+{
+	while(m_bRunning.load())
+	{
+		analyze();
+		std::this_thread::sleep_for(std::chrono::milliseconds(SPECTRUM_UPDATE_MSEC));
+	}
+}
+
+// --- FFT size, window, scales and the bin ranges of the display points
+void CSpectrumAnalyzer::setupAnalysis(UINT uSampleRate)
+{
+	m_uAnalysisRate = uSampleRate;
+
+	UINT uSize = uSampleRate > 50000 ? SPECTRUM_MAX_FFT_SIZE : SPECTRUM_MAX_FFT_SIZE/2;
+	m_FFT.init(uSize);
+
+	for(UINT n = 0; n < uSize; n++)
+		m_fWindow[n] = 0.5 - 0.5*cos(2.0*pi*(double)n/(double)uSize);
+
+	// --- a sine of amplitude 1 peaks at N/4 with the Hann window; the energy
+	//     in its main lobe is 3N^2/32 (one side)
+	double dSize = (double)uSize;
+	m_fBinScale = 16.0/(dSize*dSize);
+	m_fBandScale = 32.0/(3.0*dSize*dSize);
+
+	double dBinWidth = (double)uSampleRate/dSize;
+	double dHalfBand = pow(2.0, 0.5*SPECTRUM_SMOOTHING_OCT);
+	UINT uLastBin = uSize/2;
+
+	for(UINT i = 0; i < SPECTRUM_POINTS; i++)
+	{
+		double dFreq = m_fFrequencies[i];
+		double dLo = dFreq/dHalfBand/dBinWidth;
+		double dHi = dFreq*dHalfBand/dBinWidth;
+
+		m_uBinLo[i] = 0;
+		m_uBinHi[i] = 0;
+		m_fBinPosition[i] = -1.0;
+
+		if(dFreq >= 0.5*uSampleRate)
+			continue;
+
+		if(dHi - dLo >= 1.0)
+		{
+			UINT uLo = (UINT)ceil(dLo);
+			UINT uHi = (UINT)floor(dHi) + 1;
+			if(uHi > uLastBin + 1) uHi = uLastBin + 1;
+			if(uHi <= uLo) uHi = uLo + 1;
+
+			m_uBinLo[i] = uLo;
+			m_uBinHi[i] = uHi;
+		}
+		else if(dFreq/dBinWidth + 1.0 <= uLastBin)
+			m_fBinPosition[i] = dFreq/dBinWidth;
+	}
+}
+
+// --- returns true if there was new audio and a new spectrum was published
+bool CSpectrumAnalyzer::analyze()
+{
+	UINT uSampleRate = m_uSampleRate.load(std::memory_order_relaxed);
+	if(uSampleRate != m_uAnalysisRate)
+		setupAnalysis(uSampleRate);
+
+	// --- nothing new, e.g. transport stopped: leave the display as it is
+	UINT uWrite = m_uWriteIndex.load(std::memory_order_acquire);
+	if(uWrite == m_uLastWrite)
+		return false;
+	m_uLastWrite = uWrite;
+
+	// --- copy the newest N samples out in (at most) two pieces
+	UINT uSize = m_FFT.getSize();
+	UINT uStart = (uWrite - uSize) & (SPECTRUM_RING_SIZE - 1);
+	UINT uFirst = SPECTRUM_RING_SIZE - uStart;
+	if(uFirst > uSize) uFirst = uSize;
+
+	memcpy(&m_fFrame[0], &m_fRing[uStart], uFirst*sizeof(float));
+	memcpy(&m_fFrame[uFirst], &m_fRing[0], (uSize - uFirst)*sizeof(float));
+
+	// --- the writer lapped the window while it was copied: skip this one
+	if(m_uWriteIndex.load(std::memory_order_acquire) - uWrite > SPECTRUM_RING_SIZE - uSize)
+		return false;
+
+#if RAFX_ANALYZER_SSE
+	for(UINT n = 0; n < uSize; n += 4)
+		_mm_storeu_ps(&m_fFrame[n], _mm_mul_ps(_mm_loadu_ps(&m_fFrame[n]), _mm_loadu_ps(&m_fWindow[n])));
+#else
+	for(UINT n = 0; n < uSize; n++)
+		m_fFrame[n] *= m_fWindow[n];
+#endif
+
+	m_FFT.forward(&m_fFrame[0], &m_fRe[0], &m_fIm[0]);
+
+	// --- power into m_fRe, then the running sum for the band energies
+	UINT uBins = uSize/2 + 1;
+	UINT k = 0;
+#if RAFX_ANALYZER_SSE
+	for(; k + 4 <= uBins; k += 4)
+	{
+		__m128 re = _mm_loadu_ps(&m_fRe[k]);
+		__m128 im = _mm_loadu_ps(&m_fIm[k]);
+		_mm_storeu_ps(&m_fRe[k], _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im)));
+	}
+#endif
+	for(; k < uBins; k++)
+		m_fRe[k] = m_fRe[k]*m_fRe[k] + m_fIm[k]*m_fIm[k];
+
+	m_dPowerSum[0] = 0.0;
+	for(k = 0; k < uBins; k++)
+		m_dPowerSum[k + 1] = m_dPowerSum[k] + m_fRe[k];
+
+	for(UINT i = 0; i < SPECTRUM_POINTS; i++)
+	{
+		double dPower = 0.0;
+		if(m_uBinHi[i] > m_uBinLo[i])
+			dPower = (m_dPowerSum[m_uBinHi[i]] - m_dPowerSum[m_uBinLo[i]])*m_fBandScale;
+		else if(m_fBinPosition[i] >= 0.0)
+		{
+			UINT uBin = (UINT)m_fBinPosition[i];
+			double dFrac = m_fBinPosition[i] - uBin;
+			dPower = (m_fRe[uBin] + dFrac*(m_fRe[uBin + 1] - m_fRe[uBin]))*m_fBinScale;
+		}
+
+		float fdB = dPower > 1e-12 ? 10.0*log10(dPower) : SPECTRUM_FLOOR_DB;
+		if(fdB < SPECTRUM_FLOOR_DB)
+			fdB = SPECTRUM_FLOOR_DB;
+
+		// --- instant attack, exponential release
+		if(fdB > m_fSmoothed[i])
+			m_fSmoothed[i] = fdB;
+		else
+			m_fSmoothed[i] = fdB + m_fReleaseCoeff*(m_fSmoothed[i] - fdB);
+	}
+
+	publish();
+	return true;
+}
+
+// --- worker: fill the back buffer and swap it with the middle one
+void CSpectrumAnalyzer::publish()
+{
+	memcpy(&m_fSnapshots[m_uBack][0], &m_fSmoothed[0], SPECTRUM_POINTS*sizeof(float));
+	UINT uOld = m_uMiddle.exchange(m_uBack | SPECTRUM_FRESH, std::memory_order_acq_rel);
+	m_uBack = uOld & (SPECTRUM_FRESH - 1);
+}
+
+// --- GUI: take the middle buffer if the worker left a fresh one there
+bool CSpectrumAnalyzer::update()
+{
+	if(!(m_uMiddle.load(std::memory_order_relaxed) & SPECTRUM_FRESH))
+		return false;
+
+	UINT uOld = m_uMiddle.exchange(m_uFront, std::memory_order_acq_rel);
+	m_uFront = uOld & (SPECTRUM_FRESH - 1);
+	return true;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "FFTConvolver.h"
+#include <atomic>
+#include <thread>
+
+// --- spectrum analyzer for the editor
+//
+//     The audio thread only writes the mono sum of its input into a ring: one
+//     store and one index update per frame, and nothing at all while no view
+//     has the analyzer running.
+//
+//     A worker thread wakes every SPECTRUM_UPDATE_MSEC, copies the newest
+//     FFT-size window out of the ring (and drops it if the writer lapped it
+//     during the copy), applies a Hann window and runs the SSE real FFT. The
+//     power spectrum is summed over SPECTRUM_SMOOTHING_OCT around each of
+//     SPECTRUM_POINTS log-spaced frequencies (interpolated between bins where
+//     that band is narrower than a bin, at the low end), scaled so a full
+//     scale sine reads 0 dB, converted to dB with a release ballistic and
+//     published through a triple buffer; neither side waits.
+const UINT SPECTRUM_RING_SIZE = 32768;		// power of 2, >= 2x the largest FFT
+const UINT SPECTRUM_MAX_FFT_SIZE = 16384;	// above 50kHz; 8192 below
+const UINT SPECTRUM_POINTS = 256;
+const float SPECTRUM_MIN_HZ = 10.0;
+const float SPECTRUM_MAX_HZ = 20000.0;
+const float SPECTRUM_SMOOTHING_OCT = 1.0/6.0;
+const float SPECTRUM_FLOOR_DB = -120.0;
+const float SPECTRUM_RELEASE_MSEC = 300.0;
+const UINT SPECTRUM_UPDATE_MSEC = 30;
+
+class CSpectrumAnalyzer
+{
+public:
+	CSpectrumAnalyzer(void);
+	~CSpectrumAnalyzer(void);
+
+	// --- from prepareForPlay(); the worker picks it up at its next update
+	void setSampleRate(float fSampleRate);
+
+	// --- audio thread; uChannels 1 or 2, summed to mono
+	inline void processFrame(const float* pInput, UINT uChannels)
+	{
+		if(!m_bRunning.load(std::memory_order_relaxed))
+			return;
+
+		float fMono = uChannels == 2 ? 0.5f*(pInput[0] + pInput[1]) : pInput[0];
+
+		UINT uWrite = m_uWriteIndex.load(std::memory_order_relaxed);
+		m_fRing[uWrite & (SPECTRUM_RING_SIZE - 1)] = fMono;
+		m_uWriteIndex.store(uWrite + 1, std::memory_order_release);
+	}
+
+	// --- audio thread; non-interleaved buffers
+	void processBlock(float** ppInput, UINT uChannels, UINT uFrames);
+
+	// --- GUI thread; each view that shows the analyzer starts it once and
+	//     stops it once, the worker runs while any view is open
+	void start();
+	void stop();
+
+	// --- GUI thread; true if a new spectrum was published since the last call.
+	//     getSpectrum() stays valid until the next call to update()
+	bool update();
+	const float* getSpectrum(){return &m_fSnapshots[m_uFront][0];}		// dB, SPECTRUM_POINTS
+	const float* getFrequencies(){return &m_fFrequencies[0];}			// Hz, SPECTRUM_POINTS
+
+	// --- worker; also callable directly, e.g. from a test without the thread;
+	//     true if there was new audio and a new spectrum was published
+	bool analyze();
+
+protected:
+	void run();
+	void setupAnalysis(UINT uSampleRate);
+	void publish();
+
+	// --- audio -> worker
+	float m_fRing[SPECTRUM_RING_SIZE];
+	std::atomic<UINT> m_uWriteIndex;
+	std::atomic<UINT> m_uSampleRate;
+	std::atomic<bool> m_bRunning;
+
+	// --- worker
+	std::thread m_Worker;
+	int m_nViewers;				// GUI thread only
+	CRealFFT m_FFT;
+	UINT m_uAnalysisRate;		// what the tables below were made for
+	UINT m_uLastWrite;
+	float m_fWindow[SPECTRUM_MAX_FFT_SIZE];
+	float m_fFrame[SPECTRUM_MAX_FFT_SIZE];
+	float m_fRe[SPECTRUM_MAX_FFT_SIZE/2 + 1];
+	float m_fIm[SPECTRUM_MAX_FFT_SIZE/2 + 1];
+	double m_dPowerSum[SPECTRUM_MAX_FFT_SIZE/2 + 2];	// running sum, [k] = bins 0..k-1
+	float m_fBandScale;			// full scale sine -> 1.0 summed over its band
+	float m_fBinScale;			// full scale sine -> 1.0 in its bin
+
+	// --- per display point: bin range [lo, hi) or, for a band under one bin
+	//     wide, lo = hi and the interpolation position; position < 0 is above
+	//     Nyquist
+	UINT m_uBinLo[SPECTRUM_POINTS];
+	UINT m_uBinHi[SPECTRUM_POINTS];
+	float m_fBinPosition[SPECTRUM_POINTS];
+	float m_fFrequencies[SPECTRUM_POINTS];
+	float m_fSmoothed[SPECTRUM_POINTS];
+	float m_fReleaseCoeff;
+
+	// --- triple buffer; m_uMiddle holds an index plus a "fresh" bit
+	float m_fSnapshots[3][SPECTRUM_POINTS];
+	std::atomic<UINT> m_uMiddle;
+	UINT m_uBack;				// worker
+	UINT m_uFront;				// GUI
+};
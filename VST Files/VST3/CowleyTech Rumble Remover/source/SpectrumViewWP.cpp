@@ -0,0 +1,159 @@
+#include "SpectrumViewWP.h"
+#include "vstgui/lib/cdrawcontext.h"
+
+namespace VSTGUI {
+
+CSpectrumViewWP::CSpectrumViewWP(const CRect& size, CSpectrumAnalyzer* pAnalyzer, CResponseCurve* pResponseCurve)
+: CView(size)
+{
+	m_pAnalyzer = pAnalyzer;
+	m_pResponseCurve = pResponseCurve;
+	m_pTimer = NULL;
+
+	m_BackColor = CColor(20, 20, 24, 255);
+	m_GridColor = CColor(70, 70, 80, 255);
+	m_SpectrumColor = CColor(90, 200, 255, 255);
+	m_ResponseColor = CColor(255, 170, 40, 255);
+}
+
+CSpectrumViewWP::~CSpectrumViewWP(void)
+{
+	// --- removed() normally did this
+	if(m_pTimer)
+	{
+		m_pTimer->stop();
+		m_pTimer->forget();
+		m_pTimer = NULL;
+		m_pAnalyzer->stop();
+	}
+}
+
+bool CSpectrumViewWP::attached(CView* parent)
+{
+	if(!CView::attached(parent))
+		return false;
+
+	if(!m_pTimer)
+	{
+		m_pAnalyzer->start();
+		m_pTimer = new CVSTGUITimer(this, SPECTRUM_UPDATE_MSEC);
+		m_pTimer->start();
+	}
+
+	updateResponse();
+	return true;
+}
+
+bool CSpectrumViewWP::removed(CView* parent)
+{
+	if(m_pTimer)
+	{
+		m_pTimer->stop();
+		m_pTimer->forget();
+		m_pTimer = NULL;
+		m_pAnalyzer->stop();
+	}
+
+	return CView::removed(parent);
+}
+
+CMessageResult CSpectrumViewWP::notify(CBaseObject* sender, IdStringPtr message)
+{
+	if(message == CVSTGUITimer::kMsgTimer)
+	{
+		bool bNewSpectrum = m_pAnalyzer->update();
+		bool bNewResponse = updateResponse();
+
+		if(bNewSpectrum || bNewResponse)
+			invalid();
+
+		return kMessageNotified;
+	}
+
+	return CView::notify(sender, message);
+}
+
+// --- the same snapshot comes back until the plugin invalidates the curve
+bool CSpectrumViewWP::updateResponse()
+{
+	if(!m_pResponseCurve)
+		return false;
+
+	responseSnapshotPtr pResponse = m_pResponseCurve->getSnapshot();
+	if(pResponse == m_pResponse)
+		return false;
+
+	m_pResponse = pResponse;
+	return true;
+}
+
+CCoord CSpectrumViewWP::frequencyToX(float fFrequency_Hz)
+{
+	const CRect& rect = getViewSize();
+
+	float fNorm = log(fFrequency_Hz/SPECTRUM_MIN_HZ)/log(SPECTRUM_MAX_HZ/SPECTRUM_MIN_HZ);
+	if(fNorm < 0.0) fNorm = 0.0;
+	if(fNorm > 1.0) fNorm = 1.0;
+
+	return rect.left + fNorm*rect.getWidth();
+}
+
+CCoord CSpectrumViewWP::dBToY(float fdB)
+{
+	const CRect& rect = getViewSize();
+
+	float fNorm = (SPECTRUM_VIEW_MAX_DB - fdB)/(SPECTRUM_VIEW_MAX_DB - SPECTRUM_VIEW_MIN_DB);
+	if(fNorm < 0.0) fNorm = 0.0;
+	if(fNorm > 1.0) fNorm = 1.0;
+
+	return rect.top + fNorm*rect.getHeight();
+}
+
+void CSpectrumViewWP::drawCurve(CDrawContext* pContext, const float* pFrequencies_Hz, const float* pdB, UINT uCount, const CColor& color)
+{
+	pContext->setFrameColor(color);
+	pContext->moveTo(CPoint(frequencyToX(pFrequencies_Hz[0]), dBToY(pdB[0])));
+	for(UINT i = 1; i < uCount; i++)
+		pContext->lineTo(CPoint(frequencyToX(pFrequencies_Hz[i]), dBToY(pdB[i])));
+}
+
+void CSpectrumViewWP::draw(CDrawContext* pContext)
+{
+	const CRect& rect = getViewSize();
+
+	pContext->setDrawMode(kAliasing);
+	pContext->setLineStyle(kLineSolid);
+	pContext->setLineWidth(1);
+	pContext->setFillColor(m_BackColor);
+	pContext->drawRect(rect, kDrawFilled);
+
+	// --- grid: 20/50/100... Hz and every 12 dB
+	static const float fGridHz[] = {20, 50, 100, 200, 500, 1000, 2000, 5000, 10000};
+
+	pContext->setFrameColor(m_GridColor);
+	for(UINT i = 0; i < sizeof(fGridHz)/sizeof(float); i++)
+	{
+		CCoord x = frequencyToX(fGridHz[i]);
+		pContext->moveTo(CPoint(x, rect.top));
+		pContext->lineTo(CPoint(x, rect.bottom));
+	}
+	for(float fdB = 0.0; fdB > SPECTRUM_VIEW_MIN_DB; fdB -= 12.0)
+	{
+		CCoord y = dBToY(fdB);
+		pContext->moveTo(CPoint(rect.left, y));
+		pContext->lineTo(CPoint(rect.right, y));
+	}
+
+	pContext->setDrawMode(kAntiAliasing);
+	drawCurve(pContext, m_pAnalyzer->getFrequencies(), m_pAnalyzer->getSpectrum(), SPECTRUM_POINTS, m_SpectrumColor);
+
+	if(m_pResponse)
+	{
+		pContext->setLineWidth(2);
+		drawCurve(pContext, m_pResponse->getFrequencies(), m_pResponse->getMagnitude_dB(), m_pResponse->getCount(), m_ResponseColor);
+	}
+
+	setDirty(false);
+}
+
+}
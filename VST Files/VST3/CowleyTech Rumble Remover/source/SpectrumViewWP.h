@@ -0,0 +1,57 @@
+#pragma once
+#include "vstgui/lib/cview.h"
+#include "vstgui/lib/cvstguitimer.h"
+#include "SpectrumAnalyzer.h"
+#include "ResponseCurve.h"
+
+namespace VSTGUI {
+
+// --- "SpectrumView": the plugin's analyzer spectrum with the magnitude response
+//     of its filter drawn over it; log frequency across (SPECTRUM_MIN_HZ to
+//     SPECTRUM_MAX_HZ), one dB scale up for both curves. The response comes from
+//     the plugin's CResponseCurve, which only recomputes when the filter changed
+const float SPECTRUM_VIEW_MAX_DB = 12.0;
+const float SPECTRUM_VIEW_MIN_DB = -96.0;
+
+class CSpectrumViewWP : public CView
+{
+public:
+	CSpectrumViewWP(const CRect& size, CSpectrumAnalyzer* pAnalyzer, CResponseCurve* pResponseCurve);
+	~CSpectrumViewWP(void);
+
+	void setBackColor(const CColor& color){m_BackColor = color;}
+	void setGridColor(const CColor& color){m_GridColor = color;}
+	void setSpectrumColor(const CColor& color){m_SpectrumColor = color;}
+	void setResponseColor(const CColor& color){m_ResponseColor = color;}
+
+	// --- overrides
+	virtual void draw(CDrawContext* pContext) VSTGUI_OVERRIDE_VMETHOD;
+
+	// --- the analyzer and the timer only run while the view is on screen
+	virtual bool attached(CView* parent) VSTGUI_OVERRIDE_VMETHOD;
+	virtual bool removed(CView* parent) VSTGUI_OVERRIDE_VMETHOD;
+	virtual CMessageResult notify(CBaseObject* sender, IdStringPtr message) VSTGUI_OVERRIDE_VMETHOD;
+
+protected:
+	// --- true if the curve changed
+	bool updateResponse();
+
+	// --- Hz -> x and dB -> y, clipped to the view
+	CCoord frequencyToX(float fFrequency_Hz);
+	CCoord dBToY(float fdB);
+
+	void drawCurve(CDrawContext* pContext, const float* pFrequencies_Hz, const float* pdB, UINT uCount, const CColor& color);
+
+	CSpectrumAnalyzer* m_pAnalyzer;
+	CResponseCurve* m_pResponseCurve;	// NULL: no overlay
+	CVSTGUITimer* m_pTimer;
+
+	// --- the snapshot last drawn; NULL if there is none
+	responseSnapshotPtr m_pResponse;
+
+	CColor m_BackColor;
+	CColor m_GridColor;
+	CColor m_SpectrumColor;
+	CColor m_ResponseColor;
+};
+}
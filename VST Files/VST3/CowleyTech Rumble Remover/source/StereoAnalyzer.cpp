@@ -0,0 +1,209 @@
+#include "StereoAnalyzer.h"
+#include <stddef.h>
+
+// --- SSE sums where the target has it; plain loops otherwise
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAFX_STEREO_SSE 1
+#include <xmmintrin.h>
+#endif
+
+static const UINT STEREO_FRESH = 4;		// set in m_uMiddle when it holds an unread snapshot
+
+// --- product of the two mean squares below which there is no correlation to show (-100 dB)
+static const float STEREO_SILENCE = 1e-10f;
+
+CStereoAnalyzer::CStereoAnalyzer(void)
+{
+	m_bRunning.store(false);
+	m_uStartCount.store(0);
+	m_nViewers = 0;
+
+	// --- points past uPointCount are never read, so only the headers need clearing
+	for(UINT i = 0; i < 3; i++)
+		memset(&m_Snapshots[i], 0, offsetof(stereoSnapshot, fSide));
+	m_uMiddle.store(1);
+	m_uBack = 0;
+	m_uFront = 2;
+
+	setSampleRate(44100.0);
+	reset();
+}
+
+void CStereoAnalyzer::setSampleRate(float fSampleRate)
+{
+	double dBlockMsec = 1000.0*STEREO_BLOCK_SIZE/fSampleRate;
+	m_fAverageCoeff = 1.0 - exp(-dBlockMsec/STEREO_INTEGRATION_MSEC);
+
+	m_uBlocksPerUpdate = (UINT)(STEREO_UPDATE_MSEC/dBlockMsec + 0.5);
+	if(m_uBlocksPerUpdate < 1)
+		m_uBlocksPerUpdate = 1;
+
+	// --- as many points as fit, spread over the whole update
+	UINT uFrames = m_uBlocksPerUpdate*STEREO_BLOCK_SIZE;
+	m_uDecimation = (uFrames + STEREO_MAX_POINTS - 1)/STEREO_MAX_POINTS;
+
+	m_uBlockCount = 0;
+	m_uPointPhase = 0;
+}
+
+// --- audio thread: a view (re)started the analyzer, forget what came before
+void CStereoAnalyzer::reset()
+{
+	m_uResetCount = m_uStartCount.load(std::memory_order_relaxed);
+	m_uBlockFrames = 0;
+	m_fMeanLL = 0.0;
+	m_fMeanRR = 0.0;
+	m_fMeanLR = 0.0;
+	m_uBlockCount = 0;
+	m_uPointPhase = 0;
+	m_Snapshots[m_uBack].uPointCount = 0;
+}
+
+void CStereoAnalyzer::processBlock(const float* pLeft, const float* pRight, UINT uFrames)
+{
+	if(!m_bRunning.load(std::memory_order_relaxed))
+		return;
+
+	if(!pRight)
+		pRight = pLeft;
+
+	// --- top up a partly staged block first
+	UINT i = 0;
+	if(m_uBlockFrames > 0)
+	{
+		for(; i < uFrames && m_uBlockFrames < STEREO_BLOCK_SIZE; i++, m_uBlockFrames++)
+		{
+			m_fBlockL[m_uBlockFrames] = pLeft[i];
+			m_fBlockR[m_uBlockFrames] = pRight[i];
+		}
+		if(m_uBlockFrames < STEREO_BLOCK_SIZE)
+			return;
+
+		processKernel(&m_fBlockL[0], &m_fBlockR[0]);
+		m_uBlockFrames = 0;
+	}
+
+	for(; i + STEREO_BLOCK_SIZE <= uFrames; i += STEREO_BLOCK_SIZE)
+		processKernel(&pLeft[i], &pRight[i]);
+
+	for(; i < uFrames; i++, m_uBlockFrames++)
+	{
+		m_fBlockL[m_uBlockFrames] = pLeft[i];
+		m_fBlockR[m_uBlockFrames] = pRight[i];
+	}
+}
+
+void CStereoAnalyzer::processKernel(const float* pLeft, const float* pRight)
+{
+	if(m_uStartCount.load(std::memory_order_relaxed) != m_uResetCount)
+		reset();
+
+	// --- the three sums everything else is derived from
+#if RAFX_STEREO_SSE
+	__m128 ll = _mm_setzero_ps();
+	__m128 rr = _mm_setzero_ps();
+	__m128 lr = _mm_setzero_ps();
+	for(UINT i = 0; i < STEREO_BLOCK_SIZE; i += 4)
+	{
+		__m128 l = _mm_loadu_ps(&pLeft[i]);
+		__m128 r = _mm_loadu_ps(&pRight[i]);
+		ll = _mm_add_ps(ll, _mm_mul_ps(l, l));
+		rr = _mm_add_ps(rr, _mm_mul_ps(r, r));
+		lr = _mm_add_ps(lr, _mm_mul_ps(l, r));
+	}
+
+	float fSums[3][4];
+	_mm_storeu_ps(fSums[0], ll);
+	_mm_storeu_ps(fSums[1], rr);
+	_mm_storeu_ps(fSums[2], lr);
+	float fLL = (fSums[0][0] + fSums[0][1]) + (fSums[0][2] + fSums[0][3]);
+	float fRR = (fSums[1][0] + fSums[1][1]) + (fSums[1][2] + fSums[1][3]);
+	float fLR = (fSums[2][0] + fSums[2][1]) + (fSums[2][2] + fSums[2][3]);
+#else
+	float fLL = 0.0, fRR = 0.0, fLR = 0.0;
+	for(UINT i = 0; i < STEREO_BLOCK_SIZE; i++)
+	{
+		fLL += pLeft[i]*pLeft[i];
+		fRR += pRight[i]*pRight[i];
+		fLR += pLeft[i]*pRight[i];
+	}
+#endif
+
+	const float fScale = 1.0f/STEREO_BLOCK_SIZE;
+	m_fMeanLL += m_fAverageCoeff*(fLL*fScale - m_fMeanLL);
+	m_fMeanRR += m_fAverageCoeff*(fRR*fScale - m_fMeanRR);
+	m_fMeanLR += m_fAverageCoeff*(fLR*fScale - m_fMeanLR);
+
+	// --- goniometer points go straight into the snapshot being filled
+	stereoSnapshot& snapshot = m_Snapshots[m_uBack];
+	UINT i = m_uPointPhase;
+	for(; i < STEREO_BLOCK_SIZE && snapshot.uPointCount < STEREO_MAX_POINTS; i += m_uDecimation)
+	{
+		snapshot.fSide[snapshot.uPointCount] = 0.5f*(pLeft[i] - pRight[i]);
+		snapshot.fMid[snapshot.uPointCount] = 0.5f*(pLeft[i] + pRight[i]);
+		snapshot.uPointCount++;
+	}
+	m_uPointPhase = i < STEREO_BLOCK_SIZE ? 0 : i - STEREO_BLOCK_SIZE;
+
+	if(++m_uBlockCount >= m_uBlocksPerUpdate)
+	{
+		m_uBlockCount = 0;
+		m_uPointPhase = 0;
+		publish();
+	}
+}
+
+// --- audio thread: finish the back snapshot and swap it with the middle one
+void CStereoAnalyzer::publish()
+{
+	stereoSnapshot& snapshot = m_Snapshots[m_uBack];
+
+	// --- mid and side power from the same three averages; rounding can take
+	//     one of them a hair under zero
+	float fMid = 0.25f*(m_fMeanLL + m_fMeanRR + 2.0f*m_fMeanLR);
+	float fSide = 0.25f*(m_fMeanLL + m_fMeanRR - 2.0f*m_fMeanLR);
+
+	snapshot.fLeftRMS = sqrt(m_fMeanLL);
+	snapshot.fRightRMS = sqrt(m_fMeanRR);
+	snapshot.fMidRMS = fMid > 0.0 ? sqrt(fMid) : 0.0;
+	snapshot.fSideRMS = fSide > 0.0 ? sqrt(fSide) : 0.0;
+
+	float fPower = m_fMeanLL*m_fMeanRR;
+	float fCorrelation = fPower > STEREO_SILENCE ? m_fMeanLR/sqrt(fPower) : 0.0;
+	if(fCorrelation > 1.0) fCorrelation = 1.0;
+	if(fCorrelation < -1.0) fCorrelation = -1.0;
+	snapshot.fCorrelation = fCorrelation;
+
+	UINT uOld = m_uMiddle.exchange(m_uBack | STEREO_FRESH, std::memory_order_acq_rel);
+	m_uBack = uOld & (STEREO_FRESH - 1);
+	m_Snapshots[m_uBack].uPointCount = 0;
+}
+
+void CStereoAnalyzer::start()
+{
+	if(m_nViewers++ > 0)
+		return;
+
+	// --- the audio thread sees the new count and resets itself
+	m_uStartCount.fetch_add(1);
+	m_bRunning.store(true);
+}
+
+void CStereoAnalyzer::stop()
+{
+	if(m_nViewers == 0 || --m_nViewers > 0)
+		return;
+
+	m_bRunning.store(false);
+}
+
+// --- GUI: take the middle buffer if the audio thread left a fresh one there
+bool CStereoAnalyzer::update()
+{
+	if(!(m_uMiddle.load(std::memory_order_relaxed) & STEREO_FRESH))
+		return false;
+
+	UINT uOld = m_uMiddle.exchange(m_uFront, std::memory_order_acq_rel);
+	m_uFront = uOld & (STEREO_FRESH - 1);
+	return true;
+}
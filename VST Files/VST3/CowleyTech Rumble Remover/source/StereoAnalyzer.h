@@ -0,0 +1,105 @@
+#pragma once
+
+#include "pluginconstants.h"
+#include <atomic>
+
+// --- stereo image analyzer for the editor: correlation, L/R and mid/side RMS
+//     and a goniometer point cloud
+//
+//     Everything is computed on the audio thread. Frames are staged into
+//     STEREO_BLOCK_SIZE blocks and each block runs one kernel: SSE sums of L*L,
+//     R*R and L*R (mid and side power follow from those three), a one-pole
+//     average of each over STEREO_INTEGRATION_MSEC, and every Nth frame written
+//     as a (side, mid) point straight into the snapshot being filled. Every
+//     STEREO_UPDATE_MSEC the statistics are finished into that snapshot and it is
+//     published through a triple buffer; the GUI only ever reads snapshots and
+//     neither side waits.
+//
+//     Nothing runs while no view has the analyzer started.
+const UINT STEREO_BLOCK_SIZE = 64;			// multiple of 4
+const UINT STEREO_MAX_POINTS = 512;			// goniometer points per snapshot
+const float STEREO_INTEGRATION_MSEC = 300.0;
+const UINT STEREO_UPDATE_MSEC = 30;
+
+// --- one published update; mid = (L + R)/2, side = (L - R)/2, so a mono
+//     signal has no side and mid RMS equals the channel RMS
+typedef struct
+{
+	float fCorrelation;			// -1 (out of phase) to +1 (mono); 0 for silence
+	float fLeftRMS;
+	float fRightRMS;
+	float fMidRMS;
+	float fSideRMS;
+	UINT uPointCount;
+	float fSide[STEREO_MAX_POINTS];
+	float fMid[STEREO_MAX_POINTS];
+} stereoSnapshot;
+
+class CStereoAnalyzer
+{
+public:
+	CStereoAnalyzer(void);
+
+	// --- from prepareForPlay(); audio thread state only
+	void setSampleRate(float fSampleRate);
+
+	// --- audio thread; uChannels 1 or 2, mono is analyzed as L = R
+	inline void processFrame(const float* pInput, UINT uChannels)
+	{
+		if(!m_bRunning.load(std::memory_order_relaxed))
+			return;
+
+		m_fBlockL[m_uBlockFrames] = pInput[0];
+		m_fBlockR[m_uBlockFrames] = uChannels == 2 ? pInput[1] : pInput[0];
+
+		if(++m_uBlockFrames == STEREO_BLOCK_SIZE)
+		{
+			processKernel(&m_fBlockL[0], &m_fBlockR[0]);
+			m_uBlockFrames = 0;
+		}
+	}
+
+	// --- audio thread; non-interleaved buffers, pRight NULL for mono. Whole
+	//     blocks are analyzed in place, only the remainder is staged
+	void processBlock(const float* pLeft, const float* pRight, UINT uFrames);
+
+	// --- GUI thread; each view that shows the analyzer starts it once and stops
+	//     it once, the audio thread analyzes while any view is open
+	void start();
+	void stop();
+
+	// --- GUI thread; true if a new snapshot was published since the last call.
+	//     getSnapshot() stays valid until the next call to update()
+	bool update();
+	const stereoSnapshot& getSnapshot(){return m_Snapshots[m_uFront];}
+
+protected:
+	// --- one STEREO_BLOCK_SIZE block
+	void processKernel(const float* pLeft, const float* pRight);
+	void reset();
+	void publish();
+
+	std::atomic<bool> m_bRunning;
+	std::atomic<UINT> m_uStartCount;	// bumped by every start()
+	int m_nViewers;				// GUI thread only
+
+	// --- audio thread
+	UINT m_uResetCount;			// m_uStartCount the state was last reset for
+	float m_fBlockL[STEREO_BLOCK_SIZE];
+	float m_fBlockR[STEREO_BLOCK_SIZE];
+	UINT m_uBlockFrames;
+	float m_fMeanLL;
+	float m_fMeanRR;
+	float m_fMeanLR;
+	float m_fAverageCoeff;		// per block
+	UINT m_uBlocksPerUpdate;
+	UINT m_uBlockCount;
+	UINT m_uDecimation;			// frames per goniometer point
+	UINT m_uPointPhase;			// frames until the next point
+
+	// --- triple buffer; m_uMiddle holds an index plus a "fresh" bit
+	stereoSnapshot m_Snapshots[3];
+	std::atomic<UINT> m_uMiddle;
+	UINT m_uBack;				// audio thread
+	UINT m_uFront;				// GUI
+};
@@ -0,0 +1,167 @@
+#include "StereoViewWP.h"
+#include "vstgui/lib/cdrawcontext.h"
+
+namespace VSTGUI {
+
+// --- layout, pixels
+static const CCoord STEREO_VIEW_BAR_WIDTH = 10;
+static const CCoord STEREO_VIEW_GAP = 4;
+static const CCoord STEREO_VIEW_CORRELATION_HEIGHT = 10;
+
+CStereoViewWP::CStereoViewWP(const CRect& size, CStereoAnalyzer* pAnalyzer)
+: CView(size)
+{
+	m_pAnalyzer = pAnalyzer;
+	m_pTimer = NULL;
+
+	m_BackColor = CColor(20, 20, 24, 255);
+	m_GridColor = CColor(70, 70, 80, 255);
+	m_PointColor = CColor(90, 200, 255, 255);
+	m_MeterColor = CColor(255, 170, 40, 255);
+}
+
+CStereoViewWP::~CStereoViewWP(void)
+{
+	// --- removed() normally did this
+	stopTimer();
+}
+
+void CStereoViewWP::stopTimer()
+{
+	if(m_pTimer)
+	{
+		m_pTimer->stop();
+		m_pTimer->forget();
+		m_pTimer = NULL;
+		m_pAnalyzer->stop();
+	}
+}
+
+bool CStereoViewWP::attached(CView* parent)
+{
+	if(!CView::attached(parent))
+		return false;
+
+	if(!m_pTimer)
+	{
+		m_pAnalyzer->start();
+		m_pTimer = new CVSTGUITimer(this, STEREO_UPDATE_MSEC);
+		m_pTimer->start();
+	}
+
+	return true;
+}
+
+bool CStereoViewWP::removed(CView* parent)
+{
+	stopTimer();
+	return CView::removed(parent);
+}
+
+CMessageResult CStereoViewWP::notify(CBaseObject* sender, IdStringPtr message)
+{
+	if(message == CVSTGUITimer::kMsgTimer)
+	{
+		if(m_pAnalyzer->update())
+			invalid();
+
+		return kMessageNotified;
+	}
+
+	return CView::notify(sender, message);
+}
+
+float CStereoViewWP::rmsToNorm(float fRMS)
+{
+	if(fRMS <= 0.0)
+		return 0.0;
+
+	float fNorm = 1.0 - 20.0*log10(fRMS)/STEREO_VIEW_MIN_DB;
+	if(fNorm < 0.0) fNorm = 0.0;
+	if(fNorm > 1.0) fNorm = 1.0;
+	return fNorm;
+}
+
+// --- vertical bar, filled from the bottom
+void CStereoViewWP::drawBar(CDrawContext* pContext, const CRect& rect, float fNorm)
+{
+	pContext->setFrameColor(m_GridColor);
+	pContext->drawRect(rect, kDrawStroked);
+
+	CRect bar(rect);
+	bar.top = rect.bottom - fNorm*rect.getHeight();
+	pContext->setFillColor(m_MeterColor);
+	pContext->drawRect(bar, kDrawFilled);
+}
+
+void CStereoViewWP::draw(CDrawContext* pContext)
+{
+	const CRect& rect = getViewSize();
+	const stereoSnapshot& snapshot = m_pAnalyzer->getSnapshot();
+
+	pContext->setDrawMode(kAliasing);
+	pContext->setLineStyle(kLineSolid);
+	pContext->setLineWidth(1);
+	pContext->setFillColor(m_BackColor);
+	pContext->drawRect(rect, kDrawFilled);
+
+	// --- the goniometer gets the largest square left of the two bars
+	CCoord barsWidth = 2*(STEREO_VIEW_BAR_WIDTH + STEREO_VIEW_GAP);
+	CCoord scopeHeight = rect.getHeight() - STEREO_VIEW_CORRELATION_HEIGHT - STEREO_VIEW_GAP;
+	CCoord side = rect.getWidth() - barsWidth;
+	if(scopeHeight < side)
+		side = scopeHeight;
+	if(side < 2)
+		return;
+
+	CRect scope(rect.left, rect.top, rect.left + side, rect.top + side);
+	CCoord centerX = scope.left + 0.5*side;
+	CCoord centerY = scope.top + 0.5*side;
+	CCoord radius = 0.5*side;
+
+	// --- grid: the mono axis, the out of phase axis and the L and R diagonals
+	pContext->setFrameColor(m_GridColor);
+	pContext->drawRect(scope, kDrawStroked);
+	pContext->moveTo(CPoint(centerX, scope.top));
+	pContext->lineTo(CPoint(centerX, scope.bottom));
+	pContext->moveTo(CPoint(scope.left, centerY));
+	pContext->lineTo(CPoint(scope.right, centerY));
+	pContext->moveTo(CPoint(scope.left, scope.top));
+	pContext->lineTo(CPoint(scope.right, scope.bottom));
+	pContext->moveTo(CPoint(scope.right, scope.top));
+	pContext->lineTo(CPoint(scope.left, scope.bottom));
+
+	// --- a full scale mono signal reaches the top; left only leans left
+	pContext->setFillColor(m_PointColor);
+	for(UINT i = 0; i < snapshot.uPointCount; i++)
+	{
+		CCoord x = centerX - snapshot.fSide[i]*radius;
+		CCoord y = centerY - snapshot.fMid[i]*radius;
+		if(x < scope.left || x > scope.right - 1 || y < scope.top || y > scope.bottom - 1)
+			continue;
+
+		pContext->drawRect(CRect(x, y, x + 1, y + 1), kDrawFilled);
+	}
+
+	// --- mid and side RMS
+	CRect bar(scope.right + STEREO_VIEW_GAP, scope.top, scope.right + STEREO_VIEW_GAP + STEREO_VIEW_BAR_WIDTH, scope.bottom);
+	drawBar(pContext, bar, rmsToNorm(snapshot.fMidRMS));
+	bar.offset(STEREO_VIEW_BAR_WIDTH + STEREO_VIEW_GAP, 0);
+	drawBar(pContext, bar, rmsToNorm(snapshot.fSideRMS));
+
+	// --- correlation: a marker from the centre towards +1 or -1
+	CRect correlation(rect.left, scope.bottom + STEREO_VIEW_GAP, bar.right, scope.bottom + STEREO_VIEW_GAP + STEREO_VIEW_CORRELATION_HEIGHT);
+	CCoord zeroX = correlation.left + 0.5*correlation.getWidth();
+	CCoord valueX = zeroX + 0.5*snapshot.fCorrelation*correlation.getWidth();
+
+	pContext->setFrameColor(m_GridColor);
+	pContext->drawRect(correlation, kDrawStroked);
+	pContext->setFillColor(m_MeterColor);
+	pContext->drawRect(CRect(valueX < zeroX ? valueX : zeroX, correlation.top, valueX < zeroX ? zeroX : valueX, correlation.bottom), kDrawFilled);
+	pContext->moveTo(CPoint(zeroX, correlation.top));
+	pContext->lineTo(CPoint(zeroX, correlation.bottom));
+
+	setDirty(false);
+}
+
+}
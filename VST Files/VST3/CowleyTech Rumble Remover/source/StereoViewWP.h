@@ -0,0 +1,49 @@
+#pragma once
+#include "vstgui/lib/cview.h"
+#include "vstgui/lib/cvstguitimer.h"
+#include "StereoAnalyzer.h"
+
+namespace VSTGUI {
+
+// --- "StereoInputView", "StereoOutputView": goniometer of the plugin's input or
+//     output in a square on the left (mono straight up, out of phase across),
+//     mid and side RMS bars to its right and the correlation across the bottom,
+//     -1 to +1. Only the analyzer's published snapshots are read
+const float STEREO_VIEW_MIN_DB = -60.0;
+
+class CStereoViewWP : public CView
+{
+public:
+	CStereoViewWP(const CRect& size, CStereoAnalyzer* pAnalyzer);
+	~CStereoViewWP(void);
+
+	void setBackColor(const CColor& color){m_BackColor = color;}
+	void setGridColor(const CColor& color){m_GridColor = color;}
+	void setPointColor(const CColor& color){m_PointColor = color;}
+	void setMeterColor(const CColor& color){m_MeterColor = color;}
+
+	// --- overrides
+	virtual void draw(CDrawContext* pContext) VSTGUI_OVERRIDE_VMETHOD;
+
+	// --- the analyzer and the timer only run while the view is on screen
+	virtual bool attached(CView* parent) VSTGUI_OVERRIDE_VMETHOD;
+	virtual bool removed(CView* parent) VSTGUI_OVERRIDE_VMETHOD;
+	virtual CMessageResult notify(CBaseObject* sender, IdStringPtr message) VSTGUI_OVERRIDE_VMETHOD;
+
+protected:
+	void stopTimer();
+
+	// --- RMS -> 0 (STEREO_VIEW_MIN_DB) to 1 (0 dB)
+	float rmsToNorm(float fRMS);
+
+	void drawBar(CDrawContext* pContext, const CRect& rect, float fNorm);
+
+	CStereoAnalyzer* m_pAnalyzer;
+	CVSTGUITimer* m_pTimer;
+
+	CColor m_BackColor;
+	CColor m_GridColor;
+	CColor m_PointColor;
+	CColor m_MeterColor;
+};
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// --- control tag -> pointer, open addressing with linear probing over one
+//     contiguous power of two table kept at most half full. Finding a tag is a
+//     multiply, a shift and (almost always) one slot compare; RackAFX tags are
+//     0...N-1, which the Fibonacci hash spreads to one or two probes at most.
+//
+//     There is no remove: owners clear() and re-insert when their contents
+//     change, which for an editor is only when views are created.
+template <typename T> class CTagIndex
+{
+public:
+	CTagIndex(void) {clear();}
+
+	void clear()
+	{
+		m_Slots.assign(16, emptySlot());
+		m_uShift = 32 - 4;
+		m_uCount = 0;
+	}
+
+	size_t size() const {return m_uCount;}
+
+	// --- room for uCount tags without growing
+	void reserve(size_t uCount)
+	{
+		size_t uSlots = m_Slots.size();
+		while(uSlots < 2*uCount)
+			uSlots *= 2;
+		if(uSlots != m_Slots.size())
+			rehash(uSlots);
+	}
+
+	// --- replaces the value of a tag that is already there; NULL values are not stored
+	void insert(int32_t nTag, T* pValue)
+	{
+		if(!pValue)
+			return;
+
+		if(2*(m_uCount + 1) > m_Slots.size())
+			rehash(2*m_Slots.size());
+
+		size_t uMask = m_Slots.size() - 1;
+		for(size_t i = hash(nTag);; i = (i + 1) & uMask)
+		{
+			if(!m_Slots[i].pValue)
+			{
+				m_Slots[i].nTag = nTag;
+				m_Slots[i].pValue = pValue;
+				m_uCount++;
+				return;
+			}
+			if(m_Slots[i].nTag == nTag)
+			{
+				m_Slots[i].pValue = pValue;
+				return;
+			}
+		}
+	}
+
+	T* find(int32_t nTag) const
+	{
+		size_t uMask = m_Slots.size() - 1;
+		for(size_t i = hash(nTag);; i = (i + 1) & uMask)
+		{
+			if(!m_Slots[i].pValue)
+				return NULL;
+			if(m_Slots[i].nTag == nTag)
+				return m_Slots[i].pValue;
+		}
+	}
+
+protected:
+	typedef struct
+	{
+		int32_t nTag;
+		T* pValue;		// NULL: empty
+	} tagSlot;
+
+	static tagSlot emptySlot() {tagSlot slot = {0, NULL}; return slot;}
+
+	size_t hash(int32_t nTag) const {return (size_t)(((uint32_t)nTag*2654435769u) >> m_uShift);}
+
+	void rehash(size_t uSlots)
+	{
+		std::vector<tagSlot> old;
+		old.swap(m_Slots);
+		m_Slots.assign(uSlots, emptySlot());
+
+		m_uShift = 32;
+		for(size_t n = uSlots; n > 1; n >>= 1)
+			m_uShift--;
+
+		m_uCount = 0;
+		for(size_t i = 0; i < old.size(); i++)
+		{
+			if(old[i].pValue)
+				insert(old[i].nTag, old[i].pValue);
+		}
+	}
+
+	std::vector<tagSlot> m_Slots;
+	unsigned int m_uShift;		// 32 - log2(slots)
+	size_t m_uCount;
+};
@@ -1,4 +1,5 @@
 #include "VST3EditorWP.h"
+#include "CompiledUIDescriptionWP.h"
 
 namespace VSTGUI {
 
@@ -222,11 +223,21 @@ namespace Steinberg {
 namespace Vst {
 namespace Sock2VST3 {
 
+// --- the description is read from the precompiled uidesc when there is a current
+//     one, and gets its bitmaps from CBitmapCacheWP
 VST3EditorWP::VST3EditorWP(Steinberg::Vst::EditController* controller, UTF8StringPtr templateName, UTF8StringPtr xmlFile)
-: VST3Editor(controller, templateName, xmlFile)
+: VST3Editor(new CCompiledUIDescriptionWP(xmlFile), controller, templateName, xmlFile)
 {
+	// --- VST3Editor remembered it; drop the reference from new
+	if(description)
+		description->forget();
+
 	setIdleRate(GUI_IDLE_UPDATE_INTERVAL_MSEC);
 	m_uKnobMode = kHostChoice; // --- v6.6
+	m_pMessageReceiver = dynamic_cast<IControllerMessageReceiver*>(controller);
+	m_bListenerIndexDirty = true;
+	m_uBatchDepth = 0;
+	m_pBatchRects = NULL;
 }
 
 // --- v6.6 addition
@@ -253,10 +264,73 @@ VSTGUI_INT32 VST3EditorWP::getKnobMode() const
 	return VSTGUI::kLinearMode; // RAFX Default!
 }
 
-// --- this is overridden for future revisions; currently identical to base class
+CView* VST3EditorWP::verifyView(CView* view, const UIAttributes& attributes, const IUIDescription* description)
+{
+	m_bListenerIndexDirty = true;
+	return VST3Editor::verifyView(view, attributes, description);
+}
+
+void VST3EditorWP::controlTagDidChange(CControl* pControl)
+{
+	m_bListenerIndexDirty = true;
+	VST3Editor::controlTagDidChange(pControl);
+}
+
+void PLUGIN_API VST3EditorWP::close()
+{
+	// --- an unbalanced batch must not outlive the frame
+	if(m_pBatchRects)
+	{
+		m_pBatchRects->forget();
+		m_pBatchRects = NULL;
+	}
+	m_uBatchDepth = 0;
+
+	VST3Editor::close();
+
+	m_ListenerIndex.clear();
+	m_bListenerIndexDirty = true;
+}
+
+// --- views are created in bursts (open, recreate), so one rebuild follows each
+ParameterChangeListener* VST3EditorWP::findParameterChangeListener(int32_t tag)
+{
+	if(m_bListenerIndexDirty)
+	{
+		m_ListenerIndex.clear();
+		m_ListenerIndex.reserve(paramChangeListeners.size());
+		for(ParameterChangeListenerMap::const_iterator it = paramChangeListeners.begin(); it != paramChangeListeners.end(); it++)
+			m_ListenerIndex.insert(it->first, it->second);
+
+		m_bListenerIndexDirty = false;
+	}
+
+	return tag == -1 ? NULL : m_ListenerIndex.find(tag);
+}
+
+void VST3EditorWP::beginParameterBatch()
+{
+	if(m_uBatchDepth++ == 0 && getFrame())
+		m_pBatchRects = new CFrame::CollectInvalidRects(getFrame());
+}
+
+void VST3EditorWP::endParameterBatch()
+{
+	if(m_uBatchDepth == 0 || --m_uBatchDepth > 0)
+		return;
+
+	// --- its destructor flushes the collected rects to the frame
+	if(m_pBatchRects)
+	{
+		m_pBatchRects->forget();
+		m_pBatchRects = NULL;
+	}
+}
+
+// --- called on every mouse move of a drag: one hash lookup for the listener
 void VST3EditorWP::valueChanged(CControl* pControl)
 {
-	ParameterChangeListener* pcl = getParameterChangeListener (pControl->getTag ());
+	ParameterChangeListener* pcl = findParameterChangeListener (pControl->getTag ());
 	if(pcl)
 	{
 		Steinberg::Vst::ParamValue value = pControl->getValueNormalized ();
@@ -276,18 +350,32 @@ void VST3EditorWP::valueChanged(CControl* pControl)
 		pcl->performEdit(value);
 	}
 }
+void VST3EditorWP::sendControllerMessage(unsigned int uID)
+{
+	if(!m_pMessageReceiver)
+		return;
+
+	controllerMessage message;
+	message.uID = uID;
+	m_pMessageReceiver->receiveMessage(message);
+}
+
 // --- the only reason for existence is for timed notifications
 CMessageResult VST3EditorWP::notify(CBaseObject* sender, IdStringPtr message)
 {
-	if(message == CVSTGUITimer::kMsgTimer && getController())
-		getController()->receiveText("VSTGUITimerPing");
+	if(message == CVSTGUITimer::kMsgTimer)
+		sendControllerMessage(CONTROLLER_MSG_TIMER_PING);
 	
 	bool bRecreateView = doCreateView;
 
+	// --- recreating clears VST3Editor's listeners
+	if(bRecreateView)
+		m_bListenerIndexDirty = true;
+
 	CMessageResult result = VST3Editor::notify(sender, message);
 
-	if(bRecreateView && getController())
-		getController()->receiveText("RecreateView");
+	if(bRecreateView)
+		sendControllerMessage(CONTROLLER_MSG_RECREATE_VIEW);
  	
 	return result;
 }
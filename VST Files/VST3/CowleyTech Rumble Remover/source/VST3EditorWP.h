@@ -1,5 +1,7 @@
 #pragma once
 #include "vstgui/plugin-bindings/vst3editor.h"
+#include "TagIndex.h"
+#include "ControllerMessages.h"
 #include <vector>
 
 namespace Steinberg {
@@ -26,7 +28,42 @@ public:
 	CBitmap* getBitmap(UTF8StringPtr name);
 	UTF8StringPtr lookupBitmapName(const CBitmap* bitmap);
 
+	// --- many parameters changing at once (preset recall, sendUpdateGUI()): the
+	//     controls' repaints are collected and flushed once by the last end; nests
+	void beginParameterBatch();
+	void endParameterBatch();
+
+	// --- these can add listeners to VST3Editor's map or clear it
+	virtual CView* verifyView(CView* view, const UIAttributes& attributes, const IUIDescription* description);
+	virtual void controlTagDidChange(CControl* pControl);
+	virtual void PLUGIN_API close();
+
 protected:
+	// --- the listener for a tag from m_ListenerIndex, rebuilt from VST3Editor's
+	//     std::map (where the listeners live) after anything could change that
+	ParameterChangeListener* findParameterChangeListener(int32_t tag);
+
+	// --- a message without payload to the controller, if it takes them
+	void sendControllerMessage(unsigned int uID);
+
 	VSTGUI_INT32 m_uKnobMode;
+	IControllerMessageReceiver* m_pMessageReceiver;	// the controller; NULL if it is not ours
+
+	CTagIndex<ParameterChangeListener> m_ListenerIndex;
+	bool m_bListenerIndexDirty;
+
+	unsigned int m_uBatchDepth;
+	CFrame::CollectInvalidRects* m_pBatchRects;
+};
+
+// --- beginParameterBatch()/endParameterBatch() for a scope; pEditor may be NULL
+class CParameterBatchWP
+{
+public:
+	CParameterBatchWP(VST3EditorWP* pEditor) : m_pEditor(pEditor) {if(m_pEditor) m_pEditor->beginParameterBatch();}
+	~CParameterBatchWP(void) {if(m_pEditor) m_pEditor->endParameterBatch();}
+
+protected:
+	VST3EditorWP* m_pEditor;
 };
 }}}
\ No newline at end of file
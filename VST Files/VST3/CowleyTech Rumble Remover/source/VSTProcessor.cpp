@@ -63,17 +63,15 @@
 #include "LCDController.h"
 #include "XYPadWP.h"
 #include "VuMeterWP.h"
+#include "SpectrumViewWP.h"
+#include "StereoViewWP.h"
 #include "SliderWP.h"
+#include "BitmapCacheWP.h"
 #include "XYPadWP.h"
 #include "PadControllerWP.h"
 #include "RafxPluginFactory.h"
 #include "KickButtonWP.h"
 
-// --- Synth Stuff
-#define SYNTH_PROC_BLOCKSIZE 32 // 32 samples per processing block = 0.7 mSec = OK for tactile response WP
-float dummyInputL[SYNTH_PROC_BLOCKSIZE];
-float dummyInputR[SYNTH_PROC_BLOCKSIZE];
-float* dummyInputPtr[2];
 extern void* moduleHandle;
 
 enum {
@@ -113,14 +111,21 @@ Processor::Processor()
 	m_pRAFXPlugIn = NULL;
 	m_pRafxCustomView = NULL;
 	m_pVST3Editor = NULL;
+	m_bEditorOpen = false;
 	m_bHasSidechain = false;
 
+	// --- synth dummy inputs
+	memset(&m_fDummyInputL[0], 0, SYNTH_PROC_BLOCKSIZE*sizeof(float));
+	memset(&m_fDummyInputR[0], 0, SYNTH_PROC_BLOCKSIZE*sizeof(float));
+	m_pDummyInputPtr[0] = &m_fDummyInputL[0];
+	m_pDummyInputPtr[1] = &m_fDummyInputR[0];
+
 	// ---  now set plugin buddy
 	m_pRAFXPlugIn = CRafxPluginFactory::getRafxPlugIn();
 	// --- set latency, sidechain
 	if(m_pRAFXPlugIn)
 	{
-		m_uLatencyInSamples = (uint32)(m_pRAFXPlugIn->m_fPlugInEx[LATENCY_IN_SAMPLES]);
+		m_uLatencyInSamples = m_pRAFXPlugIn->getLatencyInSamples();
 		m_bHasSidechain = m_pRAFXPlugIn->m_uPlugInEx[ENABLE_SIDECHAIN_VSTAU];
 	}
 
@@ -170,6 +175,9 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 		if(!m_pRAFXPlugIn)
 			m_pRAFXPlugIn = CRafxPluginFactory::getRafxPlugIn();
 
+		// --- editor bitmaps are shared by every instance in the process
+		CBitmapCacheWP::addClient();
+
 		m_pAlphaWheelKnob = NULL;
 		m_pVST3Editor = NULL;
 
@@ -190,19 +198,20 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 				{
 					float fDefault = 0.0;
 					if(pUICtrl->uUserDataType == intData)
-						fDefault = pUICtrl->fInitUserIntValue;
+						fDefault = pUICtrl->pInfo->fInitUserIntValue;
 					else if(pUICtrl->uUserDataType == floatData)
-						fDefault = pUICtrl->fInitUserFloatValue;
+						fDefault = pUICtrl->pInfo->fInitUserFloatValue;
 					else if(pUICtrl->uUserDataType == doubleData)
-						fDefault = pUICtrl->fInitUserDoubleValue;
+						fDefault = pUICtrl->pInfo->fInitUserDoubleValue;
 					else if(pUICtrl->uUserDataType == UINTData)
-						fDefault = pUICtrl->fInitUserUINTValue;
+						fDefault = pUICtrl->pInfo->fInitUserUINTValue;
 
 					if(pUICtrl->uControlType == FILTER_CONTROL_LED_METER)
 					{
-						PeakParameter* peakParam = new PeakParameter(ParameterInfo::kIsReadOnly, i, USTRING(pUICtrl->cControlName));
+						PeakParameter* peakParam = new PeakParameter(ParameterInfo::kIsReadOnly, i, USTRING(pUICtrl->pInfo->cControlName));
 						parameters.addParameter(peakParam);
 						meters.push_back(i); // save tag
+						meterValues.push_back(pUICtrl->m_pCurrentMeterValue);
 					}
 					else if(pUICtrl->uControlType == FILTER_CONTROL_CONTINUOUSLY_VARIABLE ||
 							pUICtrl->uControlType == FILTER_CONTROL_RADIO_SWITCH_VARIABLE ||
@@ -211,13 +220,13 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 					{
 						if(pUICtrl->uUserDataType != UINTData)
 						{
-							char* pName = pUICtrl->cControlName;
-							bool bHaveUnits = false;//trimString(pUICtrl->cControlUnits);
+							const char* pName = pUICtrl->pInfo->cControlName;
+							bool bHaveUnits = false;//trimString(pUICtrl->pInfo->cControlUnits);
 
 							// --- add () for LCS Control Units
-							if(pUICtrl->uControlTheme[31] == 1 && bHaveUnits)
+							if(pUICtrl->pInfo->uControlTheme[31] == 1 && bHaveUnits)
 							{
-								char* p1 = addStrings(" (", pUICtrl->cControlUnits);
+								char* p1 = addStrings(" (", pUICtrl->pInfo->cControlUnits);
 								char* p2 = addStrings(p1, ")");
 								pName = addStrings(pName, p2);
 								delete [] p1;
@@ -230,7 +239,7 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 							{
 								param = new LogParameter(USTRING(pName),
 														   i, /* INDEX !! */
-														   USTRING(pUICtrl->cControlUnits),
+														   USTRING(pUICtrl->pInfo->cControlUnits),
 														   pUICtrl->fUserDisplayDataLoLimit,
 														   pUICtrl->fUserDisplayDataHiLimit,
 														   fDefault);
@@ -240,7 +249,7 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 							{
 								param = new VoltOctaveParameter(USTRING(pName),
 														   i, /* INDEX !! */
-														   USTRING(pUICtrl->cControlUnits),
+														   USTRING(pUICtrl->pInfo->cControlUnits),
 														   pUICtrl->fUserDisplayDataLoLimit,
 														   pUICtrl->fUserDisplayDataHiLimit,
 														   fDefault);
@@ -250,7 +259,7 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 							{
 								param = new RangeParameter(USTRING(pName),
 														   i, /* INDEX !! */
-														   USTRING(pUICtrl->cControlUnits),
+														   USTRING(pUICtrl->pInfo->cControlUnits),
 														   pUICtrl->fUserDisplayDataLoLimit,
 														   pUICtrl->fUserDisplayDataHiLimit,
 														   fDefault);
@@ -260,7 +269,7 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 							// --- add it
 							parameters.addParameter(param);
 
-							if(pUICtrl->uControlTheme[31] == 1)
+							if(pUICtrl->pInfo->uControlTheme[31] == 1)
 							{
 								LCDparameters.addParameter(param);
 								param->addRef(); // important!
@@ -268,13 +277,13 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 						}
 						else
 						{
-							char* pName = pUICtrl->cControlName;
-							bool bHaveUnits = false; //trimString(pUICtrl->cControlUnits);
+							const char* pName = pUICtrl->pInfo->cControlName;
+							bool bHaveUnits = false; //trimString(pUICtrl->pInfo->cControlUnits);
 
 							// --- add () for LCS Control Units
-							if(pUICtrl->uControlTheme[31] == 1 && bHaveUnits)
+							if(pUICtrl->pInfo->uControlTheme[31] == 1 && bHaveUnits)
 							{
-								char* p1 = addStrings(" (", pUICtrl->cControlUnits);
+								char* p1 = addStrings(" (", pUICtrl->pInfo->cControlUnits);
 								char* p2 = addStrings(p1, ")");
 								pName = addStrings(pName, p2);
 								delete [] p1;
@@ -285,15 +294,15 @@ tresult PLUGIN_API Processor::initialize(FUnknown* context)
 							int m = 0;
 							char* pEnumString = NULL;
 
-							pEnumString = getEnumString(pUICtrl->cEnumeratedList, m++);
+							pEnumString = getEnumString(pUICtrl->pInfo->cEnumeratedList, m++);
 							while(pEnumString)
 							{
 								enumStringParam->appendString(USTRING(pEnumString));
-								pEnumString = getEnumString(pUICtrl->cEnumeratedList, m++);
+								pEnumString = getEnumString(pUICtrl->pInfo->cEnumeratedList, m++);
 							}
 							parameters.addParameter(enumStringParam);
 
-							if(pUICtrl->uControlTheme[31] == 1)
+							if(pUICtrl->pInfo->uControlTheme[31] == 1)
 							{
 								LCDparameters.addParameter(enumStringParam);
 								enumStringParam->addRef(); // important!
@@ -526,6 +535,10 @@ tresult PLUGIN_API Processor::setupProcessing(ProcessSetup& newSetup)
 
 	m_pRAFXPlugIn->m_nSampleRate = (int)processSetup.sampleRate;
 	m_pRAFXPlugIn->prepareForPlay();
+	initBlockMeters();
+
+	// --- latency may depend on sample rate; host queries it after this call
+	checkLatencyChange(false);
 
 	// --- base class
 	return SingleComponentEffect::setupProcessing(newSetup);
@@ -549,6 +562,10 @@ tresult PLUGIN_API Processor::setActive(TBool state)
 		m_pRAFXPlugIn->initialize();
 		m_pRAFXPlugIn->m_nSampleRate = (int)processSetup.sampleRate;
 		m_pRAFXPlugIn->prepareForPlay();
+		initBlockMeters();
+
+		// --- host queries latency on activation, no restart needed
+		checkLatencyChange(false);
 	}
 	else
 	{
@@ -959,7 +976,8 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 				}
 
 				// --- update the meters
-				updateMeters(data, true);
+				meterBuffer(data.numSamples, true);
+				sendAudioMessages(data);
 
 				return kResultTrue;
 			}
@@ -996,7 +1014,8 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 				m_pRAFXPlugIn->processVSTAudioBuffer(&data.inputs[0].channelBuffers32[0], &data.outputs[0].channelBuffers32[0], numChannels, data.numSamples);
 
 				// --- update the meters
-				updateMeters(data);
+				meterBuffer(data.numSamples);
+				sendAudioMessages(data);
 
 				return kResultTrue;
 			}
@@ -1036,6 +1055,9 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 				if(m_pRAFXPlugIn)
 					m_pRAFXPlugIn->processAudioFrame(&fInputs[0], &fOutputs[0], numChannels, numChannels);
 
+				// --- sample-accurate meters
+				meterFrame();
+
 				// --- write outputs
 				(data.outputs[0].channelBuffers32[0])[sample] = fOutputs[0];
 				if(numChannels == 2)
@@ -1043,7 +1065,7 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 			}
 
 			// --- update the meters
-			updateMeters(data);
+			sendAudioMessages(data);
 		}
 	}
 	else
@@ -1055,9 +1077,7 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 
 		// --- for synths, VST3 clients have NULL input buffers!;
 		//	   RAFX wants non-null buffers even if it isn't going to use them
-		//	   the dummy buffers are declared at the top of this file as globals
-		dummyInputPtr[0] = &dummyInputL[0];
-		dummyInputPtr[1] = &dummyInputR[0];
+		//	   the dummy buffers are per-instance members, set up in the constructor
 		doControlUpdate(data);
 
 		// --- we process 32 samples at a time; MIDI events are then accurate to 0.7 mSec
@@ -1139,10 +1159,11 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 			// --- see if plugin will process natively
 			if(m_pRAFXPlugIn->m_bWantVSTBuffers)
 			{
-				m_pRAFXPlugIn->processVSTAudioBuffer(&dummyInputPtr[0],
+				m_pRAFXPlugIn->processVSTAudioBuffer(&m_pDummyInputPtr[0],
 													 &buffers[0],
 													 2,
 													 samplesToProcess);
+				meterBuffer(samplesToProcess);
 			}
 			else
 			{
@@ -1158,6 +1179,9 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 					if(m_pRAFXPlugIn)
 						m_pRAFXPlugIn->processAudioFrame(&input[0], &output[0], INPUT_CHANNELS, OUTPUT_CHANNELS);
 
+					// --- sample-accurate meters
+					meterFrame();
+
 					// just clear buffers
 					buffers[0][j] = output[0];	// left
 					buffers[1][j] = output[1];	// right
@@ -1175,40 +1199,110 @@ tresult PLUGIN_API Processor::process(ProcessData& data)
 		} // end while (numSamples > 0)
 
 		// --- update the meters
-		updateMeters(data);
+		sendAudioMessages(data);
 	}
 
 	return kResultTrue;
 }
 
 /*
-	Processor::updateMeters()
-	updates the meter variables
+	Processor::initBlockMeters()
+	sets the meter ballistics from the control info at the current sample rate
 */
-
-void Processor::updateMeters(ProcessData& data, bool bForceOff)
+void Processor::initBlockMeters()
 {
 	if(!m_pRAFXPlugIn) return;
 
+	// --- the meter list is fixed after initialize(); channels follow it, as
+	//     many as a meter frame message has room for
+	UINT uChannels = (UINT)meterValues.size();
+	if(uChannels > CONTROLLER_MAX_METERS)
+		uChannels = CONTROLLER_MAX_METERS;
+	if(meterEngine.getChannelCount() != uChannels)
+		meterEngine.setChannels(uChannels, uChannels == 0 ? NULL : &meterValues[0]);
+
+	meterEngine.setSampleRate((float)processSetup.sampleRate);
+
+	for(UINT i=0; i<uChannels; i++)
+	{
+		CUICtrl* pUICtrl = m_pRAFXPlugIn->m_UIControlList.getAt(meters[i]);
+		if(pUICtrl)
+			meterEngine.setDetector(i, pUICtrl->pInfo->fMeterAttack_ms,
+									pUICtrl->pInfo->fMeterRelease_ms,
+									pUICtrl->pInfo->uDetectorMode);
+	}
+}
+
+/*
+	Processor::meterFrame()
+	runs the meter variables through their ballistics; call after every processAudioFrame()
+*/
+void Processor::meterFrame()
+{
+	meterEngine.processFrame();
+}
+
+/*
+	Processor::meterBuffer()
+	for buffer processing, where the meter variables only change once per buffer;
+	bForceOff drops the meters (bypass)
+*/
+void Processor::meterBuffer(int32 nFrames, bool bForceOff)
+{
+	meterEngine.processHeld(nFrames, bForceOff);
+}
+
+/*
+	Processor::sendAudioMessages()
+	ends the block: every meter's readings go to the controller as one message,
+	written straight into the queue; wait-free. Only the GUI timer drains the
+	queue, so with the editor closed (or the queue full) the frame goes to
+	m_MeterFrame instead and nothing piles up to be replayed when it opens.
+	Either way each meter's detector goes to the host once per block, so
+	hosts see the meter parameters without the editor
+*/
+void Processor::sendAudioMessages(ProcessData& data)
+{
+	controllerMessage* pMessage = m_bEditorOpen.load(std::memory_order_relaxed) ? m_AudioMessages.beginPush(CONTROLLER_MSG_METER_FRAME) : NULL;
+	meterFrameMessage* pFrame = pMessage ? &pMessage->meterFrame : &m_MeterFrame;
+
+	UINT uChannels = meterEngine.getChannelCount();
+	pFrame->uChannels = uChannels;
+	if(!meterEngine.endBlock(&pFrame->fFrame[0]))
+		return;
+
 	if(data.outputParameterChanges)
 	{
-		int nCount = meters.size();
-		for(int i=0; i<nCount; i++)
+		// --- the detector row is the last, linear
+		UINT uStride = meterEngine.getFrameSize()/(METER_READINGS + 1);
+		const float* pDetector = &pFrame->fFrame[METER_READINGS*uStride];
+		for(UINT i=0; i<uChannels; i++)
 		{
-			CUICtrl* pUICtrl = m_pRAFXPlugIn->m_UIControlList.getAt(meters[i]);
-			if(pUICtrl)
-			{
-				int32 index;
-				IParamValueQueue* queue = data.outputParameterChanges->addParameterData(meters[i], index);
-
-				if(queue && pUICtrl->m_pCurrentMeterValue)
-				{
-					float fMeter = bForceOff ? 0.0 : *pUICtrl->m_pCurrentMeterValue;
-					queue->addPoint(i, fMeter, index);
-				}
-			}
+			int32 index;
+			IParamValueQueue* queue = data.outputParameterChanges->addParameterData(meters[i], index);
+			if(queue)
+				queue->addPoint(0, pDetector[i], index);
 		}
 	}
+
+	// --- after the reads above; the slot is the controller's once pushed
+	if(pMessage)
+		m_AudioMessages.push();
+}
+
+/*
+	Processor::updateMeterParams()
+	GUI timer, after the meter frames were displayed: redraws the meter views
+	and sets the meter parameters for the host
+*/
+void Processor::updateMeterParams()
+{
+	if(!meterEngine.updateDisplay())
+		return;
+
+	UINT uCount = meterEngine.getChannelCount();
+	for(UINT i=0; i<uCount; i++)
+		setParamNormalized(meters[i], meterEngine.getDetector(i));
 }
 
 /*
@@ -1276,8 +1370,8 @@ tresult PLUGIN_API Processor::getMidiControllerAssignment(int32 busIndex, int16
 				// for RAFX MIDI Control only
 				if(pUICtrl)
 				{
-					if(pUICtrl->bMIDIControl &&
-					   pUICtrl->uMIDIControlName == midiControllerNumber)
+					if(pUICtrl->pInfo->bMIDIControl &&
+					   pUICtrl->pInfo->uMIDIControlName == midiControllerNumber)
 					{
 						bFoundIt = true; // this is because ID = -1 is illegal
 						id = i;
@@ -1361,10 +1455,15 @@ IPlugView* PLUGIN_API Processor::createView(const char* _name)
 		*/
 
 #if defined _WINDOWS || defined _WINDLL
-		m_pVST3Editor = new VST3EditorWP(this, "Editor", "rafx.uidesc"); // For WIN uses old resource ID for back compatibility; "rafx.uidesc" is the ID name, NOT the filename
+		const char* xmlFile = "rafx.uidesc"; // For WIN uses old resource ID for back compatibility; "rafx.uidesc" is the ID name, NOT the filename
 #else
-		m_pVST3Editor = new VST3EditorWP(this, "Editor", "RackAFX.uidesc"); // For MAC, uses actual file name (string) "RackAFX.uidesc"
+		const char* xmlFile = "RackAFX.uidesc"; // For MAC, uses actual file name (string) "RackAFX.uidesc"
 #endif
+		// --- decodes the bitmaps the uidesc uses in the background while the frame is
+		//     built; only the first editor in the process does any work here
+		CBitmapCacheWP::prefetch(xmlFile);
+
+		m_pVST3Editor = new VST3EditorWP(this, "Editor", xmlFile);
 		if(m_pVST3Editor)
 		{
 			// --- v6.6 you can now control the knob mode; see RAFX GUIDesigner
@@ -1383,15 +1482,15 @@ void Processor::didOpen(VST3Editor* editor)		///< called after the editor was op
 
 	if(editor == m_pVST3Editor)
 	{
-		CFrame* frame = m_pVST3Editor->getFrame();
+		// --- frames left from before it last closed are stale
+		while(m_AudioMessages.front())
+			m_AudioMessages.pop();
+
+		m_bEditorOpen = true;
 
 		// --- fill in the struct
-		guiInfoStruct.message = GUI_DID_OPEN;
-		guiInfoStruct.customViewName = "";
-		guiInfoStruct.subControllerName = "";
-		guiInfoStruct.listener = NULL;
-		guiInfoStruct.editor = (void*)m_pVST3Editor;
-		guiInfoStruct.bHasUserCustomView = false;
+		VSTGUI_VIEW_INFO guiInfoStruct;
+		initGUIInfo(guiInfoStruct, GUI_DID_OPEN);
 
 		m_pRAFXPlugIn->showGUI((void*)(&guiInfoStruct));
 	}
@@ -1399,17 +1498,31 @@ void Processor::didOpen(VST3Editor* editor)		///< called after the editor was op
 
 void Processor::willClose(VST3Editor* editor)	///< called before the editor will close
 {
+	if(editor == m_pVST3Editor)
+		m_bEditorOpen = false;
+
 	if(!m_pRAFXPlugIn) return;
 
 	// --- fill in the struct
-	guiInfoStruct.message = GUI_WILL_CLOSE;
+	VSTGUI_VIEW_INFO guiInfoStruct;
+	initGUIInfo(guiInfoStruct, GUI_WILL_CLOSE);
+
+	m_pRAFXPlugIn->showGUI((void*)(&guiInfoStruct));
+}
+
+/*
+	Processor::initGUIInfo()
+	a cleared struct for one showGUI() call; the plug-in may write its
+	return values into it, so every call gets its own
+*/
+void Processor::initGUIInfo(VSTGUI_VIEW_INFO& guiInfoStruct, unsigned int uMessage)
+{
+	memset(&guiInfoStruct, 0, sizeof(VSTGUI_VIEW_INFO));
+	guiInfoStruct.message = uMessage;
 	guiInfoStruct.customViewName = "";
 	guiInfoStruct.subControllerName = "";
 	guiInfoStruct.editor = (void*)m_pVST3Editor;
-	guiInfoStruct.listener = NULL;
 	guiInfoStruct.bHasUserCustomView = false;
-
-	m_pRAFXPlugIn->showGUI((void*)(&guiInfoStruct));
 }
 
 
@@ -1502,6 +1615,21 @@ IController* Processor::createSubController(UTF8StringPtr _name, IUIDescription*
 	return NULL;
 }
 
+/*
+	meterReadingFromString()
+	the optional "meter-ballistics" attribute of the meter views; anything else
+	(or none) is the control's own detector, as the RackAFX meters have it
+*/
+static UINT meterReadingFromString(const std::string* pString)
+{
+	if(!pString) return METER_READING_DETECTOR;
+	if(*pString == "peak-hold") return METER_READING_PEAK_HOLD;
+	if(*pString == "vu") return METER_READING_VU;
+	if(*pString == "ppm") return METER_READING_PPM;
+	if(*pString == "rms") return METER_READING_RMS;
+	return METER_READING_DETECTOR;
+}
+
 /*
 	Processor::createCustomView()
 	create custom views for customized objects
@@ -1542,11 +1670,7 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 		CControlListener* listener = description->getControlListener(controlTagName);
 
 		// --- bitmap
-		std::string BMString = *bitmapString;
-		BMString += ".png";
-		UTF8StringPtr bmp = BMString.c_str();
-		CResourceDescription bmpRes(bmp);
-		CBitmap* pBMP = new CBitmap(bmpRes);
+		CBitmap* pBMP = CBitmapCacheWP::getBitmap(bitmapString->c_str());
 
 		// --- offset
 		CPoint offset;
@@ -1661,11 +1785,7 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 		CCoord heightOfOneImage = strtod(heightOneImageString->c_str(), 0);
 
 		// --- bitmap
-		std::string BMString = *bitmapString;
-		BMString += ".png";
-		UTF8StringPtr bmp = BMString.c_str();
-		CResourceDescription bmpRes(bmp);
-		CBitmap* pBMP = new CBitmap(bmpRes);
+		CBitmap* pBMP = CBitmapCacheWP::getBitmap(bitmapString->c_str());
 
 		// --- offset
 		CPoint offset;
@@ -1712,17 +1832,8 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 		int32_t tag = description->getTagForName(tagString->c_str());
 
 		// --- bitmap
-		std::string BMString = *bitmapString;
-		BMString += ".png";
-		UTF8StringPtr bmp = BMString.c_str();
-		CResourceDescription bmpRes(bmp);
-		CBitmap* pBMP_back = new CBitmap(bmpRes);
-
-		std::string BMStringH = *handleBitmapString;
-		BMStringH += ".png";
-		UTF8StringPtr bmpH = BMStringH.c_str();
-		CResourceDescription bmpResH(bmpH);
-		CBitmap* pBMP_hand = new CBitmap(bmpResH);
+		CBitmap* pBMP_back = CBitmapCacheWP::getBitmap(bitmapString->c_str());
+		CBitmap* pBMP_hand = CBitmapCacheWP::getBitmap(handleBitmapString->c_str());
 
 		// --- offset
 		CPoint offset;
@@ -1768,17 +1879,9 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 
 			const CRect rect(origin, size);
 
-			std::string onBMString = *ONbitmapString;
-			onBMString += ".png";
-			UTF8StringPtr onbmp = onBMString.c_str();
-			CResourceDescription bmpRes(onbmp);
-			CBitmap* onBMP = new CBitmap(bmpRes);
+			CBitmap* onBMP = CBitmapCacheWP::getBitmap(ONbitmapString->c_str());
 
-			std::string offBMString = *OFFbitmapString;
-			offBMString += ".png";
-			UTF8StringPtr offbmp = offBMString.c_str();
-			CResourceDescription bmpRes2(offbmp);
-			CBitmap* offBMP = new CBitmap(bmpRes2);
+			CBitmap* offBMP = CBitmapCacheWP::getBitmap(OFFbitmapString->c_str());
 
 			int32_t nbLed = strtol(numLEDString->c_str(), 0, 10);
 
@@ -1811,14 +1914,18 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 				CUICtrl* pUICtrl = m_pRAFXPlugIn->m_UIControlList.getAt(i);
 				if(pUICtrl && m_pVST3Editor)
 				{
-					if(strcmp(pUICtrl->cControlName, tagString->c_str()) == 0 && pUICtrl->m_pCurrentMeterValue)
+					if(strcmp(pUICtrl->pInfo->cControlName, tagString->c_str()) == 0 && pUICtrl->m_pCurrentMeterValue)
 					{
-						// --- identical to RAFX, meters should behave the same way
-						float fSampleRate = 1.0/(METER_UPDATE_INTERVAL_MSEC*0.001);
-						p->initDetector(fSampleRate, pUICtrl->fMeterAttack_ms,
-										pUICtrl->fMeterRelease_ms, true,
-										pUICtrl->uDetectorMode,
-										pUICtrl->bLogMeter);
+						// --- the ballistics run on the audio thread (Processor::meterFrame());
+						//     the view only maps the value to its scale
+						p->setLogMeter(pUICtrl->pInfo->bLogMeter);
+
+						// --- and the readings come from the meter engine, already in dB
+						for(int j = 0; j < (int)meters.size(); j++)
+						{
+							if(meters[j] == i)
+								p->setMeterEngine(&meterEngine, j, meterReadingFromString(attributes.getAttributeValue("meter-ballistics")));
+						}
 					}
 				}
 			}
@@ -1844,17 +1951,9 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 
 			const CRect rect(origin, size);
 
-			std::string onBMString = *ONbitmapString;
-			onBMString += ".png";
-			UTF8StringPtr onbmp = onBMString.c_str();
-			CResourceDescription bmpRes(onbmp);
-			CBitmap* onBMP = new CBitmap(bmpRes);
+			CBitmap* onBMP = CBitmapCacheWP::getBitmap(ONbitmapString->c_str());
 
-			std::string offBMString = *OFFbitmapString;
-			offBMString += ".png";
-			UTF8StringPtr offbmp = offBMString.c_str();
-			CResourceDescription bmpRes2(offbmp);
-			CBitmap* offBMP = new CBitmap(bmpRes2);
+			CBitmap* offBMP = CBitmapCacheWP::getBitmap(OFFbitmapString->c_str());
 
 			int32_t nbLed = strtol(numLEDString->c_str(), 0, 10);
 
@@ -1875,14 +1974,18 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 				CUICtrl* pUICtrl = m_pRAFXPlugIn->m_UIControlList.getAt(i);
 				if(pUICtrl && m_pVST3Editor)
 				{
-					if(strcmp(pUICtrl->cControlName, tagString->c_str()) == 0)
+					if(strcmp(pUICtrl->pInfo->cControlName, tagString->c_str()) == 0)
 					{
-						// --- identical to RAFX, meters should behave the same way
-						float fSampleRate = 1.0/(METER_UPDATE_INTERVAL_MSEC*0.001);
-						p->initDetector(fSampleRate, pUICtrl->fMeterAttack_ms,
-										pUICtrl->fMeterRelease_ms, true,
-										pUICtrl->uDetectorMode,
-										pUICtrl->bLogMeter);
+						// --- the ballistics run on the audio thread (Processor::meterFrame());
+						//     the view only maps the value to its scale
+						p->setLogMeter(pUICtrl->pInfo->bLogMeter);
+
+						// --- and the readings come from the meter engine, already in dB
+						for(int j = 0; j < (int)meters.size(); j++)
+						{
+							if(meters[j] == i)
+								p->setMeterEngine(&meterEngine, j, meterReadingFromString(attributes.getAttributeValue("meter-ballistics")));
+						}
 					}
 				}
 			}
@@ -1890,16 +1993,86 @@ CView* Processor::createCustomView(UTF8StringPtr name,
 		}
 	}
 
+	// --- analyzer of the plugin with its filter response; needs a plugin that has one
+	if(viewname == "SpectrumView" && m_pRAFXPlugIn->getSpectrumAnalyzer())
+	{
+		const std::string* sizeString = attributes.getAttributeValue("size");
+		const std::string* originString = attributes.getAttributeValue("origin");
+		const std::string* backColorString = attributes.getAttributeValue("back-color");
+		const std::string* frameColorString = attributes.getAttributeValue("frame-color");		// grid
+		const std::string* spectrumColorString = attributes.getAttributeValue("font-color");	// spectrum
+		const std::string* responseColorString = attributes.getAttributeValue("shadow-color");	// filter response
+
+		if(sizeString && originString)
+		{
+			CPoint origin;
+			CPoint size;
+			parseSize(*sizeString, size);
+			parseSize(*originString, origin);
+
+			const CRect rect(origin, size);
+
+			CSpectrumViewWP* p = new CSpectrumViewWP(rect, m_pRAFXPlugIn->getSpectrumAnalyzer(), m_pRAFXPlugIn->getResponseCurve());
+
+			// --- colors are optional
+			CColor color;
+			if(backColorString && description->getColor(backColorString->c_str(), color))
+				p->setBackColor(color);
+			if(frameColorString && description->getColor(frameColorString->c_str(), color))
+				p->setGridColor(color);
+			if(spectrumColorString && description->getColor(spectrumColorString->c_str(), color))
+				p->setSpectrumColor(color);
+			if(responseColorString && description->getColor(responseColorString->c_str(), color))
+				p->setResponseColor(color);
+
+			return p;
+		}
+	}
+
+	// --- goniometer, mid/side and correlation of the plugin's input or output
+	if((viewname == "StereoInputView" || viewname == "StereoOutputView") && m_pRAFXPlugIn->getStereoAnalyzer(viewname == "StereoOutputView"))
+	{
+		const std::string* sizeString = attributes.getAttributeValue("size");
+		const std::string* originString = attributes.getAttributeValue("origin");
+		const std::string* backColorString = attributes.getAttributeValue("back-color");
+		const std::string* frameColorString = attributes.getAttributeValue("frame-color");		// grid
+		const std::string* pointColorString = attributes.getAttributeValue("font-color");		// goniometer
+		const std::string* meterColorString = attributes.getAttributeValue("shadow-color");	// bars
+
+		if(sizeString && originString)
+		{
+			CPoint origin;
+			CPoint size;
+			parseSize(*sizeString, size);
+			parseSize(*originString, origin);
+
+			const CRect rect(origin, size);
+
+			CStereoViewWP* p = new CStereoViewWP(rect, m_pRAFXPlugIn->getStereoAnalyzer(viewname == "StereoOutputView"));
+
+			// --- colors are optional
+			CColor color;
+			if(backColorString && description->getColor(backColorString->c_str(), color))
+				p->setBackColor(color);
+			if(frameColorString && description->getColor(frameColorString->c_str(), color))
+				p->setGridColor(color);
+			if(pointColorString && description->getColor(pointColorString->c_str(), color))
+				p->setPointColor(color);
+			if(meterColorString && description->getColor(meterColorString->c_str(), color))
+				p->setMeterColor(color);
+
+			return p;
+		}
+	}
+
 	// --- try plugin
 	if(strlen(name) > 0)
 	{
 		// --- try plugin
-		guiInfoStruct.message = GUI_CUSTOMVIEW;
-		guiInfoStruct.subControllerName = "";
+		VSTGUI_VIEW_INFO guiInfoStruct;
+		initGUIInfo(guiInfoStruct, GUI_CUSTOMVIEW);
 		guiInfoStruct.listener = NULL;
 		guiInfoStruct.window = NULL;
-		guiInfoStruct.editor = (void*)m_pVST3Editor;
-		guiInfoStruct.bHasUserCustomView = false;
 
 		guiInfoStruct.hPlugInInstance = NULL;
 		guiInfoStruct.hRAFXInstance = NULL;
@@ -2096,62 +2269,95 @@ tresult PLUGIN_API Processor::terminate()
 
 	// --- clear out the index values
 	meters.clear();
+	meterValues.clear();
+	meterEngine.setChannels(0, NULL);
+
+	CBitmapCacheWP::removeClient();
 
 	return SingleComponentEffect::terminate();
 }
 
 /*
 	Processor::updatePluginParams()
-	for RackAFX sendUpdateGUI() support
+	for RackAFX sendUpdateGUI() and sendParameterUpdate() support
+	GUI timer: pushes only the parameters the plug-in marked dirty since the
+	last tick; nothing marked is one atomic load
 */
 void Processor::updatePluginParams()
 {
 	if(!m_pRAFXPlugIn) return;
 
-	for(int i = 0; i < m_pRAFXPlugIn->m_UIControlList.count(); i++)
+	// --- the legacy flag (plug-ins may set it directly) marks everything
+	if(m_pRAFXPlugIn->m_uPlugInEx[UPDATE_GUI] == 1)
 	{
-		setParamNormalized(i, m_pRAFXPlugIn->getParameter(i));
+		m_pRAFXPlugIn->m_uPlugInEx[UPDATE_GUI] = 0; // reset
+		m_pRAFXPlugIn->m_ParamDirty.setAll();
+	}
+
+	UINT uDirty = m_pRAFXPlugIn->m_ParamDirty.take(&m_uDirtyParams[0]);
+	UINT uCount = (UINT)m_pRAFXPlugIn->m_UIControlList.count();
+
+	// --- one repaint for the lot when more than one moved
+	CParameterBatchWP batch(uDirty > 1 && m_bEditorOpen ? m_pVST3Editor : NULL);
+
+	// --- ascending, so the first index past the list ends it
+	for(UINT i = 0; i < uDirty && m_uDirtyParams[i] < uCount; i++)
+	{
+		setParamNormalized(m_uDirtyParams[i], m_pRAFXPlugIn->getParameter(m_uDirtyParams[i]));
 	}
 }
 
 /*
-	Processor::receiveText()
-	for RackAFX sendUpdateGUI() support
-	could also add more communication with VST3EditorWP here
+	Processor::receiveMessage()
+	typed messages from VST3EditorWP; for RackAFX sendUpdateGUI() support, the
+	meters and the plug-in's GUI timer
 */
-tresult Processor::receiveText(const char8* text)
+void Processor::receiveMessage(const controllerMessage& message)
 {
-	if(!m_pRAFXPlugIn) return kResultTrue;
+	if(!m_pRAFXPlugIn) return;
 
-	if(strcmp(text, "VSTGUITimerPing") == 0)
+	switch(message.uID)
 	{
-		if(m_pRAFXPlugIn->m_uPlugInEx[UPDATE_GUI] == 1)
+		case CONTROLLER_MSG_TIMER_PING:
 		{
+			// --- parameters the plug-in changed
 			updatePluginParams();
-			m_pRAFXPlugIn->m_uPlugInEx[UPDATE_GUI] = 0; // reset
-		}
 
-		// --- timer ping -> PlugIn
-		guiInfoStruct.message = GUI_TIMER_PING;
-		m_pRAFXPlugIn->showGUI((void*)&guiInfoStruct);
-	}
-	if(strcmp(text, "RecreateView") == 0)
-	{
-		// user is editing in VST3 editor, update
-		CFrame* frame = m_pVST3Editor->getFrame();
+			// --- catch latency changes made by automation on the audio thread
+			checkLatencyChange(true);
 
-		// --- fill in the struct
-		guiInfoStruct.message = GUI_DID_OPEN;
-		guiInfoStruct.customViewName = "";
-		guiInfoStruct.subControllerName = "";
-		guiInfoStruct.editor = (void*)m_pVST3Editor;
-		guiInfoStruct.listener = NULL;
-		guiInfoStruct.bHasUserCustomView = false;
+			// --- what the audio thread sent since the last tick
+			for(const controllerMessage* pMessage = m_AudioMessages.front(); pMessage; pMessage = m_AudioMessages.front())
+			{
+				receiveMessage(*pMessage);
+				m_AudioMessages.pop();
+			}
 
-		m_pRAFXPlugIn->showGUI((void*)(&guiInfoStruct));
-	}
+			// --- meters
+			updateMeterParams();
 
-	return kResultTrue;
+			// --- timer ping -> PlugIn
+			VSTGUI_VIEW_INFO guiInfoStruct;
+			initGUIInfo(guiInfoStruct, GUI_TIMER_PING);
+			m_pRAFXPlugIn->showGUI((void*)&guiInfoStruct);
+			break;
+		}
+		case CONTROLLER_MSG_RECREATE_VIEW:
+		{
+			// user is editing in VST3 editor, update
+			VSTGUI_VIEW_INFO guiInfoStruct;
+			initGUIInfo(guiInfoStruct, GUI_DID_OPEN);
+			m_pRAFXPlugIn->showGUI((void*)(&guiInfoStruct));
+			break;
+		}
+		case CONTROLLER_MSG_METER_FRAME:
+		{
+			// --- a frame made before the meter list changed would not line up
+			if(message.meterFrame.uChannels == meterEngine.getChannelCount())
+				meterEngine.displayFrame(&message.meterFrame.fFrame[0]);
+			break;
+		}
+	}
 }
 
 /*
@@ -2182,6 +2388,9 @@ tresult PLUGIN_API Processor::setComponentState(IBStream* fileStream)
 	// --- read the version
 	if(!s.readInt64u(version)) return kResultFalse;
 
+	// --- preset recall: one repaint for all the controls
+	CParameterBatchWP batch(m_bEditorOpen ? m_pVST3Editor : NULL);
+
 	int nParams = m_pRAFXPlugIn->m_UIControlList.count();
 
 	// iterate
@@ -2227,7 +2436,7 @@ tresult PLUGIN_API Processor::setComponentState(IBStream* fileStream)
 	Processor::getEnumString()
 	helper function for initializing parameters
 */
-char* Processor::getEnumString(char* string, int index)
+char* Processor::getEnumString(const char* string, int index)
 {
 	int nLen = strlen(string);
 	char* copyString = new char[nLen+1];
@@ -2307,7 +2516,7 @@ tresult PLUGIN_API Processor::setParamNormalized(ParamID tag, ParamValue value)
 				if(pUICtrl)
 				{
 					// --- we store COOKED data in presets
-					double dPreset = pUICtrl->dPresetData[program];
+					double dPreset = pUICtrl->pInfo->dPresetData[program];
 
 					// --- normalize, apply log/volt-octave if needed for GUI Warped Variable
 					double dNormalizedValue = getNormalizedRackAFXVariable(dPreset, pUICtrl, fGUIWarpedVariable);
@@ -2325,9 +2534,69 @@ tresult PLUGIN_API Processor::setParamNormalized(ParamID tag, ParamValue value)
 			componentHandler->restartComponent(kParamValuesChanged);
 		}
 	}
+
+	// --- a mode change may have changed the latency
+	if(res == kResultOk)
+		checkLatencyChange(true);
+
 	return res;
 }
 
+/*
+	Processor::getTailSamples()
+	Forwards the plugin's tail length; TAIL_INFINITE maps to kInfiniteTail.
+*/
+uint32 PLUGIN_API Processor::getTailSamples()
+{
+	if(!m_pRAFXPlugIn) return kNoTail;
+
+	UINT uTail = m_pRAFXPlugIn->getTailInSamples();
+	if(uTail == TAIL_INFINITE)
+		return kInfiniteTail;
+
+	return uTail;
+}
+
+/*
+	Processor::checkLatencyChange()
+	Compares the latency the plugin will have at the controller's parameter values with
+	the last value given to the host. Called from the UI-thread entry points only (setup,
+	activation, parameter changes, timer ping) since restartComponent() must not be
+	called from process(). Hosts mirror automation to the controller through
+	setParamNormalized(), usually before process() applies it, so the plugin computes
+	the latency from these values rather than reporting what it last applied; the
+	editor does not need to be open.
+*/
+void Processor::checkLatencyChange(bool bNotifyHost)
+{
+	if(!m_pRAFXPlugIn) return;
+
+	// --- cooked as process() will hand them to setParameter()
+	int nCount = m_pRAFXPlugIn->m_UIControlList.count();
+	m_fControlValues.resize(nCount > 0 ? nCount : 1);
+	for(int i = 0; i < nCount; i++)
+	{
+		CUICtrl* pUICtrl = m_pRAFXPlugIn->m_UIControlList.getAt(i);
+		float fValue = (float)SingleComponentEffect::getParamNormalized(i);
+		if(pUICtrl->bLogSlider)
+			fValue = calcLogPluginValue(fValue);
+		else if(pUICtrl->bExpSlider)
+			fValue = calcVoltOctavePluginValue(fValue, pUICtrl);
+
+		m_fControlValues[i] = m_pRAFXPlugIn->cookParameter(i, fValue);
+	}
+
+	uint32 uLatency = m_pRAFXPlugIn->getLatencyForControls(&m_fControlValues[0]);
+	if(uLatency == m_uLatencyInSamples)
+		return;
+
+	m_uLatencyInSamples = uLatency;
+
+	// --- host will re-query getLatencySamples() (and restart processing if active)
+	if(bNotifyHost && componentHandler)
+		componentHandler->restartComponent(kLatencyChanged);
+}
+
 /*
 	Processor::getUnitInfo()
 	Just returns our info struct; only needed for presets.
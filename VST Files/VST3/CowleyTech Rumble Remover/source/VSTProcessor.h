@@ -50,6 +50,7 @@
 #include "synthfunctions.h"
 #include "plugin.h"
 #include "KnobWP.h"
+#include "ControllerMessages.h"
 #include <vector>
 
 const UINT LCD_VISIBLE			= 25;
@@ -75,6 +76,7 @@ const UINT LATENCY_IN_SAMPLES = 0;
 #define MAX_VOICES 16
 #define OUTPUT_CHANNELS 2 // stereo only!
 #define INPUT_CHANNELS 2 // stereo only!
+#define SYNTH_PROC_BLOCKSIZE 32 // 32 samples per processing block = 0.7 mSec = OK for tactile response WP
 
 namespace Steinberg {
 namespace Vst {
@@ -86,7 +88,7 @@ namespace Sock2VST3 {
 class VST3EditorWP;
 class CRafxCustomView;
 
-class Processor : public SingleComponentEffect, public IMidiMapping, public IUnitInfo, public VST3EditorDelegate
+class Processor : public SingleComponentEffect, public IMidiMapping, public IUnitInfo, public VST3EditorDelegate, public IControllerMessageReceiver
 {
 public:
 	// --- constructor
@@ -147,13 +149,17 @@ public:
 
 	// --- custom editor that createView() returns
 	VST3EditorWP* m_pVST3Editor;
+	std::atomic<bool> m_bEditorOpen;	// between didOpen() and willClose() of m_pVST3Editor; the
+										// audio thread only sends meter frames while it is set
 
 	// --- end. this destroys the RackAFX core
 	tresult PLUGIN_API terminate();
 
-	// --- for sendUpdateGUI()
+	// --- for sendUpdateGUI() and sendParameterUpdate(); pushes the marked parameters
 	void updatePluginParams();
-	virtual tresult receiveText(const char8* text);
+
+	// --- from the editor (timer ping, view rebuilt); a ping drains m_AudioMessages
+	virtual void receiveMessage(const controllerMessage& message);
 
 	// --- helper function for serialization
 	tresult PLUGIN_API setParamNormalizedFromFile(ParamID tag, ParamValue value);
@@ -162,10 +168,20 @@ public:
 	tresult PLUGIN_API setComponentState(IBStream* fileStream);
 
 	// --- for RAFX Wrapper
-	char* getEnumString(char* string, int index);
+	char* getEnumString(const char* string, int index);
+
+	// --- for meters; the audio thread feeds the meter engine every frame
+	//     (or once per buffer) and sends a frame per block, the GUI timer
+	//     displays them
+	void initBlockMeters();
+	void meterFrame();
+	void meterBuffer(int32 nFrames, bool bForceOff = false);
+	void updateMeterParams();
 
-	// --- for meters
-	void updateMeters(ProcessData& data, bool bForceOff = false);
+	// --- audio thread, at the end of every process(): ends the meter block,
+	//     sends the frame to the controller while the editor is open and the
+	//     detector values to the host as output parameter changes
+	void sendAudioMessages(ProcessData& data);
 
 	// --- our COM creation method
 	static FUnknown* createInstance(void* context) {return (IAudioProcessor*)new Processor(); }
@@ -203,10 +219,12 @@ public:
 	virtual tresult notifyUnitSelection ();
 	virtual void PLUGIN_API update (FUnknown* changedUnknown, int32 message);
 
-	// --- latency support
-	uint32 m_uLatencyInSamples; // set in constructor with plugin
+	// --- latency/tail support; forwarded from the plugin
+	uint32 m_uLatencyInSamples; // last value reported to the host
 	virtual uint32 PLUGIN_API getLatencySamples() {
-		return m_uLatencyInSamples; } 
+		return m_uLatencyInSamples; }
+	virtual uint32 PLUGIN_API getTailSamples();
+	void checkLatencyChange(bool bNotifyHost);
 
 	// --- define the IMidiMapping interface
 	OBJ_METHODS(Processor, SingleComponentEffect)
@@ -222,8 +240,20 @@ private:
 	double m_dJoystickY;
 	bool m_bPlugInSideBypass;
 	std::vector<int> meters;
+	std::vector<float*> meterValues;		// the plug-in's meter variables
+	CMeterEngine meterEngine;				// every meter's ballistics
+	CControllerMessageQueue m_AudioMessages;	// audio thread -> controller
+	meterFrameMessage m_MeterFrame;			// where a block goes when there is no one to send it to
 	CRafxCustomView* m_pRafxCustomView;
 	bool m_bHasSidechain;
+	UINT m_uDirtyParams[PARAM_DIRTY_MAX];	// updatePluginParams() scratch
+	std::vector<float> m_fControlValues;	// checkLatencyChange() scratch
+
+	// --- silent inputs for synths; per-instance so that instances running on
+	//     different host threads never share these cache lines
+	float m_fDummyInputL[SYNTH_PROC_BLOCKSIZE];
+	float m_fDummyInputR[SYNTH_PROC_BLOCKSIZE];
+	float* m_pDummyInputPtr[2];
 
 protected:
 	// --- IUnitInfo
@@ -235,8 +265,8 @@ protected:
 	ParameterContainer LCDparameters;
 	CKnobWP* m_pAlphaWheelKnob;
 
-	// --- for new RAFX GUI Customization API
-	VSTGUI_VIEW_INFO guiInfoStruct;
+	// --- for new RAFX GUI Customization API; a fresh struct per showGUI() call
+	void initGUIInfo(VSTGUI_VIEW_INFO& guiInfoStruct, unsigned int uMessage);
 
 	// --- v6.6 for log/exp controls
 	static inline float fastpow2 (float p)
@@ -10,6 +10,11 @@ CVuMeterWP::CVuMeterWP(const CRect& size, CBitmap* onBitmap, CBitmap* offBitmap,
 	subPixMaps = 80;
 	heightOfOneImage = 65;
 	m_dZero_dB_Frame = 52;
+	m_bLogMeter = false;
+	m_pMeterEngine = NULL;
+	m_uMeterChannel = 0;
+	m_uMeterReading = METER_READING_DETECTOR;
+	m_fEngineValue = 0.0;
 
 	CCoord ht = getOnBitmap()->getHeight();
 	CCoord ht2 = getOffBitmap()->getHeight();
@@ -35,6 +40,82 @@ CVuMeterWP::CVuMeterWP(const CRect& size, CBitmap* onBitmap, CBitmap* offBitmap,
 
 CVuMeterWP::~CVuMeterWP(void)
 {
+	// --- removed() normally did this
+	if(m_pMeterEngine)
+		m_pMeterEngine->removeListener(this);
+}
+
+void CVuMeterWP::setMeterEngine(CMeterEngine* pEngine, UINT uChannel, UINT uReading)
+{
+	if(m_pMeterEngine && isAttached())
+		m_pMeterEngine->removeListener(this);
+
+	m_pMeterEngine = pEngine;
+	m_uMeterChannel = uChannel;
+	m_uMeterReading = uReading < METER_READINGS ? uReading : METER_READING_DETECTOR;
+
+	if(m_pMeterEngine && isAttached())
+		m_pMeterEngine->addListener(this);
+}
+
+bool CVuMeterWP::attached(CView* parent)
+{
+	if(!CVuMeter::attached(parent))
+		return false;
+
+	if(m_pMeterEngine)
+	{
+		m_pMeterEngine->addListener(this);
+		m_fEngineValue = getEngineValue();
+	}
+	return true;
+}
+
+bool CVuMeterWP::removed(CView* parent)
+{
+	if(m_pMeterEngine)
+		m_pMeterEngine->removeListener(this);
+
+	return CVuMeter::removed(parent);
+}
+
+// --- GUI timer, after the engine took in new frames
+void CVuMeterWP::meterDisplayChanged()
+{
+	float fValue = getEngineValue();
+	if(fValue != m_fEngineValue)
+	{
+		m_fEngineValue = fValue;
+		invalid();
+	}
+}
+
+// --- dB from the engine -> METER_MIN_DB..0dB on 0->1; the detector of a linear
+//     meter stays linear, as the RackAFX meters show it
+float CVuMeterWP::getEngineValue()
+{
+	if(m_uMeterReading == METER_READING_DETECTOR && !m_bLogMeter)
+		return fmin(m_pMeterEngine->getDetector(m_uMeterChannel), 1.0);
+
+	float fdB = fmax(METER_MIN_DB, m_pMeterEngine->getReading_dB(m_uMeterChannel, m_uMeterReading));
+	return fmin((fdB - METER_MIN_DB)/-METER_MIN_DB, 1.0);
+}
+
+// --- linear -> METER_MIN_DB..0dB on 0->1, as the RackAFX log meters
+float CVuMeterWP::getDisplayValue()
+{
+	if(m_pMeterEngine)
+		return m_fEngineValue;
+
+	if(!m_bLogMeter)
+		return value;
+
+	if(value <= 0)
+		return 0;
+
+	float fdB = CMeterEngine::fastAmplitudeTodB(value);
+	fdB = fmax(METER_MIN_DB, fdB);
+	return (fdB - METER_MIN_DB)/-METER_MIN_DB;
 }
 
 void CVuMeterWP::setViewSize(const CRect& newSize, bool invalid)
@@ -70,15 +151,9 @@ void CVuMeterWP::draw(CDrawContext *_pContext)
 		CPoint pointOff;
 		CDrawContext *pContext = _pContext;
 
-		bounceValue();
-		
-		float newValue = getOldValue() - decreaseValue;
-		if (newValue < value)
-			newValue = value;
-		setOldValue(newValue);
-
-		// --- apply detector *after* storing value
-		newValue = m_Detector.detect(newValue);
+		// --- no falloff or detection here; that would tie the ballistics
+		//     to the redraw rate
+		float newValue = getDisplayValue();
 
 		if (style & kHorizontal) 
 		{
@@ -143,20 +218,20 @@ void CVuMeterWP::draw(CDrawContext *_pContext)
 	{
 		if(getDrawBackground())
 		{
-			if(value > 1.0 || value < 0.0)
-				int t=0;
+			// --- the needle shows the parameter as-is unless it follows an engine reading
+			float fValue = m_pMeterEngine ? getDisplayValue() : value;
 
 			CPoint where (0, 0);
-			if (value >= 0.f && heightOfOneImage > 0.) 
+			if (fValue >= 0.f && heightOfOneImage > 0.) 
 			{
 				CCoord tmp = heightOfOneImage * (subPixMaps - 1);
 				if(m_bInverted)
 				{
 					double dTop = m_dZero_dB_Frame/subPixMaps;
-					where.v = floor ((dTop - value*dTop) * tmp);
+					where.v = floor ((dTop - fValue*dTop) * tmp);
 				}
 				else
-					where.v = floor (value * tmp);
+					where.v = floor (fValue * tmp);
 				where.v -= (int32_t)where.v % (int32_t)heightOfOneImage;
 			}
 
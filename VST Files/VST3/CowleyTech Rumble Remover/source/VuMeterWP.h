@@ -2,11 +2,11 @@
 //#include "vstgui/vstgui_win32.cpp"
 #include "vstgui/lib/controls/cvumeter.h"
 #include "vstgui/lib/cbitmap.h"
-#include "RackAFXMeterDetector.h"
+#include "pluginconstants.h"
 
 namespace VSTGUI {
 
-class CVuMeterWP : public CVuMeter
+class CVuMeterWP : public CVuMeter, public IMeterDisplayListener
 {
 public:
 	CVuMeterWP(const CRect& size, CBitmap* onBitmap, CBitmap* offBitmap, int32_t nbLed, bool bInverted, bool bAnalogVU, int32_t style = kVertical);
@@ -18,14 +18,18 @@ public:
 	virtual void draw(CDrawContext* pContext) VSTGUI_OVERRIDE_VMETHOD;
 	virtual void setViewSize (const CRect& newSize, bool invalid = true) VSTGUI_OVERRIDE_VMETHOD;
 
-	inline void initDetector(float samplerate, float attack_in_ms, float release_in_ms, bool bAnalogTC, UINT uDetect, bool bLogDetector)
-	{
-		if(m_bAnalogVU)
-			bLogDetector = true;
+	// --- the value arrives with its ballistics already applied on the audio
+	//     thread (see CMeterEngine); this only selects the display scale
+	void setLogMeter(bool bLogMeter) {m_bLogMeter = bLogMeter;}
 
-		m_Detector.init(samplerate, attack_in_ms, release_in_ms, bAnalogTC, uDetect, bLogDetector);
-		m_Detector.prepareForPlay();
-	}
+	// --- show one of the engine's readings (meterReading) instead of the
+	//     parameter value; the view redraws when the engine's display changes
+	//     and never converts to dB itself. NULL: the parameter value, as before
+	void setMeterEngine(CMeterEngine* pEngine, UINT uChannel, UINT uReading);
+
+	virtual void meterDisplayChanged() VSTGUI_OVERRIDE_VMETHOD;
+	virtual bool attached(CView* parent) VSTGUI_OVERRIDE_VMETHOD;
+	virtual bool removed(CView* parent) VSTGUI_OVERRIDE_VMETHOD;
 
 	void setHtOneImage(double d){heightOfOneImage = d;}
 	void setImageCount(double d){subPixMaps = d;}
@@ -37,7 +41,14 @@ protected:
 	double m_dZero_dB_Frame;
 	double heightOfOneImage;
 	double subPixMaps;
+	bool m_bLogMeter;
+
+	CMeterEngine* m_pMeterEngine;
+	UINT m_uMeterChannel;
+	UINT m_uMeterReading;
+	float m_fEngineValue;		// 0..1, from the engine's last display
 
-	CRackAFXMeterDetector m_Detector;
+	float getEngineValue();
+	float getDisplayValue();
 };
 }
\ No newline at end of file
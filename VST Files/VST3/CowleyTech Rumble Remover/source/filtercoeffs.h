@@ -0,0 +1,257 @@
+#pragma once
+#include "pluginconstants.h"
+
+// --- fast filter coefficient math
+//
+//     Drop-in replacements for the libm calls in the biquad coefficient
+//     calculators, for when the cutoff is modulated and the coefficients are
+//     recalculated at control rate. Worst case errors (measured by
+//     tools/FilterCoeffsBench.cpp against double precision libm):
+//
+//     fastTan(x)    relative  3e-7  for x in [0, pi/2), the range the calculators use
+//     fastSin(x)    absolute  3e-7  for |x| up to 1e4
+//     fastCos(x)    absolute  3e-7  for |x| up to 1e4
+//     fastPow10(x)  relative  1e-6  for x in [-6, 6], i.e. +/-120 dB through x = dB/20
+//
+//     which keeps every coefficient within 5e-7 of the double precision value.
+//     They are branch-free selects with no library calls, so the batch loops
+//     below auto-vectorize.
+
+// --- pi split for Cody-Waite range reduction: FAST_PI_HI has 11 significant bits so
+//     k*FAST_PI_HI is exact for |k| < 8192
+#define FAST_PI_HI 3.140625f
+#define FAST_PI_LO 9.67653589793e-4f
+
+// --- round to nearest for |x| < 2^22 without floorf(), which is a library call
+//     (and so blocks vectorization) unless SSE4.1 is enabled
+inline float fastRound(float x)
+{
+	return (x + 12582912.0f) - 12582912.0f;
+}
+
+// --- tan(x): reduce to t in [-pi/2, pi/2], fold |t| > pi/4 with tan(t) = 1/tan(pi/2 - t),
+//     then a [5/4] Pade approximant (rel. error 1.4e-8 on [0, pi/4]); pi/2 - |t| is taken
+//     with the split constant too, since near the pole that difference is all there is
+inline float fastTan(float x)
+{
+	float k = fastRound(x*(float)M_1_PI);
+	float t = (x - k*FAST_PI_HI) - k*FAST_PI_LO;
+
+	float u = fabsf(t);
+	bool bFold = u > (float)M_PI_4;
+	u = bFold ? (0.5f*FAST_PI_HI - u) + 0.5f*FAST_PI_LO : u;
+
+	float u2 = u*u;
+	float num = u*(945.0f - 105.0f*u2 + u2*u2);
+	float den = 945.0f - 420.0f*u2 + 15.0f*u2*u2;
+
+	float r = bFold ? den/num : num/den;
+	return t < 0.0f ? -r : r;
+}
+
+// --- odd Taylor polynomial to x^11 for sin(t), t in [-pi/2, pi/2] (abs. error 5.6e-8)
+inline float fastSinPoly(float t)
+{
+	float t2 = t*t;
+	return t*(1.0f + t2*(-1.6666667e-1f + t2*(8.3333333e-3f + t2*(-1.9841270e-4f + t2*(2.7557319e-6f + t2*(-2.5052108e-8f))))));
+}
+
+// --- sin(x): reduce to t in [-pi, pi], fold to [-pi/2, pi/2] with sin(t) = sin(+/-pi - t)
+inline float fastSin(float x)
+{
+	float k = 2.0f*fastRound(x*(float)(0.5*M_1_PI));
+	float t = (x - k*FAST_PI_HI) - k*FAST_PI_LO;
+
+	t = t > (float)M_PI_2 ? (FAST_PI_HI - t) + FAST_PI_LO : t;
+	t = t < -(float)M_PI_2 ? (-FAST_PI_HI - t) - FAST_PI_LO : t;
+
+	return fastSinPoly(t);
+}
+
+// --- cos(x): reduce to t in [-pi, pi], then cos(t) = sin(pi/2 - |t|); reducing first
+//     keeps the accuracy that sin(x + pi/2) would lose to the addition for large x
+inline float fastCos(float x)
+{
+	float k = 2.0f*fastRound(x*(float)(0.5*M_1_PI));
+	float t = (x - k*FAST_PI_HI) - k*FAST_PI_LO;
+
+	return fastSinPoly((0.5f*FAST_PI_HI - fabsf(t)) + 0.5f*FAST_PI_LO);
+}
+
+// --- 10^x via 2^(x log2(10)): integer part into the exponent bits, fractional part
+//     in [-0.5, 0.5] through a degree 6 Taylor polynomial of e^(f ln2) (rel. error 1.6e-7)
+inline float fastPow10(float x)
+{
+	float p = x*3.3219280948873623f;
+	p = p < -126.0f ? -126.0f : p;
+	p = p > 127.0f ? 127.0f : p;
+
+	float k = fastRound(p);
+	float y = (p - k)*(float)M_LN2;
+	float e = 1.0f + y*(1.0f + y*(0.5f + y*(1.6666667e-1f + y*(4.1666667e-2f + y*(8.3333333e-3f + y*1.3888889e-3f)))));
+
+	union { float f; int i; } scale;
+	scale.i = ((int)k + 127) << 23;
+	return e*scale.f;
+}
+
+// --- batch coefficient calculators
+//
+//     Compute biquad coefficients for uCount cutoffs in one call, written to
+//     separate arrays so each loop vectorizes; use them to fill a coefficient
+//     table or a block of per-sample coefficients for a modulated filter.
+//     The formulas are the same as the CResonantLPF calculate*Coeffs() functions.
+typedef struct
+{
+	float* pA0;
+	float* pA1;
+	float* pA2;
+	float* pB1;
+	float* pB2;
+}biquadCoeffArrays;
+
+// --- 2nd order Butterworth LPF
+inline void calculateB2LPFCoeffsBatch(const float* pCutoff_Hz, UINT uCount, float fSampleRate, const biquadCoeffArrays& coeffs)
+{
+	float fPiOverFs = (float)pi/fSampleRate;
+	for(UINT i = 0; i < uCount; i++)
+	{
+		float C = 1.0f/fastTan(fPiOverFs*pCutoff_Hz[i]);
+		float a0 = 1.0f/(1.0f + (float)M_SQRT2*C + C*C);
+
+		coeffs.pA0[i] = a0;
+		coeffs.pA1[i] = 2.0f*a0;
+		coeffs.pA2[i] = a0;
+		coeffs.pB1[i] = 2.0f*a0*(1.0f - C*C);
+		coeffs.pB2[i] = a0*(1.0f - (float)M_SQRT2*C + C*C);
+	}
+}
+
+// --- 2nd order Butterworth HPF
+inline void calculateB2HPFCoeffsBatch(const float* pCutoff_Hz, UINT uCount, float fSampleRate, const biquadCoeffArrays& coeffs)
+{
+	float fPiOverFs = (float)pi/fSampleRate;
+	for(UINT i = 0; i < uCount; i++)
+	{
+		float C = fastTan(fPiOverFs*pCutoff_Hz[i]);
+		float a0 = 1.0f/(1.0f + (float)M_SQRT2*C + C*C);
+
+		coeffs.pA0[i] = a0;
+		coeffs.pA1[i] = -2.0f*a0;
+		coeffs.pA2[i] = a0;
+		coeffs.pB1[i] = 2.0f*a0*(C*C - 1.0f);
+		coeffs.pB2[i] = a0*(1.0f - (float)M_SQRT2*C + C*C);
+	}
+}
+
+// --- 2nd order Butterworth BPF; BW = fc/Q (as in CResonantLPF)
+inline void calculateB2BPFCoeffsBatch(const float* pCutoff_Hz, UINT uCount, float fQ, float fSampleRate, const biquadCoeffArrays& coeffs)
+{
+	float fPiOverFs = (float)pi/fSampleRate;
+	for(UINT i = 0; i < uCount; i++)
+	{
+		float fc = pCutoff_Hz[i];
+		float BW = fc/fQ;
+		float C = 1.0f/fastTan(fPiOverFs*fc*BW);
+		float D = 2.0f*fastCos(2.0f*fPiOverFs*fc);
+		float a0 = 1.0f/(1.0f + C);
+
+		coeffs.pA0[i] = a0;
+		coeffs.pA1[i] = 0.0f;
+		coeffs.pA2[i] = -a0;
+		coeffs.pB1[i] = -a0*(C*D);
+		coeffs.pB2[i] = a0*(C - 1.0f);
+	}
+}
+
+// --- 2nd order Butterworth BSF; BW = fc/Q (as in CResonantLPF)
+inline void calculateB2BSFCoeffsBatch(const float* pCutoff_Hz, UINT uCount, float fQ, float fSampleRate, const biquadCoeffArrays& coeffs)
+{
+	float fPiOverFs = (float)pi/fSampleRate;
+	for(UINT i = 0; i < uCount; i++)
+	{
+		float fc = pCutoff_Hz[i];
+		float BW = fc/fQ;
+		float C = fastTan(fPiOverFs*fc*BW);
+		float D = 2.0f*fastCos(2.0f*fPiOverFs*fc);
+		float a0 = 1.0f/(1.0f + C);
+
+		coeffs.pA0[i] = a0;
+		coeffs.pA1[i] = -a0*D;
+		coeffs.pA2[i] = a0;
+		coeffs.pB1[i] = -a0*D;
+		coeffs.pB2[i] = a0*(1.0f - C);
+	}
+}
+
+// --- constant Q boost/cut
+inline void calculateConstQCoeffsBatch(const float* pCutoff_Hz, UINT uCount, float fQ, float fBoostCut_dB, float fSampleRate, const biquadCoeffArrays& coeffs)
+{
+	float fPiOverFs = (float)pi/fSampleRate;
+	float Vo = fastPow10(fBoostCut_dB/20.0f);
+	bool bBoost = fBoostCut_dB >= 0.0f;
+
+	for(UINT i = 0; i < uCount; i++)
+	{
+		float K = fastTan(fPiOverFs*pCutoff_Hz[i]);
+		float KK = K*K;
+
+		float d0 = 1.0f + (1.0f/fQ)*K + KK;
+		float e0 = 1.0f + (1.0f/(Vo*fQ))*K + KK;
+		float alpha = 1.0f + (Vo/fQ)*K + KK;
+		float beta = 2.0f*(KK - 1.0f);
+		float gamma = 1.0f - (Vo/fQ)*K + KK;
+		float delta = 1.0f - (1.0f/fQ)*K + KK;
+		float eta = 1.0f - (1.0f/(Vo*fQ))*K + KK;
+
+		coeffs.pA0[i] = bBoost ? alpha/d0 : d0/e0;
+		coeffs.pA1[i] = bBoost ? beta/d0 : beta/e0;
+		coeffs.pA2[i] = bBoost ? gamma/d0 : delta/e0;
+		coeffs.pB1[i] = bBoost ? beta/d0 : beta/e0;
+		coeffs.pB2[i] = bBoost ? delta/d0 : eta/e0;
+	}
+}
+
+// --- non-constant Q parametric; the wet/dry mix is c0 = 10^(dB/20) - 1, d0 = 1
+inline void calculateParametricCoeffsBatch(const float* pCutoff_Hz, UINT uCount, float fQ, float fBoostCut_dB, float fSampleRate, const biquadCoeffArrays& coeffs)
+{
+	float fTwoPiOverFs = 2.0f*(float)pi/fSampleRate;
+	float mu = fastPow10(fBoostCut_dB/20.0f);
+	float nose = 4.0f/(1.0f + mu);
+
+	for(UINT i = 0; i < uCount; i++)
+	{
+		float theta_c = fTwoPiOverFs*pCutoff_Hz[i];
+		float tanArg = theta_c/(2.0f*fQ);
+		tanArg = tanArg >= (float)(pi/2.0) ? (float)(0.95*pi/2.0) : tanArg;
+
+		float T = nose*fastTan(tanArg);
+		float fBeta = 0.5f*((1.0f - T)/(1.0f + T));
+		float fGamma = (0.5f + fBeta)*fastCos(theta_c);
+		float fAlpha = 0.5f - fBeta;
+
+		coeffs.pA0[i] = fAlpha;
+		coeffs.pA1[i] = 0.0f;
+		coeffs.pA2[i] = -fAlpha;
+		coeffs.pB1[i] = -2.0f*fGamma;
+		coeffs.pB2[i] = 2.0f*fBeta;
+	}
+}
+
+// --- Nth order Butterworth HPF as a cascade of uOrder/2 biquads (uOrder even, 2..16),
+//     written as a0, a1, a2, b1, b2 per section; section k has Q = 1/(2cos((2k + 1)pi/2N))
+inline void calculateButterworthHPFCascade(float fCutoff_Hz, float fSampleRate, UINT uOrder, float* pCoeffs)
+{
+	double C = tan(pi*fCutoff_Hz/fSampleRate);
+	for(UINT k = 0; k < uOrder/2; k++)
+	{
+		double dInvQ = 2.0*cos((2.0*k + 1.0)*pi/(2.0*uOrder));
+		double a0 = 1.0/(1.0 + dInvQ*C + C*C);
+
+		pCoeffs[5*k + 0] = a0;
+		pCoeffs[5*k + 1] = -2.0*a0;
+		pCoeffs[5*k + 2] = a0;
+		pCoeffs[5*k + 3] = 2.0*a0*(C*C - 1.0);
+		pCoeffs[5*k + 4] = a0*(1.0 - dInvQ*C + C*C);
+	}
+}
@@ -3,6 +3,33 @@
 // for MacOS VST only, ignore otherwise
 extern char gPath;
 
+// --- default joystick MIDI controls, shared by all instances
+static constexpr CUICtrlInfo g_JoystickControls[] =
+{
+	// --- joystick X
+	{0, 0, nonData, 0.0, 0.0, false, false,
+	 0, 0, 0, 0,
+	 "MIDI JS X", "", "", "", "",
+	 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	 false, false, 176, 16, 0,
+	 -1, -1,
+	 false, false, false, DETECT_MODE_RMS, csVU, 10.000000, 500.000000,
+	 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	 {0}, {0.000000}
+	},
+	// --- joystick Y
+	{0, 0, nonData, 0.0, 0.0, false, false,
+	 0, 0, 0, 0,
+	 "MIDI JS Y", "", "", "", "",
+	 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	 false, false, 176, 17, 0,
+	 -1, -1,
+	 false, false, false, DETECT_MODE_RMS, csVU, 10.000000, 500.000000,
+	 {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+	 {0}, {0.000000}
+	},
+};
+
 CPlugIn::CPlugIn()
 {
 	// Normal Construction Stuff
@@ -23,6 +50,9 @@ CPlugIn::CPlugIn()
 	memset(&m_uLabelCY[0], 0, PLUGIN_CONTROL_THEME_SIZE*sizeof(UINT));
 
 	m_bOutputOnlyPlugIn = false;
+	m_uLatencyInSamples = 0;
+	m_bLatencySet = false;
+	m_uTailInSamples = 0;
 	m_uMaxInputChannels = 2;
 	m_uMaxOutputChannels = 2;
 
@@ -84,19 +114,8 @@ CPlugIn::CPlugIn()
 	m_pVectorJSProgram = new float[MAX_JS_PROGRAM_STEPS*MAX_JS_PROGRAM_STEP_VARS];
 	memset(m_pVectorJSProgram, 0, MAX_JS_PROGRAM_STEPS*MAX_JS_PROGRAM_STEP_VARS*sizeof(float));
 
-	m_JS_XCtrl.cControlName = "MIDI JS X";
-	m_JS_XCtrl.uControlId = 0;
-	m_JS_XCtrl.bMIDIControl = false;
-	m_JS_XCtrl.uMIDIControlCommand = 176;
-	m_JS_XCtrl.uMIDIControlName = 16;
-	m_JS_XCtrl.uMIDIControlChannel = 0;
-
-	m_JS_YCtrl.cControlName = "MIDI JS Y";
-	m_JS_YCtrl.uControlId = 0;
-	m_JS_YCtrl.bMIDIControl = false;
-	m_JS_YCtrl.uMIDIControlCommand = 176;
-	m_JS_YCtrl.uMIDIControlName = 17;
-	m_JS_YCtrl.uMIDIControlChannel = 0;
+	m_JS_XCtrl.setInfo(&g_JoystickControls[0]);
+	m_JS_YCtrl.setInfo(&g_JoystickControls[1]);
 
 	for(int i=0; i<PRESET_COUNT; i++)
 	{
@@ -223,6 +242,18 @@ CUICtrl* CPlugIn::getUICtrlByControlID(UINT uID)
 	return NULL;
 }
 
+int CPlugIn::getUICtrlIndexByControlID(UINT uID)
+{
+	int nCount = m_UIControlList.count();
+	for(int i=0; i<nCount; i++)
+	{
+		if(m_UIControlList.getAt(i)->uControlId == uID)
+			return i;
+	}
+
+	return -1;
+}
+
 //-----------------------------------------------------------------------------------------
 // sider moved between 0 and 1
 //
@@ -267,6 +298,17 @@ void CPlugIn::setParameter (UINT index, float value)
 	userInterfaceChange(pUICtrl->uControlId);
 }
 
+//-----------------------------------------------------------------------------------------
+// the cooked value of a 0->1 slider, without storing it or calling userInterfaceChange()
+float CPlugIn::cookParameter(UINT index, float value)
+{
+	CUICtrl* pUICtrl = m_UIControlList.getAt(index);
+	if(!pUICtrl)
+		return 0.0;
+
+	return calcDisplayVariable(pUICtrl->fUserDisplayDataLoLimit, pUICtrl->fUserDisplayDataHiLimit, value);
+}
+
 //-----------------------------------------------------------------------------------------
 // return the 0->1 version of the variable
 float CPlugIn::getParameter (UINT index)
@@ -342,6 +384,20 @@ void CPlugIn::sendUpdateGUI()
 		SendMessage(m_hParentWnd, SEND_UPDATE_GUI, 0, 0);
 #endif
     m_uPlugInEx[3] = 1; // flag
+	m_ParamDirty.setAll();
+}
+
+void CPlugIn::sendParameterUpdate(UINT uControlID)
+{
+	int nCount = m_UIControlList.count();
+	for(int i=0; i<nCount; i++)
+	{
+		if(m_UIControlList.getAt(i)->uControlId == uControlID)
+		{
+			m_ParamDirty.set(i);
+			return;
+		}
+	}
 }
 
 // main message handler
@@ -383,6 +439,63 @@ bool __stdcall CPlugIn::processAuxInputBus(audioProcessData* pAudioProcessData)
 	return true;
 }
 
+// --- latency in samples; falls back to the fixed value RackAFX writes
+//     into m_fPlugInEx[0] for plugins that never call setLatencyInSamples(),
+//     so once a plugin has set it, setting 0 reports 0
+UINT __stdcall CPlugIn::getLatencyInSamples()
+{
+	if(m_bLatencySet)
+		return m_uLatencyInSamples;
+
+	return m_fPlugInEx[0] > 0.f ? (UINT)m_fPlugInEx[0] : 0;
+}
+
+// --- tail in samples; 0 = output goes silent with the input
+UINT __stdcall CPlugIn::getTailInSamples()
+{
+	return m_uTailInSamples;
+}
+
+// --- no control changes the latency
+UINT __stdcall CPlugIn::getLatencyForControls(const float*)
+{
+	return getLatencyInSamples();
+}
+
+void CPlugIn::setLatencyInSamples(UINT uSamples)
+{
+	m_uLatencyInSamples = uSamples;
+	m_bLatencySet = true;
+}
+
+void CPlugIn::setTailInSamples(UINT uSamples)
+{
+	m_uTailInSamples = uSamples;
+}
+
+// --- no analyzer; the view is not created
+CSpectrumAnalyzer* __stdcall CPlugIn::getSpectrumAnalyzer()
+{
+	return NULL;
+}
+
+// --- no response to overlay
+CResponseCurve* __stdcall CPlugIn::getResponseCurve()
+{
+	return NULL;
+}
+
+// --- no stereo analysis; the views are not created
+CStereoAnalyzer* __stdcall CPlugIn::getStereoAnalyzer(bool)
+{
+	return NULL;
+}
+
+bool __stdcall CPlugIn::getFilterResponse(CFilterDescription&)
+{
+	return false;
+}
+
 #if defined _WINDOWS || defined _WINDLL
 
 void CPlugIn::sendStatusWndText(char* pText)
@@ -399,6 +512,9 @@ void CPlugIn::sendSliderCtrlUpdate(UINT uID)
 {
 	if(m_hParentWnd)
 		PostMessage(m_hParentWnd, UPDATE_SLIDER_CONTROL, 0, (LPARAM)uID);
+
+	// --- and the VST3 wrapper's GUI
+	sendParameterUpdate(uID);
 }
 
 void CPlugIn::sendAssignableButtonClick(UINT uID)
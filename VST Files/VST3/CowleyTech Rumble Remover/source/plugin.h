@@ -17,6 +17,11 @@
 // RackAFX Includes
 #include "pluginconstants.h"
 
+class CSpectrumAnalyzer;
+class CStereoAnalyzer;
+class CResponseCurve;
+class CFilterDescription;
+
 // RackAFX abstract base class for RackAFX Plug-Ins
 class CPlugIn
 {
@@ -95,6 +100,12 @@ public:
 	// 17. Update the GUI - my internal variables changed; make the GUI reflect this
 	void sendUpdateGUI();
 
+	// 17b. just one control's variable changed; any thread. The VST3 wrapper pushes
+	//      only the controls marked here (sendUpdateGUI() marks them all) on its
+	//      next GUI timer tick
+	void sendParameterUpdate(UINT uControlID);
+	CParamDirtyBits m_ParamDirty;
+
 #if defined _WINDOWS || defined _WINDLL
 	// 18. Output text to the status window
 	void sendStatusWndText(char* pText);
@@ -126,6 +137,35 @@ public:
 	// --- process aux inputs 
 	virtual bool __stdcall processAuxInputBus(audioProcessData* pAudioProcessData);
 
+	// --- latency and tail, reported to the host by the VST3 wrapper
+	//     call setLatencyInSamples() from userInterfaceChange() or prepareForPlay() when a
+	//     mode (lookahead, linear phase, oversampling) changes it; the wrapper tells the host
+	virtual UINT __stdcall getLatencyInSamples();
+	virtual UINT __stdcall getTailInSamples();
+	void setLatencyInSamples(UINT uSamples);
+	void setTailInSamples(UINT uSamples); // TAIL_INFINITE = never stops ringing
+
+	// --- the latency once the controls hold pCookedValues, one per control list
+	//     index as cookParameter() gives them; the wrapper asks with its own copies
+	//     of the parameters, which change before process() hands them to the plugin,
+	//     so a latency change reaches the host without waiting for the audio thread.
+	//     Override it if a control changes the latency; the default assumes none does
+	virtual UINT __stdcall getLatencyForControls(const float* pCookedValues);
+
+	// --- for the VST3 wrapper's "SpectrumView": the analyzer the plugin feeds from
+	//     processAudioFrame() and the response curve of its filter; the defaults have
+	//     neither
+	virtual CSpectrumAnalyzer* __stdcall getSpectrumAnalyzer();
+	virtual CResponseCurve* __stdcall getResponseCurve();
+
+	// --- for "StereoInputView"/"StereoOutputView": the analyzers the plugin feeds
+	//     its input and its output to; the default has none
+	virtual CStereoAnalyzer* __stdcall getStereoAnalyzer(bool bOutput);
+
+	// --- called back by the response curve (GUI thread) after the plugin invalidated
+	//     it: describe the current filter; false = nothing to show
+	virtual bool __stdcall getFilterResponse(CFilterDescription& description);
+
 	// m_bUserCustomGUI
 	// NOTE: DEPRACATED in v6.6 -- no longer used, see www.willpirkle.com for instructions on pure-custom GUIs
 	bool m_bUserCustomGUI;
@@ -170,7 +210,9 @@ public:
 	// to a RackAFX Kernel
 	CUIControlList m_UIControlList;
 	CUICtrl* getUICtrlByControlID(UINT uID);
+	int getUICtrlIndexByControlID(UINT uID); // -1 if none
 	void setParameter(UINT index, float value);
+	float cookParameter(UINT index, float value); // what setParameter() would store
 	float getParameter(UINT index);
 
 	// for VST Preset Support
@@ -198,6 +240,11 @@ public:
 	UINT m_uMaxInputChannels;
 	UINT m_uMaxOutputChannels;
 
+	// latency and tail (samples); see getLatencyInSamples()
+	UINT m_uLatencyInSamples;
+	bool m_bLatencySet;		// setLatencyInSamples() was called; m_fPlugInEx[0] no longer counts
+	UINT m_uTailInSamples;
+
 	// for track pad
 	int m_uX_TrackPadIndex;
 	int m_uY_TrackPadIndex;
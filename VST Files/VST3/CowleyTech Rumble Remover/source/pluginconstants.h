@@ -12,6 +12,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <atomic>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <string>
 
 
 
@@ -201,6 +206,9 @@ const UINT UPDATE_GUI = 3; // sendUpdateGUI() uses this; user does not need to b
 const UINT ENABLE_SIDECHAIN_VSTAU = 4; // VSTAU sidechain enable
 // -------------------------------------------------------------------------
 
+// --- getTailInSamples() return value for plugins that never stop ringing
+const UINT TAIL_INFINITE = 0xFFFFFFFF;
+
 // custom messages
 #define SEND_STATUS_WND_MESSAGE		WM_USER + 3000
 #define UPDATE_SLIDER_CONTROL		WM_USER + 3001
@@ -474,7 +482,7 @@ inline char* doubleToString(double value, int nSigDigits)
 //		this returns a char* that is the Path to the file: this.wav
 //									located in the folder: test
 //										 which is located: inside the Directory containing your PlugIn
-inline char* addStrings(char* pString1, char* pString2)
+inline char* addStrings(const char* pString1, const char* pString2)
 {
 	int n = strlen(pString1);
 	int m = strlen(pString2);
@@ -665,6 +673,758 @@ public:
 };
 
 
+// --- State Variable Filter ---
+// Zero-delay-feedback (topology-preserving transform) 2nd order state variable
+// filter with LP/HP/BP/notch outputs.
+//
+// Unlike the direct form CBiQuad, the two integrator states hold the actual
+// signal energy, so the cutoff can be changed every sample without clicks or
+// blowing up. An update is one tan() (fastTan) and one divide; for a bilinear
+// design with the same cutoff and Q the responses are identical to the biquad.
+//
+//     g = tan(pi*fc/fs), k = 1/Q
+//     hp = (x - (g + k)*s1 - s2)/(1 + g*(g + k))
+//     bp = g*hp + s1,  lp = g*bp + s2
+//     s1 = 2*bp - s1,  s2 = 2*lp - s2
+//
+// The BPF output is k*bp, which has unity gain at the center frequency.
+enum {SVF_LPF, SVF_HPF, SVF_BPF, SVF_NOTCH};
+
+// --- frames per internal coefficient pass in processBlock() with a cutoff stream
+const UINT SVF_BLOCK_SIZE = 64;
+
+class CStateVariableFilter
+{
+public:
+	CStateVariableFilter(void);
+	~CStateVariableFilter(void);
+
+	void setSampleRate(float fSampleRate);
+	void setQ(float fQ);
+	void setOutputType(UINT uType);
+
+	// --- one fastTan per call; fine to call every sample
+	void setCutoff(float fCutoff_Hz);
+
+	// --- set the prewarped g = tan(pi*fc/fs) directly, e.g. when ramping it
+	void setCoefficients(float fG)
+	{
+		m_fG = fG;
+		m_fGK = fG + m_fK;
+		m_fA1 = 1.0/(1.0 + fG*m_fGK);
+	}
+
+	float getG(){return m_fG;}
+
+	void flushDelays(){m_fZ1 = 0; m_fZ2 = 0;}
+
+	// --- all three outputs for input xn; notch is lp + hp
+	void doSVF(float xn, float& lp, float& hp, float& bp)
+	{
+		hp = (xn - m_fGK*m_fZ1 - m_fZ2)*m_fA1;
+		float v1 = m_fG*hp;
+		bp = v1 + m_fZ1;
+		float v2 = m_fG*bp;
+		lp = v2 + m_fZ2;
+
+		m_fZ1 = bp + v1;
+		m_fZ2 = lp + v2;
+
+		// underflow check
+		if(m_fZ1 > 0.0 && m_fZ1 < FLT_MIN_PLUS) m_fZ1 = 0;
+		if(m_fZ1 < 0.0 && m_fZ1 > FLT_MIN_MINUS) m_fZ1 = 0;
+		if(m_fZ2 > 0.0 && m_fZ2 < FLT_MIN_PLUS) m_fZ2 = 0;
+		if(m_fZ2 < 0.0 && m_fZ2 > FLT_MIN_MINUS) m_fZ2 = 0;
+	}
+
+	// --- the selected output type for input xn
+	float doSVF(float xn)
+	{
+		float lp, hp, bp;
+		doSVF(xn, lp, hp, bp);
+		return m_fMixLP*lp + m_fMixBP*bp + m_fMixHP*hp;
+	}
+
+	// --- block API
+	//
+	// Fixed coefficients:
+	void processBlock(const float* pInput, float* pOutput, UINT uFrames);
+
+	// Per-sample cutoff: coefficients for SVF_BLOCK_SIZE frames at a time are
+	// computed in one vectorized pass, then the recursion runs over them
+	void processBlock(const float* pInput, float* pOutput, const float* pCutoff_Hz, UINT uFrames);
+
+	// The two halves of the above, so that several filters (e.g. the channels
+	// of a stereo pair) can share one coefficient pass: g and 1/(1 + g(g + k))
+	// for each cutoff, then the recursion over precomputed arrays. The filter's
+	// own g is left at the last value so doSVF() carries on from there.
+	void calculateCoefficients(const float* pCutoff_Hz, float* pG, float* pA1, UINT uFrames);
+	void processBlock(const float* pInput, float* pOutput, const float* pG, const float* pA1, UINT uFrames);
+
+protected:
+	float m_fZ1; // integrator states
+	float m_fZ2;
+
+	float m_fG;
+	float m_fK;
+	float m_fGK; // g + k
+	float m_fA1;
+
+	// --- output mix: y = lp*m_fMixLP + bp*m_fMixBP + hp*m_fMixHP
+	float m_fMixLP;
+	float m_fMixBP;
+	float m_fMixHP;
+
+	float m_fSampleRate;
+	float m_fCutoff_Hz;
+	float m_fQ;
+	UINT m_uOutputType;
+};
+
+
+// --- BiQuad Bank ---
+// Many independent mono biquads (e.g. the same HPF on every channel of a
+// console, each with its own cutoff) run in one call, with the same direct
+// form I difference equation as CBiQuad. Coefficients and states
+// live in 32-byte aligned SoA arrays, one lane per channel padded to a multiple
+// of BIQUAD_BANK_LANES, and each group of 8 channels is processed together:
+// one AVX vector (two SSE vectors, or a plain loop) per sample. Padding lanes
+// have zero coefficients and output silence.
+//
+// The non-interleaved process() transposes BIQUAD_BANK_BLOCK frames of each
+// group into a lane-interleaved tile and back; frame-major interleaved buffers
+// whose channel count is a multiple of 8 are processed in place.
+const UINT BIQUAD_BANK_LANES = 8;
+const UINT BIQUAD_BANK_BLOCK = 64;
+
+class CBiQuadBank
+{
+public:
+	CBiQuadBank(void);
+	~CBiQuadBank(void);
+
+	// --- allocates for uChannels and flushes; call from prepareForPlay()
+	void init(UINT uChannels);
+	UINT getChannelCount(){return m_uChannels;}
+
+	void setCoefficients(UINT uChannel, float a0, float a1, float a2, float b1, float b2);
+
+	// --- 2nd order Butterworth HPF on every channel, one batch calculation
+	void setHPFCutoffs(const float* pCutoff_Hz, float fSampleRate);
+
+	void flushDelays();
+
+	// --- one buffer per channel
+	void process(float** ppInput, float** ppOutput, UINT uFrames);
+
+	// --- frame-major: channel c of frame n is at [n*uChannels + c]
+	void processInterleaved(const float* pInput, float* pOutput, UINT uFrames);
+
+protected:
+	// --- uFrames of one 8-lane group; lane l of frame n is at p[n*uStride + l]
+	void processGroup(UINT uGroup, const float* pInput, float* pOutput, UINT uStride, UINT uFrames);
+	void flushDenormals();
+	void destroy();
+
+	UINT m_uChannels;
+	UINT m_uGroups;
+	UINT m_uLanes;		// m_uGroups*BIQUAD_BANK_LANES
+
+	float* m_pMemory;	// one allocation, the arrays below are aligned into it
+	float* m_pA0;
+	float* m_pA1;
+	float* m_pA2;
+	float* m_pB1;
+	float* m_pB2;
+	float* m_pX1;		// direct form I states, contiguous
+	float* m_pX2;
+	float* m_pY1;
+	float* m_pY2;
+
+	// --- transposition tiles for process()
+	float m_fTileIn[BIQUAD_BANK_BLOCK*BIQUAD_BANK_LANES];
+	float m_fTileOut[BIQUAD_BANK_BLOCK*BIQUAD_BANK_LANES];
+};
+
+
+// --- Parallel IIR ---
+// A cascade of biquads re-expressed as a sum of 2nd order sections by partial
+// fraction expansion:
+//
+//     H(z) = c0 + sum(k) (d0k + d1k z^-1)/(1 + b1k z^-1 + b2k z^-2)
+//
+// The sections all see the same input and are independent, so they run side
+// by side in SIMD lanes (PARALLEL_IIR_MAX_SECTIONS = 8 lanes: one AVX or two
+// SSE vectors) instead of one after another, which is what limits a cascade
+// on a single channel. Each section keeps the poles of one biquad of the
+// cascade; the expansion is done in double and needs distinct poles, so
+// repeated sections (e.g. a Linkwitz-Riley pair) cannot be converted.
+//
+// Higher orders and lower cutoffs put the poles closer together and the
+// sections' outputs grow larger before they cancel in the sum, so the float
+// round-off grows faster than the cascade's. setFromCascade() estimates both
+// from the sections' L2 norms and refuses the conversion where the parallel
+// form would be the noisier; the caller keeps its cascade. For Butterworth
+// HPFs at 48 kHz (tools/ParallelIIRBench.cpp) that accepts up to 12th order at
+// 20-40 Hz (-52 vs -45 dB re output RMS at 12th/20 Hz), 10th at 100 Hz and
+// 6th at 1 kHz, and nothing above 12th. Single channel it runs 4.3x faster
+// than the cascade at 4th order and 9x at 12th.
+const UINT PARALLEL_IIR_MAX_SECTIONS = 8;
+
+class CParallelIIR
+{
+public:
+	CParallelIIR(void);
+	~CParallelIIR(void);
+
+	// --- convert uSections biquads, a0, a1, a2, b1, b2 each (the CBiQuad
+	//     coefficients), applied in cascade; returns false and leaves the filter
+	//     unchanged if there are too many sections, the poles are not distinct
+	//     and stable, or the parallel form would be less accurate than the cascade
+	bool setFromCascade(const float* pCoeffs, UINT uSections);
+
+	UINT getSectionCount(){return m_uSections;}
+
+	void flushDelays();
+
+	float doParallelIIR(float xn);
+	void processBlock(const float* pInput, float* pOutput, UINT uFrames);
+
+protected:
+	// --- per section lane; unused lanes are all zero
+	float m_fD0[PARALLEL_IIR_MAX_SECTIONS];
+	float m_fD1[PARALLEL_IIR_MAX_SECTIONS];
+	float m_fB1[PARALLEL_IIR_MAX_SECTIONS];
+	float m_fB2[PARALLEL_IIR_MAX_SECTIONS];
+	float m_fY1[PARALLEL_IIR_MAX_SECTIONS];
+	float m_fY2[PARALLEL_IIR_MAX_SECTIONS];
+
+	float m_fC0;	// direct term
+	float m_fX1;	// input delay, shared by all sections
+	UINT m_uSections;
+};
+
+
+// --- Dynamic HPF ---
+// 2nd order Butterworth high-pass whose cutoff rises from the min toward the max
+// cutoff as the low band envelope climbs past the threshold.
+//
+// The filter is a CStateVariableFilter pair, so the cutoff can move at audio
+// rate. Its prewarped g is tabled at DYN_HPF_TABLE_SIZE log (octave) spaced
+// cutoffs between the min and max, rebuilt only when the range or sample rate
+// changes. Every DYN_HPF_CONTROL_RATE samples the detector level picks a point
+// along the table and the interpolated g becomes the target; the filters' g is
+// then ramped linearly to it sample by sample, so the audio path needs no tan().
+//
+// The detector runs on a band-limited (low-passed at the max cutoff) mono copy
+// of the input, or on the sidechain when one is supplied.
+const UINT DYN_HPF_TABLE_SIZE = 128;
+const UINT DYN_HPF_CONTROL_RATE = 16;
+
+class CDynamicHPF
+{
+public:
+	CDynamicHPF(void);
+	~CDynamicHPF(void);
+
+	// --- call from prepareForPlay(), before any audio; builds the g table and resets
+	void init(float fSampleRate);
+
+	// --- updates the cutoff scale and the detector band-limit if the range changed
+	void setCutoffRange(float fMinCutoff_Hz, float fMaxCutoff_Hz);
+
+	// --- cutoff leaves the min at the threshold and reaches the max fRange_dB above it
+	void setThreshold(float fThreshold_dB, float fRange_dB);
+	void setAttackRelease(float fAttack_ms, float fRelease_ms);
+
+	void reset();
+
+	// --- uChannels (1 or 2) in and out; pSidechain = NULL detects on the input
+	void processFrame(float* pInput, float* pOutput, UINT uChannels, float* pSidechain, UINT uSidechainChannels);
+
+	// --- current cutoff, for metering
+	float getCutoff();
+
+	// --- where the cutoff is along its log scale, 0 = min, 1 = max; no math, so it
+	//     can be polled per frame to see whether the cutoff moved
+	float getAmount(){return m_fAmount;}
+
+protected:
+	// --- g table over [min, max] and the detector band-limit
+	void buildTable();
+
+	// --- control rate: detector level -> table position -> g ramp target
+	void updateCoefficients(float fEnvelope);
+
+	// --- interpolated table g for fAmount in [0, 1] along the log cutoff scale
+	float lookupG(float fAmount);
+
+	CStateVariableFilter m_Filter[2];
+	CBiQuad m_DetectorLPF;
+	CEnvelopeDetector m_Detector;
+
+	float m_fSampleRate;
+	float m_fMinCutoff_Hz;
+	float m_fMaxCutoff_Hz;
+	float m_fThreshold_dB;
+	float m_fRange_dB;
+	float m_fAttackTime_ms;
+	float m_fReleaseTime_ms;
+	float m_fLog10Range;	// log10(max/min)
+	float m_fAmount;		// 0 = min cutoff, 1 = max cutoff
+	float m_fGTable[DYN_HPF_TABLE_SIZE + 1];	// last entry repeated, for the interpolation at 1
+	float m_fG;				// ramped to the target cutoff over each control block
+	float m_fGIncrement;
+	UINT m_uControlCount;
+};
+
+
+// --- Linkwitz-Riley Crossover ---
+// 2 to 4 band, 4th order (LR4) crossover with per-band gain and mute; the bands
+// sum back to an allpass, so with all gains at 0 dB the output is the input
+// with the crossovers' phase shift and a flat magnitude.
+//
+// Every band is built from the input in parallel as one cascade of biquads,
+// one LR4 "unit" per crossover: band b takes the high-pass of the crossovers
+// below it, the low-pass of its own crossover and the allpass (the LR4 LP + HP
+// sum, a 2nd order allpass) of the crossovers above it, e.g. for 3 bands
+//
+//     band 0 = LP(f0) AP(f1), band 1 = HP(f0) LP(f1), band 2 = HP(f0) HP(f1)
+//
+// so every band has the same depth and all bands of both channels run through
+// the same sequence of sections in lockstep: one lane per band/channel, 4
+// lanes per SSE vector. The allpass units use their second biquad slot as a
+// pass-through.
+//
+// Setters only record the change; the coefficients (including the allpass
+// compensation) are recalculated once, at the start of the next block or frame.
+// Band gains are smoothed.
+const UINT LR_XOVER_MAX_BANDS = 4;
+const UINT LR_XOVER_LANES = 2*LR_XOVER_MAX_BANDS;				// band*2 + channel
+const UINT LR_XOVER_MAX_SECTIONS = 2*(LR_XOVER_MAX_BANDS - 1);	// 2 biquads per crossover
+
+class CLinkwitzRileyCrossover
+{
+public:
+	CLinkwitzRileyCrossover(void);
+	~CLinkwitzRileyCrossover(void);
+
+	// --- call from prepareForPlay(); resets
+	void init(float fSampleRate);
+
+	// --- 2 to 4 bands; resets the filters if the count changes
+	void setBandCount(UINT uBands);
+	UINT getBandCount(){return m_uBands;}
+
+	// --- crossover uIndex sits between band uIndex and uIndex + 1; they are
+	//     sorted when the coefficients are calculated
+	void setCrossover(UINT uIndex, float fFrequency_Hz);
+
+	void setBandGain(UINT uBand, float fGain_dB);
+	void setBandMute(UINT uBand, bool bMute);
+
+	void reset();
+
+	// --- uChannels (1 or 2) in and out
+	void processFrame(const float* pInput, float* pOutput, UINT uChannels);
+
+	// --- non-interleaved buffers
+	void processBlock(float** ppInput, float** ppOutput, UINT uChannels, UINT uFrames);
+
+protected:
+	void updateCoefficients();
+	void updateGains();
+	void flushDenormals();
+
+	// --- coefficients and TDF-II states: [section][lane]
+	float m_fA0[LR_XOVER_MAX_SECTIONS][LR_XOVER_LANES];
+	float m_fA1[LR_XOVER_MAX_SECTIONS][LR_XOVER_LANES];
+	float m_fA2[LR_XOVER_MAX_SECTIONS][LR_XOVER_LANES];
+	float m_fB1[LR_XOVER_MAX_SECTIONS][LR_XOVER_LANES];
+	float m_fB2[LR_XOVER_MAX_SECTIONS][LR_XOVER_LANES];
+	float m_fZ1[LR_XOVER_MAX_SECTIONS][LR_XOVER_LANES];
+	float m_fZ2[LR_XOVER_MAX_SECTIONS][LR_XOVER_LANES];
+
+	// --- per lane gains: current (smoothed) and target
+	float m_fGain[LR_XOVER_LANES];
+	float m_fTargetGain[LR_XOVER_LANES];
+	float m_fGainSmoothing;
+
+	float m_fCrossover_Hz[LR_XOVER_MAX_BANDS - 1];
+	float m_fBandGain_dB[LR_XOVER_MAX_BANDS];
+	bool m_bBandMute[LR_XOVER_MAX_BANDS];
+
+	float m_fSampleRate;
+	UINT m_uBands;
+	UINT m_uSections;	// 2*(m_uBands - 1)
+	UINT m_uVectors;	// lanes in use/4
+	UINT m_uFrameCount;	// for the denormal flush in processFrame()
+	bool m_bCoeffsDirty;
+	bool m_bGainsDirty;
+};
+
+
+// --- True Peak Limiter ---
+// Output ceiling in dBTP: the peak level is detected on a 4x oversampled copy
+// of the signal (ITU-R BS.1770 style, a 48 tap polyphase interpolator) so the
+// overs between samples are caught, and the gain comes down over a short
+// lookahead before the audio, delayed to match, gets there.
+//
+// Detection runs the 4 phases of both channels side by side, one SIMD lane per
+// phase and channel (8 lanes: one AVX vector or two SSE vectors); the history
+// is kept pre-broadcast so each tap is one multiply-add. The gain computer is
+// a sliding minimum of the required gain over the lookahead, a one-pole
+// release and a moving average over the lookahead, so the gain reaches its
+// target by the time the peak leaves the delay line and never clicks. The
+// delayed audio is scaled by the gain a block at a time in SIMD.
+//
+// Latency is the lookahead (~1.5 ms) plus the interpolator's 5 samples; see
+// getLatencyInSamples(). The interpolated phases sit 1/4 sample apart, so a
+// peak between them can read up to ~0.5 dB low at the top of the band
+// (BS.1770 has the same property); leave that much margin below 0 dBTP.
+const UINT TRUE_PEAK_PHASES = 4;
+const UINT TRUE_PEAK_TAPS = 12;				// per phase
+const UINT TRUE_PEAK_MAX_LOOKAHEAD = 512;	// samples; 1.5 ms up to 192 kHz fits
+const UINT TRUE_PEAK_DELAY_SIZE = 1024;		// power of 2 > max lookahead + interpolator delay
+const UINT TRUE_PEAK_QUEUE_SIZE = 1024;		// power of 2 > max lookahead + 1
+const UINT TRUE_PEAK_BLOCK = 64;
+
+class CTruePeakLimiter
+{
+public:
+	CTruePeakLimiter(void);
+	~CTruePeakLimiter(void);
+
+	// --- call from prepareForPlay(), before any audio; sets the lookahead and
+	//     resets (construction leaves the lines uncleared)
+	void init(float fSampleRate);
+
+	void setCeiling(float fCeiling_dB);
+	void setReleaseTime(float fRelease_ms);
+
+	// --- the audio delay through processFrame()/processBlock()
+	UINT getLatencyInSamples(){return m_uLookahead + TRUE_PEAK_TAPS/2 - 1;}
+
+	// --- the gain applied to the last output sample, in dB (<= 0)
+	float getGainReduction_dB();
+
+	void reset();
+
+	// --- uChannels (1 or 2) in and out; both channels share the gain
+	void processFrame(const float* pInput, float* pOutput, UINT uChannels);
+
+	// --- non-interleaved buffers
+	void processBlock(float** ppInput, float** ppOutput, UINT uChannels, UINT uFrames);
+
+protected:
+	float detectPeak(float fLeft, float fRight);
+	float computeGain(float fPeak);
+
+	// --- interpolator: [tap][phase], repeated for the right channel in lanes 4-7
+	float m_fPhaseCoeffs[TRUE_PEAK_TAPS][2*TRUE_PEAK_PHASES];
+
+	// --- history, each input broadcast to its channel's 4 lanes; written twice
+	//     so the taps are always read in one straight run
+	float m_fHistory[2*TRUE_PEAK_TAPS][2*TRUE_PEAK_PHASES];
+	UINT m_uHistoryIndex;
+
+	// --- audio delay line
+	float m_fDelay[2][TRUE_PEAK_DELAY_SIZE];
+	UINT m_uDelayIndex;
+
+	// --- sliding minimum of the required gain: a monotonic queue
+	float m_fMinGain[TRUE_PEAK_QUEUE_SIZE];
+	UINT m_uMinTime[TRUE_PEAK_QUEUE_SIZE];
+	UINT m_uMinFront;
+	UINT m_uMinCount;
+	UINT m_uTime;
+
+	// --- moving average
+	float m_fAverage[TRUE_PEAK_MAX_LOOKAHEAD];
+	double m_dAverageSum;
+	double m_dInvLookahead;
+	UINT m_uAverageIndex;
+
+	float m_fReleaseGain;
+	float m_fReleaseCoeff;
+	float m_fGain;
+
+	float m_fCeiling;
+	float m_fRelease_ms;
+	float m_fSampleRate;
+	UINT m_uLookahead;
+};
+
+
+// --- Loudness Meter ---
+// ITU-R BS.1770-4 / EBU R128 momentary (400 ms), short-term (3 s) and gated
+// integrated loudness, in LUFS, of a mono or stereo stream.
+//
+// Input is buffered into chunks of LOUDNESS_CHUNK frames; each chunk goes
+// through the K-weighting pair (the high shelf and the RLB high-pass, both
+// biquads run together in one loop per channel, in double) and its squares
+// are summed 4 at a time into the current 100 ms sub-block. Every completed
+// sub-block updates the results: the last 4 make the momentary block, the
+// last 30 the short-term block.
+//
+// Each momentary block is also a gating block (400 ms, 75% overlap). Blocks
+// over the -70 LUFS absolute gate go into a histogram of 0.1 LU bins that
+// keeps the count and the energy sum of each bin, plus running totals, so
+// adding a block is O(1) and nothing is stored per block; the relative gate
+// (-10 LU) is applied to whole bins, which puts the gate within 0.1 LU.
+const UINT LOUDNESS_CHUNK = 64;
+const UINT LOUDNESS_SHORT_TERM_BLOCKS = 30;		// 100 ms sub-blocks
+const UINT LOUDNESS_MOMENTARY_BLOCKS = 4;
+const UINT LOUDNESS_HISTOGRAM_BINS = 750;		// -70 to +5 LUFS
+const float LOUDNESS_HISTOGRAM_MIN = -70.0;		// also the absolute gate
+const float LOUDNESS_HISTOGRAM_STEP = 0.1;
+const float LOUDNESS_SILENCE = -144.0;			// reported for no signal/no gated blocks
+
+class CLoudnessMeter
+{
+public:
+	CLoudnessMeter(void);
+	~CLoudnessMeter(void);
+
+	// --- call from prepareForPlay(); recalculates the filters and resets
+	void init(float fSampleRate);
+
+	// --- restart all three measurements
+	void reset();
+
+	// --- uChannels 1 or 2; return true when a sub-block completed and the
+	//     results changed
+	bool processFrame(const float* pInput, UINT uChannels);
+	bool processBlock(float** ppInput, UINT uChannels, UINT uFrames);
+
+	float getMomentaryLoudness(){return m_fMomentary_LUFS;}
+	float getShortTermLoudness(){return m_fShortTerm_LUFS;}
+	float getIntegratedLoudness(){return m_fIntegrated_LUFS;}
+
+protected:
+	void calculateKWeighting();
+	bool processChunk(UINT uFrames);
+	void endSubBlock();
+	float toLUFS(double dMeanSquare);
+
+	// --- K-weighting pair, [stage]; the RLB stage has b = 1, -2, 1
+	double m_dB0[2], m_dB1[2], m_dB2[2], m_dA1[2], m_dA2[2];
+	double m_dZ1[2][2], m_dZ2[2][2];		// [channel][stage], TDF-II
+
+	// --- chunk buffer and the K-weighted chunk
+	float m_fChunk[2][LOUDNESS_CHUNK];
+	float m_fWeighted[LOUDNESS_CHUNK];
+	UINT m_uChunkCount;
+	UINT m_uChannels;
+
+	// --- current sub-block
+	double m_dSubBlockSum;
+	UINT m_uSubBlockCount;
+	UINT m_uSubBlockLength;
+
+	// --- mean squares of the last 30 sub-blocks
+	double m_dSubBlocks[LOUDNESS_SHORT_TERM_BLOCKS];
+	UINT m_uSubBlockIndex;
+	UINT m_uSubBlocksDone;
+
+	// --- gating histogram
+	UINT m_uBinCount[LOUDNESS_HISTOGRAM_BINS];
+	double m_dBinEnergy[LOUDNESS_HISTOGRAM_BINS];
+	double m_dGatedEnergy;		// sum over all bins
+	UINT m_uGatedBlocks;
+
+	float m_fMomentary_LUFS;
+	float m_fShortTerm_LUFS;
+	float m_fIntegrated_LUFS;
+	float m_fSampleRate;
+};
+
+
+// --- Meter Engine ---
+// All of a plug-in's meters, run together on the audio thread and handed to
+// the GUI timer.
+//
+// Each frame the meter variables are gathered once, and every ballistic then
+// runs on four meters at a time (SSE; plain loops otherwise), one-pole each:
+//
+//     detector    the control's own attack/release and peak/MS/RMS mode, with
+//                 the RackAFX meter detector's analog time constants; this is
+//                 what the meter parameter carries to the host
+//     VU          rectified average, 99% in METER_VU_MSEC, scaled so a sine
+//                 reads its RMS
+//     PPM         quasi-peak: 80% in METER_PPM_ATTACK_MSEC, falling
+//                 METER_PPM_FALL_DB in METER_PPM_FALL_MSEC (IEC 60268-10 type II)
+//     RMS         mean square with a METER_RMS_MSEC time constant
+//     peak hold   block peak, held METER_PEAK_HOLD_MSEC, then falling at
+//                 METER_PEAK_FALL_DB_PER_SEC
+//
+// Nothing is converted per frame. At the end of each block every reading of
+// every meter goes to dB in one pass of a log2 approximation (the exponent
+// bits plus a short series on the mantissa, well within 0.001 dB), and the
+// block is written out as one frame to wherever the caller sends it to the
+// GUI (the VST3 wrapper: one controller message, or a scratch frame while the
+// editor is closed). A caller that skips endBlock() leaves the block open and
+// nothing is lost: the detector and the peak keep accumulating and go out with
+// the next frame.
+//
+// The GUI hands every frame it receives to displayFrame(), which keeps the
+// newest readings and the highest detector value since the last tick (so a
+// peak that lasts one block still reaches the display); updateDisplay() then
+// tells the listening views.
+enum meterReading
+{
+	METER_READING_DETECTOR,
+	METER_READING_PEAK_HOLD,
+	METER_READING_VU,
+	METER_READING_PPM,
+	METER_READING_RMS,
+	METER_READINGS
+};
+
+const float METER_FLOOR_DB = -120.0;
+const float METER_VU_MSEC = 300.0;
+const float METER_PPM_ATTACK_MSEC = 10.0;
+const float METER_PPM_FALL_DB = 24.0;
+const float METER_PPM_FALL_MSEC = 2800.0;
+const float METER_RMS_MSEC = 300.0;
+const float METER_PEAK_HOLD_MSEC = 1500.0;
+const float METER_PEAK_FALL_DB_PER_SEC = 20.0;
+
+// --- GUI thread; views that show a reading
+class IMeterDisplayListener
+{
+public:
+	virtual ~IMeterDisplayListener(void) {}
+	virtual void meterDisplayChanged() = 0;
+};
+
+class CMeterEngine
+{
+public:
+	CMeterEngine(void);
+	~CMeterEngine(void);
+
+	// --- not while processing: one channel per meter variable, read every
+	//     frame (NULL reads 0); clears the ballistics and the display
+	void setChannels(UINT uChannels, float** ppSources);
+	UINT getChannelCount(){return m_uChannels;}
+
+	// --- not while processing; the detector coefficients are per sample, so
+	//     set the rate first. uDetect as CEnvelopeDetector: 0 = peak, 1 = MS, 2 = RMS
+	void setSampleRate(float fSampleRate);
+	void setDetector(UINT uChannel, float fAttack_ms, float fRelease_ms, UINT uDetect);
+
+	// --- clears the ballistics and the current block; not the display
+	void reset();
+
+	// --- audio thread, once per frame
+	void processFrame();
+
+	// --- audio thread; the variables held for uFrames frames, for plug-ins that
+	//     only update their meters once per buffer; bSilent meters zeros (bypass)
+	void processHeld(UINT uFrames, bool bSilent = false);
+
+	// --- floats in a frame: METER_READINGS rows of dB and one of the detector
+	//     linear, a row per reading with the channels padded to a multiple of 4
+	UINT getFrameSize(){return (METER_READINGS + 1)*m_uStride;}
+
+	// --- audio thread, at the end of each buffer: writes the block to pFrame
+	//     and starts the next; false (nothing written) if there was no block
+	bool endBlock(float* pFrame);
+
+	// --- GUI thread; a frame from endBlock()
+	void displayFrame(const float* pFrame);
+
+	// --- GUI thread, once per tick; true (and the listeners told) if any frame
+	//     arrived since the last call
+	bool updateDisplay();
+
+	// --- GUI thread, from the last updateDisplay(): dB, METER_FLOOR_DB for silence
+	float getReading_dB(UINT uChannel, UINT uReading){return uChannel < m_uChannels ? m_pDisplay[uReading*m_uStride + uChannel] : METER_FLOOR_DB;}
+
+	// --- GUI thread; the detector linear, as the meter parameter has it
+	float getDetector(UINT uChannel){return uChannel < m_uChannels ? m_pDisplay[METER_READINGS*m_uStride + uChannel] : 0.0;}
+
+	void addListener(IMeterDisplayListener* pListener);
+	void removeListener(IMeterDisplayListener* pListener);
+
+	// --- the same approximation, one value at a time; dB of an amplitude
+	//     (20 log10) or of a power (10 log10), floored at METER_FLOOR_DB
+	static float fastAmplitudeTodB(float fAmplitude);
+	static float fastPowerTodB(float fPower);
+
+protected:
+	void allocate(UINT uChannels);
+	void processKernel(UINT uFrames);
+
+	UINT m_uChannels;
+	UINT m_uStride;				// channels rounded up to 4
+	float** m_ppSources;
+	float m_fSampleRate;
+
+	// --- audio thread, m_uStride each
+	float* m_pInput;
+	float* m_pPeak;				// this block
+	float* m_pEnvelope;
+	float* m_pEnvelopeMax;		// this block
+	float* m_pVU;
+	float* m_pPPM;
+	float* m_pMeanSquare;
+	float* m_pAttackCoeff;
+	float* m_pReleaseCoeff;
+	float* m_pDetectSquare;		// all bits set: detect x*x instead of |x|
+	float* m_pDetectRoot;		// all bits set: RMS, the envelope is sqrt'ed
+	float* m_pPeakHold_dB;
+	float* m_pHoldFrames;		// left before the hold starts falling
+	UINT m_uBlockFrames;
+
+	// --- shared ballistics
+	float m_fVUCoeff;
+	float m_fPPMAttackCoeff;
+	float m_fPPMReleaseCoeff;
+	float m_fRMSCoeff;
+	float m_fHoldFrames;
+	float m_fFall_dB_PerFrame;
+
+	// --- GUI thread
+	float* m_pDisplay;			// one frame, as endBlock() writes it
+	bool m_bDisplayFrames;		// displayFrame() since the last updateDisplay()
+	std::vector<IMeterDisplayListener*> m_Listeners;
+};
+
+
+// --- Parameter Dirty Bits ---
+// Which controls the plug-in changed behind the GUI's back, so the VST3
+// wrapper's GUI timer pushes only those parameters to the controller instead
+// of walking all of them.
+//
+// One bit per control list index (the VST3 parameter tag), set from any
+// thread with one atomic OR. A summary word, one bit per word of flags, lets
+// the timer find that nothing changed with a single load, so an open editor
+// costs next to nothing while the plug-in is idle.
+const UINT PARAM_DIRTY_MAX = 1024;						// indexes tracked; 32 words
+const UINT PARAM_DIRTY_WORDS = PARAM_DIRTY_MAX/32;
+
+class CParamDirtyBits
+{
+public:
+	CParamDirtyBits(void);
+
+	// --- any thread; an index past PARAM_DIRTY_MAX marks everything
+	void set(UINT uIndex);
+	void setAll();
+
+	// --- one consumer (the GUI timer); writes the marked indexes, ascending, to
+	//     pIndexes (room for PARAM_DIRTY_MAX), clears them and returns how many;
+	//     after setAll() that is every index, the caller stops at its own count
+	UINT take(UINT* pIndexes);
+
+protected:
+	std::atomic<UINT> m_uWords[PARAM_DIRTY_WORDS];
+	std::atomic<UINT> m_uSummary;
+};
+
+
 // --- CJoystickProgram ---
 class CJoystickProgram
 {
@@ -820,9 +1580,105 @@ public:	// Functions
 	enum{bipolar,unipolar};
 };
 
+// --- CWaveFileReader ---
+// Reads WAV files in place. The file is memory mapped and its RIFF chunks are
+// walked where they lie, so opening even a multi-GB file (RF64 included) only
+// touches its headers; the samples stay in the file's own format until asked
+// for, and the OS pages in only what is read.
 //
-// This is a helper object for reading Wave files into floating point buffers.
-// It is NOT optimized for speed (yet)
+//     getData()       the raw interleaved samples, zero-copy
+//     getBlock()      a block of interleaved float frames: a pointer straight
+//                     into the mapping for 32-bit float files, otherwise
+//                     converted into the caller's scratch
+//     read()          the same, always into the caller's buffer
+//
+// WAVE_FORMAT_PCM, WAVE_FORMAT_IEEE_FLOAT and WAVE_FORMAT_EXTENSIBLE with
+// either sub format: 16, 24 and 32-bit integer (24-bit in 4-byte containers
+// reads as 32-bit) and 32 and 64-bit float, converted four samples at a time
+// with SSE2 (plain loops otherwise). Samples are little endian, as on every
+// target this builds for.
+enum waveSampleFormat
+{
+	WAVE_SAMPLE_NONE,
+	WAVE_SAMPLE_INT16,
+	WAVE_SAMPLE_INT24,
+	WAVE_SAMPLE_INT32,
+	WAVE_SAMPLE_FLOAT32,
+	WAVE_SAMPLE_FLOAT64
+};
+
+// --- the 'smpl' chunk; only the first loop
+typedef struct
+{
+	UINT uMIDINote;
+	UINT uMIDIPitchFraction;
+	UINT uSMPTEFormat;
+	UINT uSMPTEOffset;
+	UINT uLoopCount;
+	UINT uLoopType;
+	UINT uLoopStart;		// frames
+	UINT uLoopEnd;
+} waveSamplerInfo;
+
+class CWaveFileReader
+{
+public:
+	CWaveFileReader(void);
+	~CWaveFileReader(void);
+
+	// --- maps the file and finds its format and data; false if it is not a
+	//     WAV file this can read. Nothing is converted
+	bool open(const char* pFilePath);
+	void close();
+	bool isOpen(){return m_pData != NULL;}
+
+	UINT getChannelCount(){return m_uChannels;}
+	UINT getSampleRate(){return m_uSampleRate;}
+	unsigned long long getFrameCount(){return m_uFrames;}
+	UINT getFormat(){return m_uFormat;}				// waveSampleFormat
+	UINT getBytesPerSample(){return m_uBytesPerSample;}
+
+	// --- NULL if the file has no 'smpl' chunk
+	const waveSamplerInfo* getSamplerInfo(){return m_bHasSamplerInfo ? &m_SamplerInfo : NULL;}
+
+	// --- valid until close()
+	const void* getData(){return m_pData;}
+	unsigned long long getDataBytes(){return m_uFrames*m_uChannels*m_uBytesPerSample;}
+
+	// --- up to uFrames interleaved frames from uFrame on as floats; the
+	//     frames read, 0 past the end. getBlock() points into the mapping when
+	//     it can and into pScratch (uFrames*channels floats) otherwise
+	UINT read(unsigned long long uFrame, float* pDest, UINT uFrames);
+	const float* getBlock(unsigned long long uFrame, UINT uFrames, float* pScratch, UINT& uFramesRead);
+
+	// --- uCount samples of a waveSampleFormat to float, -1.0 to +1.0
+	static void convert(const void* pSource, UINT uFormat, float* pDest, size_t uCount);
+
+protected:
+	bool parse();
+	bool parseFormat(const unsigned char* pChunk, unsigned long long uSize);
+	void parseSampler(const unsigned char* pChunk, unsigned long long uSize);
+
+	// --- the mapping
+	const unsigned char* m_pFile;
+	unsigned long long m_uFileSize;
+	void* m_hFile;				// Windows only
+	void* m_hMapping;			// Windows only
+
+	const unsigned char* m_pData;
+	UINT m_uChannels;
+	UINT m_uSampleRate;
+	UINT m_uFormat;
+	UINT m_uBytesPerSample;
+	unsigned long long m_uFrames;
+
+	bool m_bHasSamplerInfo;
+	waveSamplerInfo m_SamplerInfo;
+};
+
+//
+// This is a helper object for reading Wave files into floating point buffers,
+// all at once; see CWaveFileReader for reading in place
 #if defined _WINDOWS || defined _WINDLL
 #include <mmsystem.h>
 
@@ -862,9 +1718,11 @@ public:	// Functions
 	float* m_pWaveBuffer;
 
 protected:
-	bool readWaveFile(char* pFilePath);
+	// --- pProgress (0 to WAVE_LOAD_PROGRESS_MAX) and pCancel for CWaveDataLoader
+	bool readWaveFile(char* pFilePath, std::atomic<UINT>* pProgress = NULL, const std::atomic<bool>* pCancel = NULL);
 	HANDLE m_hFile;
 
+	friend class CWaveDataLoader;
 };
 #else // MacOS Version here!
 
@@ -904,77 +1762,134 @@ public:	// Functions
 	float* m_pWaveBuffer;
 
 protected:
-	bool readWaveFile(char* pFilePath);
+	// --- pProgress (0 to WAVE_LOAD_PROGRESS_MAX) and pCancel for CWaveDataLoader
+	bool readWaveFile(char* pFilePath, std::atomic<UINT>* pProgress = NULL, const std::atomic<bool>* pCancel = NULL);
+
+	friend class CWaveDataLoader;
 };
 
 #endif
 
-// --- CUICtrl ---
+// --- CWaveDataLoader ---
+// Loads CWaveData on a worker thread and hands it to the audio thread without
+// either side waiting on the other.
 //
-// CUICtrl is the C++ obhect that manages your GUI objects
-// like sliders and buttons. Do not ever edit or change this code as the
-// objects are shared with the Client and you may break the app.
+// load() starts a worker that maps, converts and reports progress block by
+// block; a newer load() or cancel() stops it between blocks. A finished wave
+// is published with one atomic pointer swap, so the audio thread sees the old
+// wave or the new one, never a partial one. The wave it replaces is retired,
+// not deleted: the audio thread announces the wave it is playing in acquire()
+// (a hazard pointer) and collectGarbage() frees only the retired waves it is
+// not holding, off the audio thread. Swapping a sample or an IR mid-playback
+// therefore never blocks, allocates or frees on the audio thread.
 //
-// enum for VU Colors
-enum {csVU, csRed, csOrange, csYellow, csGreen, csBlue, csViolet};
+// One audio thread (the plug-in's process call) may acquire at a time; every
+// other function is for one non-audio thread, normally the GUI's.
+enum waveLoadState
+{
+	WAVE_LOAD_IDLE,			// nothing started, or cancelled
+	WAVE_LOAD_LOADING,		// the worker is converting; see getProgress()
+	WAVE_LOAD_READY,		// the last load() was published
+	WAVE_LOAD_FAILED		// the last load() could not read its file
+};
 
-class CUICtrl
+const UINT WAVE_LOAD_PROGRESS_MAX = 1000;		// getProgress() when done
+const UINT WAVE_LOAD_BLOCK_SAMPLES = 65536;		// converted between progress/cancel checks
+
+class CWaveDataLoader
 {
 public:
-	CUICtrl(void);
-	~CUICtrl(void);
-	CUICtrl(const CUICtrl& initCUICtrl);
+	CWaveDataLoader(void);
+	~CWaveDataLoader(void);		// the audio thread must be done with acquire()
 
-public:
-	UINT uControlType;
-	UINT uControlId;
-	UINT uDetectorMode;
+	// --- starts loading pFilePath on the worker, cancelling any load in flight;
+	//     the current wave stays published until the new one is ready
+	void load(const char* pFilePath);
+	void cancel();
 
-	float fUserDisplayDataLoLimit;
-	float fUserDisplayDataHiLimit;
+	// --- publishes nothing; the current wave is retired
+	void unload();
 
-	UINT  uUserDataType;
-	float fInitUserIntValue;
-	float fInitUserFloatValue;
-	float fInitUserDoubleValue;
-	float fInitUserUINTValue;
+	UINT getState(){return m_uState.load(std::memory_order_acquire);}	// waveLoadState
+	UINT getProgress(){return m_uProgress.load(std::memory_order_relaxed);}
 
-	// FOR VST PRESETS ONLY!
-	float fUserCookedIntData;
-	float fUserCookedFloatData;
-	float fUserCookedDoubleData;
-	float fUserCookedUINTData;
+	// --- frees the retired waves the audio thread is not holding; call from
+	//     the GUI timer (load() and the worker also call it)
+	void collectGarbage();
 
-	int*	m_pUserCookedIntData;
-	float*	m_pUserCookedFloatData;
-	double*	m_pUserCookedDoubleData;
-	UINT*	m_pUserCookedUINTData;
-	float*	m_pCurrentMeterValue;
+	// --- audio thread: the published wave (NULL if none), safe to use until
+	//     release(); call once per block, a new pointer means a new wave
+	CWaveData* acquire();
+	void release(){m_pInUse.store(NULL, std::memory_order_release);}
 
-	char*  cControlName;
-	char*  cControlUnits;
-	char*  cVariableName;
-	char*  cEnumeratedList;
-	char*  cMeterVariableName;
+protected:
+	void loadWorker(std::string filePath);
+	void publish(CWaveData* pWave);
+	void stopWorker();
 
-	char   cName[1024];
-	char   cUnits[1024];
-	char   cVName[1024];
-	char   cMeterVName[1024];
-	char   cVEnumeratedList[1024];
+	std::atomic<CWaveData*> m_pCurrent;
+	std::atomic<CWaveData*> m_pInUse;		// the audio thread's hazard pointer
 
-	bool	bOwnerControl;
-	bool	bUseMeter;
-	bool	bUpsideDownMeter;
-	bool	bLogMeter;
+	std::mutex m_Mutex;						// m_Retired; the worker retires too
+	std::vector<CWaveData*> m_Retired;
+	std::thread m_Worker;
+
+	std::atomic<bool> m_bCancel;
+	std::atomic<UINT> m_uState;
+	std::atomic<UINT> m_uProgress;
+};
+
+// --- CUICtrl ---
+//
+// CUICtrl is the C++ obhect that manages your GUI objects
+// like sliders and buttons. Do not ever edit or change this code as the
+// objects are shared with the Client and you may break the app.
+//
+// A control is split in two:
+//   CUICtrlInfo - the cold description (names, units, theme, presets, flux cap,
+//                 MIDI and meter setup); it never changes after initUI() so ONE
+//                 copy is shared by every plugin instance
+//   CUICtrl     - the hot per-instance part (type, range, slider flags, cooked
+//                 variable pointers) that setParameter()/getParameter() touch;
+//                 it fits in one cache line and points to its CUICtrlInfo
+//
+// enum for VU Colors
+enum {csVU, csRed, csOrange, csYellow, csGreen, csBlue, csViolet};
+
+// --- NOTE: CUICtrlInfo is a plain aggregate so a plugin can declare its controls
+//           as a constexpr table (see CSimpleHPF); to build one at runtime start
+//           from *CUICtrlInfo::getDefault() and keep it alive as long as the
+//           CUICtrls that point to it
+class CUICtrlInfo
+{
+public:
+	// --- the description of a default-constructed control
+	static const CUICtrlInfo* getDefault();
 
+public:
+	// --- definition; copied into the hot CUICtrl by CUICtrl::setInfo()
+	UINT	uControlType;
+	UINT	uControlId;
+	UINT	uUserDataType;
+	float	fUserDisplayDataLoLimit;
+	float	fUserDisplayDataHiLimit;
 	bool	bLogSlider;
 	bool	bExpSlider;
 
-	UINT    uMeterColorScheme;
-	float   fMeterAttack_ms;
-	float   fMeterRelease_ms;
+	float	fInitUserIntValue;
+	float	fInitUserFloatValue;
+	float	fInitUserDoubleValue;
+	float	fInitUserUINTValue;
 
+	const char*	cControlName;
+	const char*	cControlUnits;
+	const char*	cVariableName;
+	const char*	cEnumeratedList;
+	const char*	cMeterVariableName;
+
+	double 	dPresetData[PRESET_COUNT];
+
+	bool	bOwnerControl;
 	bool	bMIDIControl;
 	UINT	uMIDIControlCommand; // pitchbend or CC
 	UINT	uMIDIControlName; // eg Continuous Controller #3
@@ -983,129 +1898,89 @@ public:
 	int		nGUIRow;
 	int		nGUIColumn;
 
-	UINT	uControlTheme[CONTROL_THEME_SIZE];
-	double 	dPresetData[PRESET_COUNT];
+	bool	bUseMeter;
+	bool	bUpsideDownMeter;
+	bool	bLogMeter;
+	UINT	uDetectorMode;
+	UINT    uMeterColorScheme;
+	float   fMeterAttack_ms;
+	float   fMeterRelease_ms;
 
+	UINT	uControlTheme[CONTROL_THEME_SIZE];
 	UINT	uFluxCapControl[PLUGIN_CONTROL_THEME_SIZE];
 	float	fFluxCapData[PLUGIN_CONTROL_THEME_SIZE];
+};
 
-	void*   pvAddlData;
-// ----------------------------------------------------------------------------------------
+class CUICtrl
+{
 public:
-	CUICtrl& operator=(const CUICtrl& aCUICtrl)	// need this override for collections to work
-	{
-		if(this == &aCUICtrl)
-			return *this;
-
-		this->uControlType				= aCUICtrl.uControlType;
-		this->uControlId				= aCUICtrl.uControlId;
-		this->bOwnerControl			= aCUICtrl.bOwnerControl;
-		this->bUseMeter			= aCUICtrl.bUseMeter;
-		this->bUpsideDownMeter			= aCUICtrl.bUpsideDownMeter;
-		this->uDetectorMode			= aCUICtrl.uDetectorMode;
-		this->bLogMeter			= aCUICtrl.bLogMeter;
-		this->bLogSlider			= aCUICtrl.bLogSlider;
-		this->bExpSlider			= aCUICtrl.bExpSlider;
-
-		this->uMeterColorScheme			= aCUICtrl.uMeterColorScheme;
-		this->fMeterAttack_ms			= aCUICtrl.fMeterAttack_ms;
-		this->fMeterRelease_ms			= aCUICtrl.fMeterRelease_ms;
-
-		this->fUserDisplayDataLoLimit				= aCUICtrl.fUserDisplayDataLoLimit;
-		this->fUserDisplayDataHiLimit				= aCUICtrl.fUserDisplayDataHiLimit;
-
-		this->uUserDataType				= aCUICtrl.uUserDataType;
-		this->fInitUserIntValue				= aCUICtrl.fInitUserIntValue;
-		this->fInitUserFloatValue				= aCUICtrl.fInitUserFloatValue;
-		this->fInitUserDoubleValue				= aCUICtrl.fInitUserDoubleValue;
-		this->fInitUserUINTValue				= aCUICtrl.fInitUserUINTValue;
-
-		// VST PRESETS ONLY
-		this->fUserCookedIntData				= aCUICtrl.fUserCookedIntData;
-		this->fUserCookedFloatData				= aCUICtrl.fInitUserFloatValue;
-		this->fUserCookedDoubleData				= aCUICtrl.fUserCookedDoubleData;
-		this->fUserCookedUINTData				= aCUICtrl.fUserCookedUINTData;
-
-		this->m_pUserCookedIntData				= aCUICtrl.m_pUserCookedIntData;
-		this->m_pUserCookedFloatData				= aCUICtrl.m_pUserCookedFloatData;
-		this->m_pUserCookedDoubleData				= aCUICtrl.m_pUserCookedDoubleData;
-		this->m_pUserCookedUINTData				= aCUICtrl.m_pUserCookedUINTData;
-		this->m_pCurrentMeterValue				= aCUICtrl.m_pCurrentMeterValue;
-
-		this->bMIDIControl				= aCUICtrl.bMIDIControl;
-		this->uMIDIControlCommand		= aCUICtrl.uMIDIControlCommand;
-		this->uMIDIControlName			= aCUICtrl.uMIDIControlName;
-		this->uMIDIControlChannel			= aCUICtrl.uMIDIControlChannel;
-
-		this->nGUIRow				= aCUICtrl.nGUIRow;
-		this->nGUIColumn				= aCUICtrl.nGUIColumn;
-		this->pvAddlData			= aCUICtrl.pvAddlData;
-
-		for(int i=0; i<PRESET_COUNT; i++)
-		{
-			this->dPresetData[i] = aCUICtrl.dPresetData[i];
-		}
-
-		for(int i=0; i<CONTROL_THEME_SIZE; i++)
-		{
-			this->uControlTheme[i] = aCUICtrl.uControlTheme[i];
-		}
-
-		for(int i=0; i<PLUGIN_CONTROL_THEME_SIZE; i++)
-		{
-			this->uFluxCapControl[i] = aCUICtrl.uFluxCapControl[i];
-		}
-
-		for(int i=0; i<PLUGIN_CONTROL_THEME_SIZE; i++)
-		{
-			this->fFluxCapData[i] = aCUICtrl.fFluxCapData[i];
-		}
+	CUICtrl(void);
+	CUICtrl(const CUICtrlInfo* pCtrlInfo);
 
-		cControlName = &cName[0];
-		cControlUnits = &cUnits[0];
-		cVariableName = &cVName[0];
-		cMeterVariableName = &cMeterVName[0];
-		cEnumeratedList = &cVEnumeratedList[0];
+	// --- point at a (shared) description and copy its hot fields
+	void setInfo(const CUICtrlInfo* pCtrlInfo);
 
-		strncpy(this->cControlName, aCUICtrl.cControlName, 1023);
-		cControlName[1023] = '\0';
+public:
+	// --- hot: everything the parameter paths read, first cache line
+	UINT uControlType;
+	UINT uControlId;
+	UINT uUserDataType;
 
-		strncpy(this->cControlUnits, aCUICtrl.cControlUnits, 1023);
-		cControlUnits[1023] = '\0';
+	float fUserDisplayDataLoLimit;
+	float fUserDisplayDataHiLimit;
 
-		strncpy(this->cVariableName, aCUICtrl.cVariableName, 1023);
-		cVariableName[1023] = '\0';
+	bool	bLogSlider;
+	bool	bExpSlider;
 
-		strncpy(this->cEnumeratedList, aCUICtrl.cEnumeratedList, 1023);
-		cEnumeratedList[1023] = '\0';
+	int*	m_pUserCookedIntData;
+	float*	m_pUserCookedFloatData;
+	double*	m_pUserCookedDoubleData;
+	UINT*	m_pUserCookedUINTData;
+	float*	m_pCurrentMeterValue;
 
-		strncpy(this->cMeterVariableName, aCUICtrl.cMeterVariableName, 1023);
-		cMeterVariableName[1023] = '\0';
+	// --- cold: shared description, never NULL
+	const CUICtrlInfo* pInfo;
 
-		return *this;
+	void*   pvAddlData;
 
-	}
+	// --- NOTE: all members are plain data so the default copy/assign are fine
 };
 
 
 // -- CUIControlList --
-// This is the linked list of control objects
+// This is the list of control objects; they are stored contiguously, each one
+// starting on a cache line, so getAt() is O(1) and the hot part of a control
+// never straddles two lines
 const UINT uMaxVSTProgramNameLen = 24;
 
 class CUIControlList
 {
+public:
+	 enum {CACHE_LINE_SIZE = 64,
+		   CONTROL_STRIDE = (sizeof(CUICtrl) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1)};
+
      private:
+		 char* m_pBuffer;		// raw allocation
+		 char* m_pControls;		// m_pBuffer aligned to CACHE_LINE_SIZE
+		 int   m_nCount;
+		 int   m_nCapacity;
 
-         struct node
-         {
-            CUICtrl data;
-            node *link;
-         }*p;
+		 void grow(int nCapacity);
+		 CUICtrl* slot(int nIndex){return (CUICtrl*)(m_pControls + nIndex*CONTROL_STRIDE);}
 
 public:
 
      CUIControlList();
      void append( CUICtrl data);
+
+	 // --- append a control described by a shared, read-only CUICtrlInfo (e.g. an
+	 //     entry of a static control table) bound to this instance's variable;
+	 //     the variable type must match uUserDataType, meters bind a float
+	 void append(const CUICtrlInfo* pCtrlInfo, int* pVariable);
+	 void append(const CUICtrlInfo* pCtrlInfo, float* pVariable);
+	 void append(const CUICtrlInfo* pCtrlInfo, double* pVariable);
+	 void append(const CUICtrlInfo* pCtrlInfo, UINT* pVariable);
+
      void add_as_first( CUICtrl data );
      void addafter( int c, CUICtrl data);
      void update(CUICtrl data);
@@ -1134,8 +2009,7 @@ public:
 		for(int j=0; j<nCount; j++)
 		{
 			CUICtrl* p = aCUICtrlList.getAt(j);
-			CUICtrl* pClone = new CUICtrl(*p);
-			this->append(*pClone);
+			this->append(*p);
 		}
 
 		return *this;
@@ -1,4 +1,26 @@
 #include "pluginconstants.h"
+#include "filtercoeffs.h"
+#include <new>
+#include <mutex>
+#include <complex>
+
+// --- SSE lanes for the crossover and the biquad bank where the target has it;
+//     AVX for the bank when the build enables it (-mavx, /arch:AVX); plain loops otherwise
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define RAFX_OBJECTS_SSE 1
+#include <xmmintrin.h>
+#endif
+
+// --- SSE2 integer lanes for the meter engine's log2
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAFX_OBJECTS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX__)
+#define RAFX_OBJECTS_AVX 1
+#include <immintrin.h>
+#endif
 
 // This file contains the object implementations for the objects declared in
 // "pluginconstants.h"
@@ -406,948 +428,2828 @@ CBiQuad::~CBiQuad(void)
 }
 
 
-// CJoystickProgram Implementation ----------------------------------------------------------------
+// CStateVariableFilter Implementation ----------------------------------------------------------------
 //
-CJoystickProgram::CJoystickProgram(float* pJSProgramTable, UINT uMode)
+CStateVariableFilter::CStateVariableFilter(void)
 {
-	m_bRunning = false;
-	m_uSampleCount = 0;
-	m_pJSProgramTable = pJSProgramTable;
-	m_fTimerDurationMSec = 0;
-	m_nCurrentProgramStep = 0;
-	m_fA_Mix = 0.25;
-	m_fB_Mix = 0.25;
-	m_fC_Mix = 0.25;
-	m_fD_Mix = 0.25;
-	m_fAC_Mix = 0.0;
-	m_fBD_Mix = 0.0;
-	m_uJSMode = uMode;
-	m_bDirInc = true;
+	m_fSampleRate = 44100;
+	m_fCutoff_Hz = 1000.0;
+	m_fQ = sqrt2over2;
+	m_fK = 1.0/m_fQ;
+	m_uOutputType = SVF_LPF;
+
+	setOutputType(SVF_LPF);
+	setCutoff(m_fCutoff_Hz);
+	flushDelays();
 }
 
-void CJoystickProgram::setJSMode(UINT uMode)
+CStateVariableFilter::~CStateVariableFilter(void)
 {
-	m_uJSMode = uMode;
-	m_bDirInc = true;
 }
 
-void CJoystickProgram::setSampleRate(int nSampleRate)
+void CStateVariableFilter::setSampleRate(float fSampleRate)
 {
-	m_fSampleRate = (float)nSampleRate;
+	m_fSampleRate = fSampleRate;
+	setCutoff(m_fCutoff_Hz);
 }
 
-CJoystickProgram::~CJoystickProgram(void)
+void CStateVariableFilter::setQ(float fQ)
 {
+	m_fQ = fQ > 0.01 ? fQ : 0.01;
+	m_fK = 1.0/m_fQ;
+	setCoefficients(m_fG);
 
+	// --- the BPF mix depends on k
+	setOutputType(m_uOutputType);
 }
 
-void CJoystickProgram::incTimer()
+void CStateVariableFilter::setOutputType(UINT uType)
 {
-	if(!m_bRunning)
-		return;
-
-	m_uSampleCount++;
+	m_uOutputType = uType;
+	m_fMixLP = uType == SVF_LPF || uType == SVF_NOTCH ? 1.0 : 0.0;
+	m_fMixHP = uType == SVF_HPF || uType == SVF_NOTCH ? 1.0 : 0.0;
+	m_fMixBP = uType == SVF_BPF ? m_fK : 0.0;
+}
 
-	calculateCurrentVectorMix();
+void CStateVariableFilter::setCutoff(float fCutoff_Hz)
+{
+	// --- keep g finite: tan() has its pole at Nyquist
+	float fLimit = 0.49*m_fSampleRate;
+	m_fCutoff_Hz = fCutoff_Hz < fLimit ? fCutoff_Hz : fLimit;
+	setCoefficients(fastTan((float)pi*m_fCutoff_Hz/m_fSampleRate));
+}
 
-	if(m_uSampleCount > (UINT)m_nTimerDurationSamples)
+// --- same recursion as doSVF() with the states in registers; the underflow
+//     check happens once at the end of the block instead of every sample
+void CStateVariableFilter::processBlock(const float* pInput, float* pOutput, UINT uFrames)
+{
+	float z1 = m_fZ1;
+	float z2 = m_fZ2;
+	float g = m_fG;
+	float fGK = m_fGK;
+	float fA1 = m_fA1;
+	float fMixLP = m_fMixLP;
+	float fMixBP = m_fMixBP;
+	float fMixHP = m_fMixHP;
+
+	for(UINT i = 0; i < uFrames; i++)
 	{
-		// goto the next step
-		if(m_bDirInc)
-			m_nCurrentProgramStep++;
-		else
-			m_nCurrentProgramStep--;
-
-		if(m_nCurrentProgramStep > m_nNumSteps || m_nCurrentProgramStep < 0)
-		{
-			if(m_uJSMode == JS_ONESHOT)
-			{
-				reset();
-				return;
-			}
-			else if(m_uJSMode == JS_LOOP)
-			{
-				m_nCurrentProgramStep = 0;
-			}
-			else if(m_uJSMode == JS_LOOP_BACKANDFORTH)
-			{
-				m_bDirInc = !m_bDirInc;
-				if(m_bDirInc)
-					m_nCurrentProgramStep +=2;
-				else
-					m_nCurrentProgramStep -= 2;
-			}
-			else if(m_uJSMode == JS_SUSTAIN)
-			{
-				m_bRunning = false;
-				return; // just return
-			}
-		}
-		else if(m_uJSMode == JS_SUSTAIN && m_nCurrentProgramStep == m_nNumSteps)
-		{
-			pauseProgram(); // until user restarts with a note-off event
-		}
-
-		// setup for next step
-		m_uSampleCount = 0;
+		float hp = (pInput[i] - fGK*z1 - z2)*fA1;
+		float v1 = g*hp;
+		float bp = v1 + z1;
+		float v2 = g*bp;
+		float lp = v2 + z2;
 
-		m_fStartA_Mix = m_fEndA_Mix;
-		m_fStartB_Mix = m_fEndB_Mix;
-		m_fStartC_Mix = m_fEndC_Mix;
-		m_fStartD_Mix = m_fEndD_Mix;
-		m_fStartAC_Mix = m_fEndAC_Mix;
-		m_fStartBD_Mix = m_fEndBD_Mix;
+		z1 = bp + v1;
+		z2 = lp + v2;
 
-		m_fEndA_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,0)];
-		m_fEndB_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,1)];
-		m_fEndC_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,2)];
-		m_fEndD_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,3)];
-		m_fEndAC_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,5)];
-		m_fEndBD_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,6)];
+		pOutput[i] = fMixLP*lp + fMixBP*bp + fMixHP*hp;
+	}
 
-		if(m_bDirInc)
-			m_fTimerDurationMSec = m_nCurrentProgramStep > 0 ? m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep-1,4)] : m_pJSProgramTable[JS_PROG_INDEX(m_nNumSteps,4)];
-		else
-			m_fTimerDurationMSec = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,4)];
+	if(z1 > 0.0 && z1 < FLT_MIN_PLUS) z1 = 0;
+	if(z1 < 0.0 && z1 > FLT_MIN_MINUS) z1 = 0;
+	if(z2 > 0.0 && z2 < FLT_MIN_PLUS) z2 = 0;
+	if(z2 < 0.0 && z2 > FLT_MIN_MINUS) z2 = 0;
 
-		m_nTimerDurationSamples = (int)((m_fTimerDurationMSec/1000.0)*(m_fSampleRate));
-	}
+	m_fZ1 = z1;
+	m_fZ2 = z2;
 }
 
-void CJoystickProgram::calculateCurrentVectorMix()
+void CStateVariableFilter::processBlock(const float* pInput, float* pOutput, const float* pCutoff_Hz, UINT uFrames)
 {
-	float m = (m_fEndA_Mix - m_fStartA_Mix)/(float)m_nTimerDurationSamples;
-	m_fA_Mix = m*(float)m_uSampleCount + m_fStartA_Mix;
-
-	m = (m_fEndB_Mix - m_fStartB_Mix)/(float)m_nTimerDurationSamples;
-	m_fB_Mix = m*(float)m_uSampleCount + m_fStartB_Mix;
-
-	m = (m_fEndC_Mix - m_fStartC_Mix)/(float)m_nTimerDurationSamples;
-	m_fC_Mix = m*(float)m_uSampleCount + m_fStartC_Mix;
+	float fG[SVF_BLOCK_SIZE];
+	float fA1[SVF_BLOCK_SIZE];
 
-	m = (m_fEndD_Mix - m_fStartD_Mix)/(float)m_nTimerDurationSamples;
-	m_fD_Mix = m*(float)m_uSampleCount + m_fStartD_Mix;
+	while(uFrames > 0)
+	{
+		UINT uCount = uFrames < SVF_BLOCK_SIZE ? uFrames : SVF_BLOCK_SIZE;
 
-	m = (m_fEndAC_Mix - m_fStartAC_Mix)/(float)m_nTimerDurationSamples;
-	m_fAC_Mix = m*(float)m_uSampleCount + m_fStartAC_Mix;
+		calculateCoefficients(pCutoff_Hz, &fG[0], &fA1[0], uCount);
+		processBlock(pInput, pOutput, &fG[0], &fA1[0], uCount);
 
-	m = (m_fEndBD_Mix - m_fStartBD_Mix)/(float)m_nTimerDurationSamples;
-	m_fBD_Mix = m*(float)m_uSampleCount + m_fStartBD_Mix;
+		pInput += uCount;
+		pOutput += uCount;
+		pCutoff_Hz += uCount;
+		uFrames -= uCount;
+	}
 }
 
-void CJoystickProgram::startProgram()
+// --- no dependencies between frames here, so this loop vectorizes
+void CStateVariableFilter::calculateCoefficients(const float* pCutoff_Hz, float* pG, float* pA1, UINT uFrames)
 {
-	m_nNumSteps = 0;
-	for(int i=1; i<MAX_JS_PROGRAM_STEPS; i++)
+	float fPiOverFs = (float)pi/m_fSampleRate;
+	float fLimit = 0.49*m_fSampleRate;
+	float fK = m_fK;
+
+	for(UINT i = 0; i < uFrames; i++)
 	{
-		if(m_pJSProgramTable[JS_PROG_INDEX(i,4)] > 0)
-			m_nNumSteps++;
+		float fc = pCutoff_Hz[i] < fLimit ? pCutoff_Hz[i] : fLimit;
+		float g = fastTan(fPiOverFs*fc);
+		pG[i] = g;
+		pA1[i] = 1.0f/(1.0f + g*(g + fK));
 	}
+}
 
-	if(m_nNumSteps == 0)
+// --- the recursion over precomputed per-frame coefficients
+void CStateVariableFilter::processBlock(const float* pInput, float* pOutput, const float* pG, const float* pA1, UINT uFrames)
+{
+	if(uFrames == 0)
 		return;
 
-	m_bDirInc = true;
-	m_nCurrentProgramStep = 1;
+	float z1 = m_fZ1;
+	float z2 = m_fZ2;
+	float fK = m_fK;
+	float fMixLP = m_fMixLP;
+	float fMixBP = m_fMixBP;
+	float fMixHP = m_fMixHP;
 
-	m_fStartA_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,0)];
-	m_fStartB_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,1)];
-	m_fStartC_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,2)];
-	m_fStartD_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,3)];
-	m_fStartAC_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,5)];
-	m_fStartBD_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,6)];
+	for(UINT i = 0; i < uFrames; i++)
+	{
+		float g = pG[i];
+		float hp = (pInput[i] - (g + fK)*z1 - z2)*pA1[i];
+		float v1 = g*hp;
+		float bp = v1 + z1;
+		float v2 = g*bp;
+		float lp = v2 + z2;
 
-	m_fEndA_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,0)];
-	m_fEndB_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,1)];
-	m_fEndC_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,2)];
-	m_fEndD_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,3)];
-	m_fEndAC_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,5)];
-	m_fEndBD_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,6)];
+		z1 = bp + v1;
+		z2 = lp + v2;
 
-	m_fTimerDurationMSec = m_pJSProgramTable[JS_PROG_INDEX(0,4)];
-	m_nTimerDurationSamples = (int)((m_fTimerDurationMSec/1000.0)*(m_fSampleRate));
+		pOutput[i] = fMixLP*lp + fMixBP*bp + fMixHP*hp;
+	}
 
-	m_bRunning = true;
-}
+	if(z1 > 0.0 && z1 < FLT_MIN_PLUS) z1 = 0;
+	if(z1 < 0.0 && z1 > FLT_MIN_MINUS) z1 = 0;
+	if(z2 > 0.0 && z2 < FLT_MIN_PLUS) z2 = 0;
+	if(z2 < 0.0 && z2 > FLT_MIN_MINUS) z2 = 0;
 
-// CWaveData Implementation ----------------------------------------------------------------
-//
-#if defined _WINDOWS || defined _WINDLL
-typedef struct {
+	m_fZ1 = z1;
+	m_fZ2 = z2;
+	setCoefficients(pG[uFrames - 1]);
+}
 
-    UCHAR IdentifierString[4];
-    DWORD dwLength;
 
-} RIFF_CHUNK, *PRIFF_CHUNK;
+// CBiQuadBank Implementation ----------------------------------------------------------------
+//
+CBiQuadBank::CBiQuadBank(void)
+{
+	m_uChannels = 0;
+	m_uGroups = 0;
+	m_uLanes = 0;
+	m_pMemory = NULL;
+	m_pA0 = NULL;
+	m_pA1 = NULL;
+	m_pA2 = NULL;
+	m_pB1 = NULL;
+	m_pB2 = NULL;
+	m_pX1 = NULL;
+	m_pX2 = NULL;
+	m_pY1 = NULL;
+	m_pY2 = NULL;
+
+	// --- padding lanes have zero coefficients, so whatever the tiles hold there
+	//     comes out as silence; start them clean anyway
+	memset(m_fTileIn, 0, sizeof(m_fTileIn));
+	memset(m_fTileOut, 0, sizeof(m_fTileOut));
+}
 
-typedef struct {
+CBiQuadBank::~CBiQuadBank(void)
+{
+	destroy();
+}
 
-    WORD  wFormatTag;         // Format category
-    WORD  wChannels;          // Number of channels
-    DWORD dwSamplesPerSec;    // Sampling rate
-    DWORD dwAvgBytesPerSec;   // For buffer estimation
-    WORD  wBlockAlign;        // Data block size
-    WORD  wBitsPerSample;
+void CBiQuadBank::destroy()
+{
+	if(m_pMemory)
+		delete [] m_pMemory;
+	m_pMemory = NULL;
+	m_pA0 = NULL;
+	m_pA1 = NULL;
+	m_pA2 = NULL;
+	m_pB1 = NULL;
+	m_pB2 = NULL;
+	m_pX1 = NULL;
+	m_pX2 = NULL;
+	m_pY1 = NULL;
+	m_pY2 = NULL;
+}
 
+void CBiQuadBank::init(UINT uChannels)
+{
+	if(uChannels != m_uChannels || !m_pMemory)
+	{
+		destroy();
+
+		m_uChannels = uChannels;
+		m_uGroups = (uChannels + BIQUAD_BANK_LANES - 1)/BIQUAD_BANK_LANES;
+		m_uLanes = m_uGroups*BIQUAD_BANK_LANES;
+
+		// --- 9 arrays plus slack to align the first to 32 bytes; m_uLanes keeps the rest aligned
+		m_pMemory = new float[9*m_uLanes + 8];
+		memset(m_pMemory, 0, (9*m_uLanes + 8)*sizeof(float));
+
+		float* p = (float*)(((size_t)m_pMemory + 31) & ~(size_t)31);
+		m_pA0 = p;
+		m_pA1 = p + m_uLanes;
+		m_pA2 = p + 2*m_uLanes;
+		m_pB1 = p + 3*m_uLanes;
+		m_pB2 = p + 4*m_uLanes;
+		m_pX1 = p + 5*m_uLanes;
+		m_pX2 = p + 6*m_uLanes;
+		m_pY1 = p + 7*m_uLanes;
+		m_pY2 = p + 8*m_uLanes;
+	}
 
-} WAVE_FILE_HEADER, *PWAVE_FILE_HEADER;
+	flushDelays();
+}
 
+void CBiQuadBank::setCoefficients(UINT uChannel, float a0, float a1, float a2, float b1, float b2)
+{
+	if(uChannel >= m_uChannels)
+		return;
 
-typedef struct _wave_sample {
+	m_pA0[uChannel] = a0;
+	m_pA1[uChannel] = a1;
+	m_pA2[uChannel] = a2;
+	m_pB1[uChannel] = b1;
+	m_pB2[uChannel] = b2;
+}
 
-     WAVEFORMATEX WaveFormatEx;
-     char *pSampleData;
-     char *pFXSampleData;
-     UINT Index;
-     UINT FXIndex;
-     UINT Size;
-     DWORD dwId;
-     DWORD bPlaying;
-     struct _wave_sample *pNext;
+void CBiQuadBank::setHPFCutoffs(const float* pCutoff_Hz, float fSampleRate)
+{
+	if(!m_pMemory)
+		return;
 
-} WAVE_SAMPLE, *PWAVE_SAMPLE;
+	biquadCoeffArrays coeffs = {m_pA0, m_pA1, m_pA2, m_pB1, m_pB2};
+	calculateB2HPFCoeffsBatch(pCutoff_Hz, m_uChannels, fSampleRate, coeffs);
+}
 
-// union for data conversion
-union UWaveData
-{
-	float f;
-	double d;
-	int n;
-	unsigned int u;
-	unsigned long long u64;
-};
-// CWaveData
-CWaveData::CWaveData(char* pFilePath)
+void CBiQuadBank::flushDelays()
 {
-	m_bWaveLoaded = false;
+	if(!m_pMemory)
+		return;
 
-	m_pWaveBuffer = NULL;
-	m_uLoopCount = 0;
-	m_uLoopStartIndex = 0;
-	m_uLoopEndIndex = 0;
-	m_uLoopType = 0;
-	m_uMIDINote = 0;
-	m_uMIDIPitchFraction = 0;
-	m_uSMPTEFormat = 0;
-	m_uSMPTEOffset = 0;
+	memset(m_pX1, 0, 4*m_uLanes*sizeof(float));
+}
 
-	if(pFilePath)
-		m_bWaveLoaded = readWaveFile(pFilePath);
+void CBiQuadBank::flushDenormals()
+{
+	for(UINT i = 0; i < m_uChannels; i++)
+	{
+		if(fabs(m_pY1[i]) < FLT_MIN_PLUS) m_pY1[i] = 0;
+		if(fabs(m_pY2[i]) < FLT_MIN_PLUS) m_pY2[i] = 0;
+	}
 }
 
-CWaveData::~CWaveData()
+// --- direct form I, as CBiQuad: y = a0*x + a1*x1 + a2*x2 - b1*y1 - b2*y2, summed in
+//     the same order so the output matches CBiQuad bit for bit (apart from its underflow check)
+void CBiQuadBank::processGroup(UINT uGroup, const float* pInput, float* pOutput, UINT uStride, UINT uFrames)
 {
-	if(m_pWaveBuffer)
-		delete [] m_pWaveBuffer;
+	UINT i = uGroup*BIQUAD_BANK_LANES;
+
+#if RAFX_OBJECTS_AVX
+	__m256 a0 = _mm256_load_ps(m_pA0 + i);
+	__m256 a1 = _mm256_load_ps(m_pA1 + i);
+	__m256 a2 = _mm256_load_ps(m_pA2 + i);
+	__m256 b1 = _mm256_load_ps(m_pB1 + i);
+	__m256 b2 = _mm256_load_ps(m_pB2 + i);
+	__m256 x1 = _mm256_load_ps(m_pX1 + i);
+	__m256 x2 = _mm256_load_ps(m_pX2 + i);
+	__m256 y1 = _mm256_load_ps(m_pY1 + i);
+	__m256 y2 = _mm256_load_ps(m_pY2 + i);
+
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		__m256 x = _mm256_loadu_ps(pInput + n*uStride);
+		__m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a0, x), _mm256_mul_ps(a1, x1)), _mm256_mul_ps(a2, x2));
+		y = _mm256_sub_ps(_mm256_sub_ps(y, _mm256_mul_ps(b1, y1)), _mm256_mul_ps(b2, y2));
+		_mm256_storeu_ps(pOutput + n*uStride, y);
+
+		x2 = x1;
+		x1 = x;
+		y2 = y1;
+		y1 = y;
+	}
+
+	_mm256_store_ps(m_pX1 + i, x1);
+	_mm256_store_ps(m_pX2 + i, x2);
+	_mm256_store_ps(m_pY1 + i, y1);
+	_mm256_store_ps(m_pY2 + i, y2);
+#elif RAFX_OBJECTS_SSE
+	// --- two 4-lane halves per group
+	for(UINT h = 0; h < 2; h++)
+	{
+		UINT k = i + 4*h;
+		__m128 a0 = _mm_load_ps(m_pA0 + k);
+		__m128 a1 = _mm_load_ps(m_pA1 + k);
+		__m128 a2 = _mm_load_ps(m_pA2 + k);
+		__m128 b1 = _mm_load_ps(m_pB1 + k);
+		__m128 b2 = _mm_load_ps(m_pB2 + k);
+		__m128 x1 = _mm_load_ps(m_pX1 + k);
+		__m128 x2 = _mm_load_ps(m_pX2 + k);
+		__m128 y1 = _mm_load_ps(m_pY1 + k);
+		__m128 y2 = _mm_load_ps(m_pY2 + k);
+
+		for(UINT n = 0; n < uFrames; n++)
+		{
+			__m128 x = _mm_loadu_ps(pInput + n*uStride + 4*h);
+			__m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, x), _mm_mul_ps(a1, x1)), _mm_mul_ps(a2, x2));
+			y = _mm_sub_ps(_mm_sub_ps(y, _mm_mul_ps(b1, y1)), _mm_mul_ps(b2, y2));
+			_mm_storeu_ps(pOutput + n*uStride + 4*h, y);
+
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+		}
 
+		_mm_store_ps(m_pX1 + k, x1);
+		_mm_store_ps(m_pX2 + k, x2);
+		_mm_store_ps(m_pY1 + k, y1);
+		_mm_store_ps(m_pY2 + k, y2);
+	}
+#else
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		const float* x = pInput + n*uStride;
+		float* y = pOutput + n*uStride;
+		for(UINT l = 0; l < BIQUAD_BANK_LANES; l++)
+		{
+			UINT k = i + l;
+			y[l] = m_pA0[k]*x[l] + m_pA1[k]*m_pX1[k] + m_pA2[k]*m_pX2[k] - m_pB1[k]*m_pY1[k] - m_pB2[k]*m_pY2[k];
+			m_pX2[k] = m_pX1[k];
+			m_pX1[k] = x[l];
+			m_pY2[k] = m_pY1[k];
+			m_pY1[k] = y[l];
+		}
+	}
+#endif
 }
-// prompts with file open dialog, returns TRUE if successfuly
-// opened and parsed the file into the member m_pWaveBuffer
-bool CWaveData::initWithUserWAVFile(char* pInitDir)
+
+void CBiQuadBank::process(float** ppInput, float** ppOutput, UINT uFrames)
 {
-	OPENFILENAME ofn; // common dialog box structure
-	char szFile[260]; // buffer for file name
+	if(!m_pMemory)
+		return;
 
-    // open a file name
-	ZeroMemory( &ofn , sizeof( ofn));
-	ofn.lStructSize = sizeof ( ofn );
-	ofn.hwndOwner = NULL  ;
-	ofn.lpstrFile = szFile ;
-	ofn.lpstrFile[0] = '\0';
-	ofn.nMaxFile = sizeof(szFile);
-	ofn.lpstrFilter = "Wave\0*.WAV\0";
-	ofn.nFilterIndex =1;
-	ofn.lpstrFileTitle = NULL ;
-	ofn.nMaxFileTitle = 0 ;
-	ofn.lpstrInitialDir=pInitDir ; // you can default to a directory here
-	ofn.Flags = OFN_PATHMUSTEXIST|OFN_FILEMUSTEXIST ;
+	// --- group outer, so each group's state stays in registers/cache for the whole buffer
+	for(UINT g = 0; g < m_uGroups; g++)
+	{
+		UINT uFirst = g*BIQUAD_BANK_LANES;
+		UINT uLanes = m_uChannels - uFirst < BIQUAD_BANK_LANES ? m_uChannels - uFirst : BIQUAD_BANK_LANES;
 
-	GetOpenFileName( &ofn );
+		for(UINT uStart = 0; uStart < uFrames; uStart += BIQUAD_BANK_BLOCK)
+		{
+			UINT uCount = uFrames - uStart < BIQUAD_BANK_BLOCK ? uFrames - uStart : BIQUAD_BANK_BLOCK;
 
-	if(!ofn.lpstrFile)
-		return false;
+			for(UINT l = 0; l < uLanes; l++)
+			{
+				const float* pIn = ppInput[uFirst + l] + uStart;
+				for(UINT n = 0; n < uCount; n++)
+					m_fTileIn[n*BIQUAD_BANK_LANES + l] = pIn[n];
+			}
 
-	m_bWaveLoaded = readWaveFile(ofn.lpstrFile);
+			processGroup(g, &m_fTileIn[0], &m_fTileOut[0], BIQUAD_BANK_LANES, uCount);
 
-	//// Now simply display the file name
-	// MessageBox ( NULL , ofn.lpstrFile , "File Name" , MB_OK);
+			for(UINT l = 0; l < uLanes; l++)
+			{
+				float* pOut = ppOutput[uFirst + l] + uStart;
+				for(UINT n = 0; n < uCount; n++)
+					pOut[n] = m_fTileOut[n*BIQUAD_BANK_LANES + l];
+			}
+		}
+	}
 
-	return m_bWaveLoaded;
+	flushDenormals();
 }
-#include <iostream>
-#include <fstream>
-#include <iomanip>
-using namespace std;
 
-// THE FOLLOWING TYPES ARE SUPPORTED:
-//
-// WAVE_FORMAT_PCM and WAVE_FORMAT_EXTENSIBLE
-//
-// 16-BIT Signed Integer PCM
-// 24-BIT Signed Integer PCM 3-ByteAlign
-// 24-BIT Signed Integer PCM 4-ByteAlign
-// 32-BIT Signed Integer PCM
-// 32-BIT Floating Point
-// 64-BIT Floating Point
-bool CWaveData::readWaveFile(char* pFilePath)
-{
-	bool bSampleLoaded = false;
-    bool bFailed = false;
-    RIFF_CHUNK RiffChunk = {{0}};
-    WAVE_FILE_HEADER WaveFileHeader;
-    DWORD dwIncrementBytes;
-    WAVE_SAMPLE WaveSample;
-	m_uNumChannels = 0;
-	m_uSampleRate = 0;
-	m_uSampleCount = 0;
+void CBiQuadBank::processInterleaved(const float* pInput, float* pOutput, UINT uFrames)
+{
+	if(!m_pMemory)
+		return;
 
-    // --- create filestream from open binary file
-    ifstream inFile;
-    inFile.open(pFilePath, std::ifstream::binary);
-
-    // --- OK?
-    bool bIsOpen = inFile.is_open();
-
-    if(!bIsOpen)
-        return false;
-
-    // --- this is used to identify each chunk
-    char szIdentifier[5] = {0};
-
-    // --- advance 12 chars
-    inFile.seekg(12);
-
-    // --- read first RiffChunk and the WaveFileHeader
-    inFile.read((char*)(&RiffChunk), sizeof(RiffChunk));
-    inFile.read((char*)(&WaveFileHeader), sizeof(WaveFileHeader));
-
-    // --- set the waveformatex
-    WaveSample.WaveFormatEx.wFormatTag      = WaveFileHeader.wFormatTag;
-    WaveSample.WaveFormatEx.nChannels       = WaveFileHeader.wChannels;
-    WaveSample.WaveFormatEx.nSamplesPerSec  = WaveFileHeader.dwSamplesPerSec;
-    WaveSample.WaveFormatEx.nAvgBytesPerSec = WaveFileHeader.dwAvgBytesPerSec;
-    WaveSample.WaveFormatEx.nBlockAlign     = WaveFileHeader.wBlockAlign;
-    WaveSample.WaveFormatEx.wBitsPerSample  = WaveFileHeader.wBitsPerSample;
-    WaveSample.WaveFormatEx.cbSize          = 0;
-
-    // --- I don't support these types (compressed, uLaw/aLaw, etc..)
-    if(WaveSample.WaveFormatEx.wFormatTag != 1 && WaveSample.WaveFormatEx.wFormatTag != 3)
-    {
-        inFile.close();
-        return false;
-    }
-
-    // --- for backing up the first seek
-    dwIncrementBytes = sizeof(WaveFileHeader);
-
-    do {
-        // RiffChunk.dwLength - dwIncrementBytes sets the file pointer to position 0 first time through
-        // advance by RiffChunk.dwLength - dwIncrementBytes
-        int position = inFile.tellg();
-        inFile.seekg(position + (RiffChunk.dwLength - dwIncrementBytes));
-
-        // --- advanced past end of file?
-        bFailed = inFile.fail();
-
-        if(!bFailed)
-        {
-            // --- read the RiffChunk
-            inFile.read((char*)(&RiffChunk), sizeof(RiffChunk));
-
-            // --- this now makes the seekg() advance in RiffChunk.dwLength chunks
-            //     which vary with the type of chunk
-            dwIncrementBytes = 0;
-
-            // --- extract the chunk identifier
-            memcpy(szIdentifier, RiffChunk.IdentifierString, 4);
-        }
-
-    } while(strcmp(szIdentifier, "data") && !bFailed);
-
-    // --- AUDIO DATA CHUNK data
-    // --- 16 bit
-    if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 16)
-    {
-		WaveSample.pSampleData = (char *)LocalAlloc(LMEM_ZEROINIT, RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        if(m_pWaveBuffer)
-            delete [] m_pWaveBuffer;
-
-        m_pWaveBuffer = new float[nSampleCount];
-        short* pShorts = new short[nSampleCount];
-        memset(pShorts, 0, nSampleCount*sizeof(short));
-        int m = 0;
-        for(UINT i=0; i<nSampleCount; i++)
-        {
-            // MSB
-            pShorts[i] = (unsigned char)WaveSample.pSampleData[m+1];
-            pShorts[i] <<= 8;
-
-            // LSB
-            short lsb = (unsigned char)WaveSample.pSampleData[m];
-            // in case top of lsb is bad
-            lsb &= 0x00FF;
-            pShorts[i] |= lsb;
-            m+=2;
-        }
-
-        // convet to float -1.0 -> +1.0
-        for(UINT i = 0; i < nSampleCount; i++)
-        {
-            m_pWaveBuffer[i] = ((float)pShorts[i])/32768.0;
-        }
-
-        delete [] pShorts;
-        LocalFree(WaveSample.pSampleData);
-
-        bSampleLoaded = true;
-    }
-    // --- 24 bits
-    else if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 24)
-    {
-		WaveSample.pSampleData = (char *)LocalAlloc(LMEM_ZEROINIT, RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        if(m_pWaveBuffer)
-            delete [] m_pWaveBuffer;
-
-        // our buffer gets created
-        m_pWaveBuffer = new float[nSampleCount];
-
-        int* pSignedInts = new int[nSampleCount];
-        memset(pSignedInts, 0, nSampleCount*sizeof(long));
-
-        int m = 0;
-        int mask = 0x000000FF;
-
-        // 24-bits in 3-byte packs
-        if(WaveSample.WaveFormatEx.nBlockAlign/WaveSample.WaveFormatEx.nChannels == 3)
-        {
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+2];
-                pSignedInts[i] <<= 24;
-
-                // NSB
-                int nsb = (int)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pSignedInts[i] |= nsb;
-
-                // LSB
-                int lsb = (int)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                lsb <<= 8;
-                pSignedInts[i] |= lsb;
-
-                m+=3;
-            }
-        }
-
-        // --- 24-bits in 4-byte packs
-        if(WaveSample.WaveFormatEx.nBlockAlign/WaveSample.WaveFormatEx.nChannels == 4)
-        {
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+3];
-                pSignedInts[i] <<= 24;
-
-                // NSB
-                int nsb = (int)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pSignedInts[i] |= nsb;
-
-                // NSB2
-                int nsb2 = (int)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 8;
-                pSignedInts[i] |= nsb2;
-
-                // LSB
-                int lsb = (int)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pSignedInts[i] |= lsb;
-
-                m+=4;
-            }
-        }
-
-        // convet to float -1.0 -> +1.0
-        for(UINT i = 0; i < nSampleCount; i++)
-        {
-            m_pWaveBuffer[i] = ((float)pSignedInts[i])/2147483648.0; // 2147483648.0 = 1/2 of 2^32
-        }
-
-        delete [] pSignedInts;
-        LocalFree(WaveSample.pSampleData);
-
-        bSampleLoaded = true;
-
-    }
-    // --- 32 bits
-    else if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 32)
-    {
-		WaveSample.pSampleData = (char *)LocalAlloc(LMEM_ZEROINIT, RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        if(m_pWaveBuffer)
-            delete [] m_pWaveBuffer;
-
-        // our buffer gets created
-        m_pWaveBuffer = new float[nSampleCount];
-
-        if(WaveSample.WaveFormatEx.wFormatTag == 1)
-        {
-            int* pSignedInts = new int[nSampleCount];
-            memset(pSignedInts, 0, nSampleCount*sizeof(int));
-
-            int m = 0;
-            int mask = 0x000000FF;
-
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+3];
-                pSignedInts[i] <<= 24;
-
-                // NSB
-                int nsb = (int)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pSignedInts[i] |= nsb;
-
-                // NSB2
-                int nsb2 = (int)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 8;
-                pSignedInts[i] |= nsb2;
-
-                // LSB
-                int lsb = (int)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pSignedInts[i] |= lsb;
-
-                m+=4;
-            }
-
-            // convet to float -1.0 -> +1.0
-            for(UINT i = 0; i < nSampleCount; i++)
-            {
-                m_pWaveBuffer[i] = ((float)pSignedInts[i])/2147483648.0; // 2147483648.0 = 1/2 of 2^32
-            }
-
-            delete [] pSignedInts;
-            // free(WaveSample.pSampleData);
-
-            bSampleLoaded = true;
-        }
-        else if(WaveSample.WaveFormatEx.wFormatTag == 3) // float
-        {
-            unsigned int* pUSignedInts = new unsigned int[nSampleCount];
-            memset(pUSignedInts, 0, nSampleCount*sizeof(unsigned int));
-
-            int m = 0;
-            int mask = 0x000000FF;
-
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pUSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+3];
-                pUSignedInts[i] <<= 24;
-
-                // NSB
-                int nsb = (unsigned int)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pUSignedInts[i] |= nsb;
-
-                // NSB2
-                int nsb2 = (unsigned int)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 8;
-                pUSignedInts[i] |= nsb2;
-
-                // LSB
-                int lsb = (unsigned int)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pUSignedInts[i] |= lsb;
-
-                m+=4;
-            }
-
-            // Use the Union trick to re-use same memory location as two different data types
-            //
-            // see: http://www.cplusplus.com/doc/tutorial/other_data_types/#union
-            UWaveData wd;
-            for(UINT i = 0; i < nSampleCount; i++)
-            {
-                // save uint version
-                wd.u = pUSignedInts[i];
-                m_pWaveBuffer[i] = wd.f;
-            }
-
-            delete []pUSignedInts;
-            LocalFree(WaveSample.pSampleData);
-
-            bSampleLoaded = true;
-        }
-    }
-    // --- 64 bits
-    else if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 64)
-    {
-		WaveSample.pSampleData = (char *)LocalAlloc(LMEM_ZEROINIT, RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        if(m_pWaveBuffer)
-            delete [] m_pWaveBuffer;
-
-        // our buffer gets created
-        m_pWaveBuffer = new float[nSampleCount];
-
-        // floating point only
-        if(WaveSample.WaveFormatEx.wFormatTag == 3) // float
-        {
-            unsigned long long* pUSignedLongLongs = new unsigned long long[nSampleCount];
-            memset(pUSignedLongLongs, 0, nSampleCount*sizeof(unsigned long long));
-
-            int m = 0;
-            unsigned long long mask = 0x00000000000000FF;
-
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pUSignedLongLongs[i] = (unsigned char)WaveSample.pSampleData[m+7];
-                pUSignedLongLongs[i] <<= 56;
-
-                // NSB
-                unsigned long long nsb = (unsigned long long)WaveSample.pSampleData[m+6];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 48;
-                pUSignedLongLongs[i] |= nsb;
-
-                // NSB2
-                unsigned long long nsb2 = (unsigned long long)WaveSample.pSampleData[m+5];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 40;
-                pUSignedLongLongs[i] |= nsb2;
-
-                // NSB3
-                unsigned long long nsb3 = (unsigned long long)WaveSample.pSampleData[m+4];
-                // in case top of nsb is bad
-                nsb3 &= mask;
-                nsb3 <<= 32;
-                pUSignedLongLongs[i] |= nsb3;
-
-                // NSB4
-                unsigned long long nsb4 = (unsigned long long)WaveSample.pSampleData[m+3];
-                // in case top of nsb is bad
-                nsb4 &= mask;
-                nsb4 <<= 24;
-                pUSignedLongLongs[i] |= nsb4;
-
-                // NSB5
-                unsigned long long nsb5 = (unsigned long long)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb5 &= mask;
-                nsb5 <<= 16;
-                pUSignedLongLongs[i] |= nsb5;
-
-                // NSB6
-                unsigned long long nsb6 = (unsigned long long)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb6 &= mask;
-                nsb6 <<= 8;
-                pUSignedLongLongs[i] |= nsb6;
-
-                // LSB
-                unsigned long long lsb = (unsigned long long)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pUSignedLongLongs[i] |= lsb;
-
-                m+=8;
-            }
-
-            // Use the Union trick to re-use same memory location as two different data types
-            //
-            // see: http://www.cplusplus.com/doc/tutorial/other_data_types/#union
-            UWaveData wd;
-            for(UINT i = 0; i < nSampleCount; i++)
-            {
-                wd.u64 = pUSignedLongLongs[i];
-                m_pWaveBuffer[i] = (float)wd.d; // cast the union's double as a float to chop off bottom
-            }
-
-            delete [] pUSignedLongLongs;
-            LocalFree(WaveSample.pSampleData);
-
-            bSampleLoaded = true;
-        }
-    }
-
-    // --- now find the loops, MIDI note info, etc... (smpl)
-    int dInc = 0;
-    do {
-        int position = inFile.tellg();
-		if(position < 0)
-			bFailed = true;
-		else
+	UINT uStride = m_uChannels;
+	for(UINT g = 0; g < m_uGroups; g++)
+	{
+		UINT uFirst = g*BIQUAD_BANK_LANES;
+
+		// --- full group: straight from the frames
+		if(uFirst + BIQUAD_BANK_LANES <= m_uChannels)
 		{
-			inFile.seekg(position + dInc);
-			bFailed = inFile.fail();
+			processGroup(g, pInput + uFirst, pOutput + uFirst, uStride, uFrames);
+			continue;
 		}
 
-        if(!bFailed)
-        {
-            // --- read chunk, looking for 'smpl'
-            inFile.read((char*)(&RiffChunk), sizeof(RiffChunk));
-            dInc = RiffChunk.dwLength;
-            memcpy(szIdentifier, RiffChunk.IdentifierString, 4);
-        }
-    } while(strcmp(szIdentifier, "smpl") && !bFailed) ;
-
-    // Found a smpl chunk
-    /* smpl CHUNK format
-     Offset	Size	Description			Value
-     0x00	4	Chunk ID			"smpl" (0x736D706C)
-     0x04	4	Chunk Data Size		36 + (Num Sample Loops * 24) + Sampler Data
-     0x08	4	Manufacturer		0 - 0xFFFFFFFF	<------ // SKIPPING THIS //
-     0x0C	4	Product				0 - 0xFFFFFFFF	<------ // SKIPPING THIS //
-     0x10	4	Sample Period		0 - 0xFFFFFFFF	<------ // SKIPPING THIS (already know it)//
-     0x14	4	MIDI Unity Note		0 - 127
-     0x18	4	MIDI Pitch Fraction	0 - 0xFFFFFFFF
-     0x1C	4	SMPTE Format		0, 24, 25, 29, 30
-     0x20	4	SMPTE Offset		0 - 0xFFFFFFFF
-     0x24	4	Num Sample Loops	0 - 0xFFFFFFFF
-     0x28	4	Sampler Data		0 - 0xFFFFFFFF
-     0x2C
-     List of Sample Loops ------------------ //
-
-     MIDI Unity Note
-     The MIDI unity note value has the same meaning as the instrument chunk's MIDI Unshifted Note field which
-     specifies the musical note at which the sample will be played at it's original sample rate
-     (the sample rate specified in the format chunk).
-
-     MIDI Pitch Fraction
-     The MIDI pitch fraction specifies the fraction of a semitone up from the specified MIDI unity note field.
-     A value of 0x80000000 means 1/2 semitone (50 cents) and a value of 0x00000000 means no fine tuning
-     between semitones.
-
-     SMPTE Format
-     The SMPTE format specifies the Society of Motion Pictures and Television E time format used in the
-     following SMPTE Offset field. If a value of 0 is set, SMPTE Offset should also be set to 0.
-     Value	SMPTE Format
-     0	no SMPTE offset
-     24	24 frames per second
-     25	25 frames per second
-     29	30 frames per second with frame dropping (30 drop)
-     30	30 frames per second
-
-     SMPTE Offset
-     The SMPTE Offset value specifies the time offset to be used for the synchronization / calibration
-     to the first sample in the waveform. This value uses a format of 0xhhmmssff where hh is a signed value
-     that specifies the number of hours (-23 to 23), mm is an unsigned value that specifies the
-     number of minutes (0 to 59), ss is an unsigned value that specifies the number of seconds
-     (0 to 59) and ff is an unsigned value that specifies the number of frames (0 to -1).
-
-     // Sample Loop Data Struct
-     Offset	Size	Description		Value
-     0x00	4	Cue Point ID	0 - 0xFFFFFFFF
-     0x04	4	Type			0 - 0xFFFFFFFF
-     0x08	4	Start			0 - 0xFFFFFFFF
-     0x0C	4	End				0 - 0xFFFFFFFF
-     0x10	4	Fraction		0 - 0xFFFFFFFF
-     0x14	4	Play Count		0 - 0xFFFFFFFF
-
-     Loop type:
-     Value	Loop Type
-     0	Loop forward (normal)
-     1	Alternating loop (forward/backward, also known as Ping Pong)
-     2	Loop backward (reverse)
-     3 - 31	Reserved for future standard types
-     32 - 0xFFFFFFFF	Sampler specific types (defined by manufacturer)*/
-
-
-    // skipping some stuff; could add later
-    if(!bFailed)
-    {
-        dInc = 12; // 3 don't cares 4 bytes each
-        m_uLoopType = 0;
-        m_uLoopCount = 0;
-        m_uLoopStartIndex = 0;
-        m_uLoopEndIndex = 0;
-        m_uMIDINote = 0;
-        m_uMIDIPitchFraction = 0;
-        m_uSMPTEFormat = 0;
-        m_uSMPTEOffset = 0;
-
-        // found a loop set; currently only taking the FIRST loop set
-        // only need one loop set for potentially sustaining waves
-        int position = inFile.tellg();
-        inFile.seekg(position + dInc);
-
-        // --- MIDI Note Number
-        inFile.read((char*)(&m_uMIDINote), 4);
-
-        // --- m_uMIDIPitchFraction
-        inFile.read((char*)(&m_uMIDIPitchFraction), 4);
-
-        // --- m_uSMPTEFormat
-        inFile.read((char*)(&m_uSMPTEFormat), 4);
-
-        // --- m_uSMPTEOffset
-        inFile.read((char*)(&m_uSMPTEOffset), 4);
-
-        // --- MIDI Note Number
-        inFile.read((char*)(&m_uLoopCount), 4);
-
-        // --- skip cuepoint & sampledata
-        position = inFile.tellg();
-        inFile.seekg(position + 8);
-
-        // --- m_uLoopType
-        inFile.read((char*)(&m_uLoopType), 4);
-
-        // --- loop start sample
-        inFile.read((char*)(&m_uLoopStartIndex), 4);
-        m_uLoopStartIndex *= m_uNumChannels;
-
-        // --- loop end sample
-        inFile.read((char*)(&m_uLoopEndIndex), 4);
-        m_uLoopEndIndex *= m_uNumChannels;
-    }
-    else  // no loops
-    {
-        m_uLoopType = 0;
-        m_uLoopCount = 0;
-        m_uLoopStartIndex = 0;
-        m_uLoopEndIndex = 0;
-        m_uMIDINote = 0;
-        m_uMIDIPitchFraction = 0;
-        m_uSMPTEFormat = 0;
-        m_uSMPTEOffset = 0;
-    }
-
-    // --- close the file
-    inFile.close();
-
-    // --- hope we got one loaded!
-    return bSampleLoaded;
-}
+		// --- the partial last group would read/write past its channels, so go through the tiles
+		UINT uLanes = m_uChannels - uFirst;
+		for(UINT uStart = 0; uStart < uFrames; uStart += BIQUAD_BANK_BLOCK)
+		{
+			UINT uCount = uFrames - uStart < BIQUAD_BANK_BLOCK ? uFrames - uStart : BIQUAD_BANK_BLOCK;
 
-#else
-#include <iostream>
-#include <fstream>
-#include <iomanip>
-#include "MacTypes.h"
-using namespace std;
-
-// union for data conversion
-union UWaveData
-{
-	Float32 f;
-	Float64 d;
-	int n;
-	UInt32 u;
-	UInt64 u64;
-};
+			for(UINT n = 0; n < uCount; n++)
+				for(UINT l = 0; l < uLanes; l++)
+					m_fTileIn[n*BIQUAD_BANK_LANES + l] = pInput[(uStart + n)*uStride + uFirst + l];
 
-typedef struct {
-    UCHAR  IdentifierString[4];
-    UInt32 dwLength;
-} RIFF_CHUNK, *PRIFF_CHUNK;
-
-typedef struct {
-    UInt16  wFormatTag;         // Format category
-    UInt16  wChannels;          // Number of channels
-    UInt32  dwSamplesPerSec;    // Sampling rate
-    UInt32  dwAvgBytesPerSec;   // For buffer estimation
-    UInt16  wBlockAlign;        // Data block size
-    UInt16  wBitsPerSample;
-} WAVE_FILE_HEADER, *PWAVE_FILE_HEADER;
-
-typedef struct
-{
-    UInt16        wFormatTag;         /* format type */
-    UInt16        nChannels;          /* number of channels (i.e. mono, stereo...) */
-    UInt32        nSamplesPerSec;     /* sample rate */
-    UInt32        nAvgBytesPerSec;    /* for buffer estimation */
-    UInt16        nBlockAlign;        /* block size of data */
-    UInt16        wBitsPerSample;     /* number of bits per sample of mono data */
-    UInt16        cbSize;             /* the count in bytes of the size of */
-    /* extra information (after cbSize) */
-} WAVEFORMATEX, *PWAVEFORMATEX;
-
-typedef struct _wave_sample {
-    WAVEFORMATEX    WaveFormatEx;
-    char            *pSampleData;
-    char            *pFXSampleData;
-    UInt32          Index;
-    UInt32          FXIndex;
-    UInt32          Size;
-    UInt32          dwId;
-    UInt32          bPlaying;
-    struct _wave_sample *pNext;
-
-} WAVE_SAMPLE, *PWAVE_SAMPLE;
-
-
-
-// CWaveData
-CWaveData::CWaveData(char* pFilePath)
-{
-	m_bWaveLoaded = false;
+			processGroup(g, &m_fTileIn[0], &m_fTileOut[0], BIQUAD_BANK_LANES, uCount);
+
+			for(UINT n = 0; n < uCount; n++)
+				for(UINT l = 0; l < uLanes; l++)
+					pOutput[(uStart + n)*uStride + uFirst + l] = m_fTileOut[n*BIQUAD_BANK_LANES + l];
+		}
+	}
+
+	flushDenormals();
+}
+
+
+// CParallelIIR Implementation ----------------------------------------------------------------
+//
+CParallelIIR::CParallelIIR(void)
+{
+	memset(m_fD0, 0, sizeof(m_fD0));
+	memset(m_fD1, 0, sizeof(m_fD1));
+	memset(m_fB1, 0, sizeof(m_fB1));
+	memset(m_fB2, 0, sizeof(m_fB2));
+	m_fC0 = 1.0;
+	m_uSections = 0;
+	flushDelays();
+}
+
+CParallelIIR::~CParallelIIR(void)
+{
+}
+
+void CParallelIIR::flushDelays()
+{
+	memset(m_fY1, 0, sizeof(m_fY1));
+	memset(m_fY2, 0, sizeof(m_fY2));
+	m_fX1 = 0.0;
+}
+
+typedef std::complex<double> complexd;
+
+// --- the poles of a section: the roots of z^2 + b1 z + b2, so that
+//     1 + b1 w + b2 w^2 = (1 - p w)(1 - q w) with w = z^-1
+static void sectionPoles(const float* pCoeffs, UINT uSection, complexd* pPoles)
+{
+	double b1 = pCoeffs[5*uSection + 3];
+	double b2 = pCoeffs[5*uSection + 4];
+	complexd sq = sqrt(complexd(b1*b1 - 4.0*b2, 0.0));
+	pPoles[0] = 0.5*(-b1 + sq);
+	pPoles[1] = 0.5*(-b1 - sq);
+}
+
+// --- L2 norm of the impulse response of the numerators of sections
+//     [uNum0, uNum1) over the denominators of sections [uDen0, uDen1), from its
+//     partial fractions h[0] = H(0), h[n > 0] = sum r_i p_i^n; distinct poles
+static double cascadeNorm(const float* pCoeffs, UINT uNum0, UINT uNum1, UINT uDen0, UINT uDen1)
+{
+	complexd poles[2*PARALLEL_IIR_MAX_SECTIONS];
+	complexd residues[2*PARALLEL_IIR_MAX_SECTIONS];
+	UINT uPoles = 2*(uDen1 - uDen0);
+	for(UINT k = uDen0; k < uDen1; k++)
+		sectionPoles(pCoeffs, k, &poles[2*(k - uDen0)]);
+
+	double dH0 = 1.0;
+	for(UINT k = uNum0; k < uNum1; k++)
+		dH0 *= pCoeffs[5*k];
+
+	for(UINT i = 0; i < uPoles; i++)
+	{
+		complexd w = 1.0/poles[i];
+		complexd num = 1.0;
+		complexd den = 1.0;
+		for(UINT k = uNum0; k < uNum1; k++)
+		{
+			const float* c = pCoeffs + 5*k;
+			num *= (double)c[0] + w*((double)c[1] + w*(double)c[2]);
+		}
+		for(UINT j = 0; j < uPoles; j++)
+		{
+			if(j != i)
+				den *= 1.0 - poles[j]*w;
+		}
+		residues[i] = num/den;
+	}
+
+	// --- sum over n > 0 of |sum r_i p_i^n|^2, as geometric series
+	complexd sum = 0.0;
+	for(UINT i = 0; i < uPoles; i++)
+	{
+		for(UINT j = 0; j < uPoles; j++)
+		{
+			complexd pp = poles[i]*conj(poles[j]);
+			sum += residues[i]*conj(residues[j])*pp/(1.0 - pp);
+		}
+	}
+
+	return sqrt(dH0*dH0 + sum.real());
+}
+
+bool CParallelIIR::setFromCascade(const float* pCoeffs, UINT uSections)
+{
+	if(uSections == 0 || uSections > PARALLEL_IIR_MAX_SECTIONS)
+		return false;
+
+	complexd poles[2*PARALLEL_IIR_MAX_SECTIONS];
+	for(UINT k = 0; k < uSections; k++)
+		sectionPoles(pCoeffs, k, &poles[2*k]);
+
+	// --- simple, non-zero, stable poles only
+	UINT uPoles = 2*uSections;
+	for(UINT i = 0; i < uPoles; i++)
+	{
+		if(abs(poles[i]) < 1.0e-12 || abs(poles[i]) >= 1.0)
+			return false;
+		for(UINT j = i + 1; j < uPoles; j++)
+		{
+			if(abs(poles[i] - poles[j]) < 1.0e-9)
+				return false;
+		}
+	}
+
+	// --- residue at each pole: (1 - p w) H(w) at w = 1/p
+	complexd residues[2*PARALLEL_IIR_MAX_SECTIONS];
+	for(UINT i = 0; i < uPoles; i++)
+	{
+		complexd w = 1.0/poles[i];
+		complexd num = 1.0;
+		complexd den = 1.0 - poles[i ^ 1]*w;
+
+		for(UINT k = 0; k < uSections; k++)
+		{
+			const float* c = pCoeffs + 5*k;
+			num *= (double)c[0] + w*((double)c[1] + w*(double)c[2]);
+			if(k != i/2)
+				den *= 1.0 + w*((double)c[3] + w*(double)c[4]);
+		}
+		residues[i] = num/den;
+	}
+
+	// --- only where it beats the cascade: the round-off of each float section
+	//     is noise in proportion to its output (white input: the section's L2
+	//     norm) that goes round its own poles and, in the cascade, through the
+	//     sections after it. The parallel sections' outputs grow as the poles
+	//     crowd together and only cancel in the sum
+	double dParallelNoise = 0.0;
+	double dCascadeNoise = 0.0;
+	for(UINT k = 0; k < uSections; k++)
+	{
+		complexd sum = 0.0;
+		for(UINT a = 2*k; a < 2*k + 2; a++)
+		{
+			for(UINT b = 2*k; b < 2*k + 2; b++)
+				sum += residues[a]*conj(residues[b])/(1.0 - poles[a]*conj(poles[b]));
+		}
+		double dParallel = sqrt(sum.real())*cascadeNorm(pCoeffs, 0, 0, k, k + 1);
+		double dCascade = cascadeNorm(pCoeffs, 0, k + 1, 0, k + 1)*cascadeNorm(pCoeffs, k + 1, uSections, k, uSections);
+
+		dParallelNoise += dParallel*dParallel;
+		dCascadeNoise += dCascade*dCascade;
+	}
+	if(dParallelNoise > dCascadeNoise)
+		return false;
+
+	// --- combine each section's pair: r1/(1 - p1 w) + r2/(1 - p2 w) =
+	//     ((r1 + r2) - (r1 p2 + r2 p1) w)/(1 + b1 w + b2 w^2), real for real or conjugate pairs;
+	//     the direct term is what is left of H(0) = product of the a0s
+	double dDirect = 1.0;
+	for(UINT k = 0; k < uSections; k++)
+		dDirect *= pCoeffs[5*k];
+
+	memset(m_fD0, 0, sizeof(m_fD0));
+	memset(m_fD1, 0, sizeof(m_fD1));
+	memset(m_fB1, 0, sizeof(m_fB1));
+	memset(m_fB2, 0, sizeof(m_fB2));
+
+	for(UINT k = 0; k < uSections; k++)
+	{
+		complexd r1 = residues[2*k];
+		complexd r2 = residues[2*k + 1];
+		complexd p1 = poles[2*k];
+		complexd p2 = poles[2*k + 1];
+
+		m_fD0[k] = (r1 + r2).real();
+		m_fD1[k] = -(r1*p2 + r2*p1).real();
+		m_fB1[k] = pCoeffs[5*k + 3];
+		m_fB2[k] = pCoeffs[5*k + 4];
+
+		dDirect -= (r1 + r2).real();
+	}
+	m_fC0 = dDirect;
+
+	// --- the states map onto the new sections only if the count is the same
+	if(uSections != m_uSections)
+		flushDelays();
+	m_uSections = uSections;
+
+	return true;
+}
+
+// --- y_k = d0_k*x + d1_k*x1 - b1_k*y1_k - b2_k*y2_k, out = c0*x + sum(y_k)
+float CParallelIIR::doParallelIIR(float xn)
+{
+	float fSum = m_fC0*xn;
+	for(UINT k = 0; k < m_uSections; k++)
+	{
+		float y = m_fD0[k]*xn + m_fD1[k]*m_fX1 - m_fB1[k]*m_fY1[k] - m_fB2[k]*m_fY2[k];
+		m_fY2[k] = m_fY1[k];
+		m_fY1[k] = y;
+		fSum += y;
+	}
+	m_fX1 = xn;
+
+	return fSum;
+}
+
+void CParallelIIR::processBlock(const float* pInput, float* pOutput, UINT uFrames)
+{
+	float x1 = m_fX1;
+
+#if RAFX_OBJECTS_AVX
+	__m256 d0 = _mm256_loadu_ps(&m_fD0[0]);
+	__m256 d1 = _mm256_loadu_ps(&m_fD1[0]);
+	__m256 b1 = _mm256_loadu_ps(&m_fB1[0]);
+	__m256 b2 = _mm256_loadu_ps(&m_fB2[0]);
+	__m256 y1 = _mm256_loadu_ps(&m_fY1[0]);
+	__m256 y2 = _mm256_loadu_ps(&m_fY2[0]);
+
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		float x = pInput[n];
+		__m256 y = _mm256_add_ps(_mm256_mul_ps(d0, _mm256_set1_ps(x)), _mm256_mul_ps(d1, _mm256_set1_ps(x1)));
+		y = _mm256_sub_ps(_mm256_sub_ps(y, _mm256_mul_ps(b1, y1)), _mm256_mul_ps(b2, y2));
+		y2 = y1;
+		y1 = y;
+
+		// --- sum the 8 lanes
+		__m128 s = _mm_add_ps(_mm256_castps256_ps128(y), _mm256_extractf128_ps(y, 1));
+		s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+		s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+
+		pOutput[n] = m_fC0*x + _mm_cvtss_f32(s);
+		x1 = x;
+	}
+
+	_mm256_storeu_ps(&m_fY1[0], y1);
+	_mm256_storeu_ps(&m_fY2[0], y2);
+#elif RAFX_OBJECTS_SSE
+	// --- one vector covers up to 4 sections; unused lanes are zero either way
+	bool bTwo = m_uSections > 4;
+	__m128 d0[2], d1[2], b1[2], b2[2], y1[2], y2[2];
+	for(UINT h = 0; h < 2; h++)
+	{
+		d0[h] = _mm_loadu_ps(&m_fD0[4*h]);
+		d1[h] = _mm_loadu_ps(&m_fD1[4*h]);
+		b1[h] = _mm_loadu_ps(&m_fB1[4*h]);
+		b2[h] = _mm_loadu_ps(&m_fB2[4*h]);
+		y1[h] = _mm_loadu_ps(&m_fY1[4*h]);
+		y2[h] = _mm_loadu_ps(&m_fY2[4*h]);
+	}
+
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		float x = pInput[n];
+		__m128 vx = _mm_set1_ps(x);
+		__m128 vx1 = _mm_set1_ps(x1);
+
+		__m128 y = _mm_add_ps(_mm_mul_ps(d0[0], vx), _mm_mul_ps(d1[0], vx1));
+		y = _mm_sub_ps(_mm_sub_ps(y, _mm_mul_ps(b1[0], y1[0])), _mm_mul_ps(b2[0], y2[0]));
+		y2[0] = y1[0];
+		y1[0] = y;
+		__m128 s = y;
+
+		if(bTwo)
+		{
+			y = _mm_add_ps(_mm_mul_ps(d0[1], vx), _mm_mul_ps(d1[1], vx1));
+			y = _mm_sub_ps(_mm_sub_ps(y, _mm_mul_ps(b1[1], y1[1])), _mm_mul_ps(b2[1], y2[1]));
+			y2[1] = y1[1];
+			y1[1] = y;
+			s = _mm_add_ps(s, y);
+		}
+
+		s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+		s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+
+		pOutput[n] = m_fC0*x + _mm_cvtss_f32(s);
+		x1 = x;
+	}
+
+	for(UINT h = 0; h < 2; h++)
+	{
+		_mm_storeu_ps(&m_fY1[4*h], y1[h]);
+		_mm_storeu_ps(&m_fY2[4*h], y2[h]);
+	}
+#else
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		float x = pInput[n];
+		float fSum = m_fC0*x;
+		for(UINT k = 0; k < m_uSections; k++)
+		{
+			float y = m_fD0[k]*x + m_fD1[k]*x1 - m_fB1[k]*m_fY1[k] - m_fB2[k]*m_fY2[k];
+			m_fY2[k] = m_fY1[k];
+			m_fY1[k] = y;
+			fSum += y;
+		}
+		pOutput[n] = fSum;
+		x1 = x;
+	}
+#endif
+
+	m_fX1 = x1;
+
+	// --- underflow check once per block
+	for(UINT k = 0; k < m_uSections; k++)
+	{
+		if(fabs(m_fY1[k]) < FLT_MIN_PLUS) m_fY1[k] = 0;
+		if(fabs(m_fY2[k]) < FLT_MIN_PLUS) m_fY2[k] = 0;
+	}
+}
+
+
+// CDynamicHPF Implementation ----------------------------------------------------------------
+//
+CDynamicHPF::CDynamicHPF(void)
+{
+	m_fSampleRate = 44100;
+	m_fMinCutoff_Hz = 30.0;
+	m_fMaxCutoff_Hz = 200.0;
+	m_fThreshold_dB = -30.0;
+	m_fRange_dB = 24.0;
+	m_fAttackTime_ms = 10.0;
+	m_fReleaseTime_ms = 200.0;
+	m_fLog10Range = 0.0;
+	m_fAmount = 0.0;
+	memset(m_fGTable, 0, sizeof(m_fGTable));
+	m_fG = 0.0;
+	m_fGIncrement = 0.0;
+	m_uControlCount = 0;
+
+	// --- mean-square detector; the dB conversion happens once per control block
+	m_Detector.init(m_fSampleRate, m_fAttackTime_ms, m_fReleaseTime_ms, true, DETECT_MODE_MS, false);
+
+	for(int i = 0; i < 2; i++)
+	{
+		m_Filter[i].setOutputType(SVF_HPF);
+		m_Filter[i].setQ(sqrt2over2);
+	}
+
+	// --- the table is built for the sample rate by init(), which runs before any audio
+	reset();
+}
+
+CDynamicHPF::~CDynamicHPF(void)
+{
+}
+
+void CDynamicHPF::init(float fSampleRate)
+{
+	m_fSampleRate = fSampleRate;
+	m_Detector.setSampleRate(fSampleRate);
+	m_Detector.setAttackTime(m_fAttackTime_ms);
+	m_Detector.setReleaseTime(m_fReleaseTime_ms);
+
+	for(int i = 0; i < 2; i++)
+		m_Filter[i].setSampleRate(fSampleRate);
+
+	buildTable();
+	reset();
+}
+
+void CDynamicHPF::setCutoffRange(float fMinCutoff_Hz, float fMaxCutoff_Hz)
+{
+	if(fMaxCutoff_Hz < fMinCutoff_Hz)
+		fMaxCutoff_Hz = fMinCutoff_Hz;
+
+	if(fMinCutoff_Hz == m_fMinCutoff_Hz && fMaxCutoff_Hz == m_fMaxCutoff_Hz)
+		return;
+
+	m_fMinCutoff_Hz = fMinCutoff_Hz;
+	m_fMaxCutoff_Hz = fMaxCutoff_Hz;
+
+	// --- the SVF tolerates the jump, so take the new range at once
+	buildTable();
+	m_fG = lookupG(m_fAmount);
+	m_fGIncrement = 0.0;
+	for(int i = 0; i < 2; i++)
+		m_Filter[i].setCoefficients(m_fG);
+}
+
+void CDynamicHPF::setThreshold(float fThreshold_dB, float fRange_dB)
+{
+	m_fThreshold_dB = fThreshold_dB;
+	m_fRange_dB = fRange_dB > 1.0 ? fRange_dB : 1.0;
+}
+
+void CDynamicHPF::setAttackRelease(float fAttack_ms, float fRelease_ms)
+{
+	m_fAttackTime_ms = fAttack_ms;
+	m_fReleaseTime_ms = fRelease_ms;
+	m_Detector.setAttackTime(fAttack_ms);
+	m_Detector.setReleaseTime(fRelease_ms);
+}
+
+void CDynamicHPF::reset()
+{
+	m_DetectorLPF.flushDelays();
+	m_Detector.prepareForPlay();
+	m_fAmount = 0.0;
+	m_fG = lookupG(0.0);
+	m_fGIncrement = 0.0;
+	m_uControlCount = 0;
+
+	for(int i = 0; i < 2; i++)
+	{
+		m_Filter[i].flushDelays();
+		m_Filter[i].setCoefficients(m_fG);
+	}
+}
+
+// --- g at log spaced cutoffs over [min, max], so the amount is a linear octave
+//     position along the table; also sets the detector's B2 LPF at the max cutoff
+void CDynamicHPF::buildTable()
+{
+	float fNyquistLimit = 0.45*m_fSampleRate;
+	float fMin = m_fMinCutoff_Hz < fNyquistLimit ? m_fMinCutoff_Hz : fNyquistLimit;
+	float fMax = m_fMaxCutoff_Hz < fNyquistLimit ? m_fMaxCutoff_Hz : fNyquistLimit;
+
+	m_fLog10Range = log10(fMax/fMin);
+
+	for(UINT i = 0; i < DYN_HPF_TABLE_SIZE; i++)
+	{
+		float fFrac = (float)i/(float)(DYN_HPF_TABLE_SIZE - 1);
+		float fCutoff = fMin*pow(fMax/fMin, fFrac);
+		m_fGTable[i] = tan(pi*fCutoff/m_fSampleRate);
+	}
+	m_fGTable[DYN_HPF_TABLE_SIZE] = m_fGTable[DYN_HPF_TABLE_SIZE - 1];
+
+	float C = 1.0/tan(pi*fMax/m_fSampleRate);
+	float a0 = 1.0/(1.0 + sqrt2over2*2.0*C + C*C);
+	m_DetectorLPF.m_f_a0 = a0;
+	m_DetectorLPF.m_f_a1 = 2.0*a0;
+	m_DetectorLPF.m_f_a2 = a0;
+	m_DetectorLPF.m_f_b1 = 2.0*a0*(1.0 - C*C);
+	m_DetectorLPF.m_f_b2 = a0*(1.0 - sqrt2over2*2.0*C + C*C);
+}
+
+float CDynamicHPF::lookupG(float fAmount)
+{
+	float fIndex = fAmount*(float)(DYN_HPF_TABLE_SIZE - 1);
+	UINT uIndex = (UINT)fIndex;
+	float fFrac = fIndex - (float)uIndex;
+
+	return m_fGTable[uIndex] + fFrac*(m_fGTable[uIndex + 1] - m_fGTable[uIndex]);
+}
+
+void CDynamicHPF::updateCoefficients(float fEnvelope)
+{
+	// --- mean-square envelope, so 10log10
+	float fEnvelope_dB = fEnvelope > 0.0 ? 10.0*log10(fEnvelope) : -96.0;
+	float fAmount = (fEnvelope_dB - m_fThreshold_dB)/m_fRange_dB;
+	if(fAmount < 0.0) fAmount = 0.0;
+	if(fAmount > 1.0) fAmount = 1.0;
+
+	m_fAmount = fAmount;
+	m_fGIncrement = (lookupG(fAmount) - m_fG)/(float)DYN_HPF_CONTROL_RATE;
+}
+
+void CDynamicHPF::processFrame(float* pInput, float* pOutput, UINT uChannels, float* pSidechain, UINT uSidechainChannels)
+{
+	// --- detector input: sidechain or the input, summed to mono, band-limited
+	float fDetect = 0.0;
+	if(pSidechain)
+		fDetect = uSidechainChannels == 2 ? 0.5*(pSidechain[0] + pSidechain[1]) : pSidechain[0];
+	else
+		fDetect = uChannels == 2 ? 0.5*(pInput[0] + pInput[1]) : pInput[0];
+
+	float fEnvelope = m_Detector.detect(m_DetectorLPF.doBiQuad(fDetect));
+
+	// --- control rate: envelope -> table g -> ramp over the next control block
+	if(++m_uControlCount >= DYN_HPF_CONTROL_RATE)
+	{
+		m_uControlCount = 0;
+		updateCoefficients(fEnvelope);
+	}
+
+	// --- audio rate cutoff; the ramp lands on the target at the next control tick
+	m_fG += m_fGIncrement;
+	m_Filter[0].setCoefficients(m_fG);
+	pOutput[0] = m_Filter[0].doSVF(pInput[0]);
+	if(uChannels == 2)
+	{
+		m_Filter[1].setCoefficients(m_fG);
+		pOutput[1] = m_Filter[1].doSVF(pInput[1]);
+	}
+}
+
+float CDynamicHPF::getCutoff()
+{
+	return m_fMinCutoff_Hz*pow(10.0, m_fAmount*m_fLog10Range);
+}
+
+// CLinkwitzRileyCrossover Implementation ----------------------------------------------------------------
+//
+CLinkwitzRileyCrossover::CLinkwitzRileyCrossover(void)
+{
+	m_fSampleRate = 44100;
+	m_uBands = 2;
+	m_uSections = 2;
+	m_uVectors = 1;
+	m_uFrameCount = 0;
+	m_fGainSmoothing = 1.0;
+	m_bCoeffsDirty = true;
+	m_bGainsDirty = true;
+
+	m_fCrossover_Hz[0] = 100.0;
+	m_fCrossover_Hz[1] = 1000.0;
+	m_fCrossover_Hz[2] = 5000.0;
+
+	for(UINT i = 0; i < LR_XOVER_MAX_BANDS; i++)
+	{
+		m_fBandGain_dB[i] = 0.0;
+		m_bBandMute[i] = false;
+	}
+
+	init(m_fSampleRate);
+}
+
+CLinkwitzRileyCrossover::~CLinkwitzRileyCrossover(void)
+{
+}
+
+void CLinkwitzRileyCrossover::init(float fSampleRate)
+{
+	m_fSampleRate = fSampleRate;
+
+	// --- ~5 ms gain smoothing
+	m_fGainSmoothing = 1.0 - exp(-1.0/(0.005*fSampleRate));
+
+	updateCoefficients();
+	reset();
+}
+
+void CLinkwitzRileyCrossover::setBandCount(UINT uBands)
+{
+	if(uBands < 2) uBands = 2;
+	if(uBands > LR_XOVER_MAX_BANDS) uBands = LR_XOVER_MAX_BANDS;
+
+	if(uBands == m_uBands)
+		return;
+
+	m_uBands = uBands;
+	m_uSections = 2*(uBands - 1);
+	m_uVectors = (2*uBands + 3)/4;
+
+	// --- the lanes change meaning, so start them from silence
+	updateCoefficients();
+	reset();
+}
+
+void CLinkwitzRileyCrossover::setCrossover(UINT uIndex, float fFrequency_Hz)
+{
+	if(uIndex >= LR_XOVER_MAX_BANDS - 1)
+		return;
+
+	m_fCrossover_Hz[uIndex] = fFrequency_Hz;
+	m_bCoeffsDirty = true;
+}
+
+void CLinkwitzRileyCrossover::setBandGain(UINT uBand, float fGain_dB)
+{
+	if(uBand >= LR_XOVER_MAX_BANDS)
+		return;
+
+	m_fBandGain_dB[uBand] = fGain_dB;
+	m_bGainsDirty = true;
+}
+
+void CLinkwitzRileyCrossover::setBandMute(UINT uBand, bool bMute)
+{
+	if(uBand >= LR_XOVER_MAX_BANDS)
+		return;
+
+	m_bBandMute[uBand] = bMute;
+	m_bGainsDirty = true;
+}
+
+void CLinkwitzRileyCrossover::reset()
+{
+	memset(m_fZ1, 0, sizeof(m_fZ1));
+	memset(m_fZ2, 0, sizeof(m_fZ2));
+
+	// --- no ramp after a reset
+	updateGains();
+	memcpy(m_fGain, m_fTargetGain, sizeof(m_fGain));
+	m_uFrameCount = 0;
+}
+
+// --- build every lane's cascade; unused lanes keep all-zero coefficients and output silence
+void CLinkwitzRileyCrossover::updateCoefficients()
+{
+	memset(m_fA0, 0, sizeof(m_fA0));
+	memset(m_fA1, 0, sizeof(m_fA1));
+	memset(m_fA2, 0, sizeof(m_fA2));
+	memset(m_fB1, 0, sizeof(m_fB1));
+	memset(m_fB2, 0, sizeof(m_fB2));
+
+	// --- clamp and sort the crossovers in use
+	UINT uCrossovers = m_uBands - 1;
+	float fLimit = 0.45*m_fSampleRate;
+	float fc[LR_XOVER_MAX_BANDS - 1];
+	for(UINT i = 0; i < uCrossovers; i++)
+	{
+		float f = m_fCrossover_Hz[i];
+		fc[i] = f < 10.0 ? 10.0 : (f > fLimit ? fLimit : f);
+
+		for(UINT j = i; j > 0 && fc[j] < fc[j - 1]; j--)
+		{
+			float fTemp = fc[j];
+			fc[j] = fc[j - 1];
+			fc[j - 1] = fTemp;
+		}
+	}
+
+	for(UINT k = 0; k < uCrossovers; k++)
+	{
+		// --- B2 prototype; LR4 LP/HP are two in cascade, their sum is the allpass
+		//     with the same poles and the numerator reversed
+		float C = tan(pi*fc[k]/m_fSampleRate);
+		float fNorm = 1.0/(1.0 + M_SQRT2*C + C*C);
+		float b1 = 2.0*fNorm*(C*C - 1.0);
+		float b2 = fNorm*(1.0 - M_SQRT2*C + C*C);
+
+		float fLP[3] = {fNorm*C*C, 2.0f*fNorm*C*C, fNorm*C*C};
+		float fHP[3] = {fNorm, -2.0f*fNorm, fNorm};
+		float fAP[3] = {b2, b1, 1.0};
+
+		for(UINT b = 0; b < m_uBands; b++)
+		{
+			float* pA = k < b ? &fHP[0] : (k == b ? &fLP[0] : &fAP[0]);
+			bool bAllpass = k > b;
+
+			for(UINT ch = 0; ch < 2; ch++)
+			{
+				UINT uLane = 2*b + ch;
+
+				m_fA0[2*k][uLane] = pA[0];
+				m_fA1[2*k][uLane] = pA[1];
+				m_fA2[2*k][uLane] = pA[2];
+				m_fB1[2*k][uLane] = b1;
+				m_fB2[2*k][uLane] = b2;
+
+				// --- second biquad of the unit; pass-through for an allpass
+				m_fA0[2*k + 1][uLane] = bAllpass ? 1.0 : pA[0];
+				m_fA1[2*k + 1][uLane] = bAllpass ? 0.0 : pA[1];
+				m_fA2[2*k + 1][uLane] = bAllpass ? 0.0 : pA[2];
+				m_fB1[2*k + 1][uLane] = bAllpass ? 0.0 : b1;
+				m_fB2[2*k + 1][uLane] = bAllpass ? 0.0 : b2;
+			}
+		}
+	}
+
+	m_bCoeffsDirty = false;
+}
+
+void CLinkwitzRileyCrossover::updateGains()
+{
+	for(UINT i = 0; i < LR_XOVER_LANES; i++)
+	{
+		UINT uBand = i/2;
+		bool bActive = uBand < m_uBands && !m_bBandMute[uBand];
+		m_fTargetGain[i] = bActive ? pow(10.0, m_fBandGain_dB[uBand]/20.0) : 0.0;
+	}
+
+	m_bGainsDirty = false;
+}
+
+void CLinkwitzRileyCrossover::flushDenormals()
+{
+	for(UINT s = 0; s < m_uSections; s++)
+	{
+		for(UINT i = 0; i < LR_XOVER_LANES; i++)
+		{
+			if(fabs(m_fZ1[s][i]) < FLT_MIN_PLUS) m_fZ1[s][i] = 0;
+			if(fabs(m_fZ2[s][i]) < FLT_MIN_PLUS) m_fZ2[s][i] = 0;
+		}
+	}
+}
+
+void CLinkwitzRileyCrossover::processFrame(const float* pInput, float* pOutput, UINT uChannels)
+{
+	// --- deferred coefficient/gain updates
+	if(m_bCoeffsDirty)
+		updateCoefficients();
+	if(m_bGainsDirty)
+		updateGains();
+
+	float fL = pInput[0];
+	float fR = uChannels == 2 ? pInput[1] : 0.0;
+
+#if RAFX_OBJECTS_SSE
+	// --- lanes are band*2 + channel: [b0L b0R b1L b1R] [b2L b2R b3L b3R]
+	__m128 x = _mm_setr_ps(fL, fR, fL, fR);
+	__m128 y[2] = {x, x};
+
+	// --- TDF-II: y = a0*x + z1, z1 = a1*x - b1*y + z2, z2 = a2*x - b2*y
+	for(UINT s = 0; s < m_uSections; s++)
+	{
+		for(UINT v = 0; v < m_uVectors; v++)
+		{
+			UINT i = 4*v;
+			__m128 in = y[v];
+			__m128 z1 = _mm_loadu_ps(&m_fZ1[s][i]);
+			__m128 z2 = _mm_loadu_ps(&m_fZ2[s][i]);
+
+			__m128 out = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&m_fA0[s][i]), in), z1);
+			z1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(&m_fA1[s][i]), in), _mm_mul_ps(_mm_loadu_ps(&m_fB1[s][i]), out)), z2);
+			z2 = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(&m_fA2[s][i]), in), _mm_mul_ps(_mm_loadu_ps(&m_fB2[s][i]), out));
+
+			_mm_storeu_ps(&m_fZ1[s][i], z1);
+			_mm_storeu_ps(&m_fZ2[s][i], z2);
+			y[v] = out;
+		}
+	}
+
+	// --- smoothed band gains, then sum the bands per channel
+	__m128 fSmoothing = _mm_set1_ps(m_fGainSmoothing);
+	__m128 acc = _mm_setzero_ps();
+	for(UINT v = 0; v < m_uVectors; v++)
+	{
+		__m128 g = _mm_loadu_ps(&m_fGain[4*v]);
+		g = _mm_add_ps(g, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&m_fTargetGain[4*v]), g), fSmoothing));
+		_mm_storeu_ps(&m_fGain[4*v], g);
+		acc = _mm_add_ps(acc, _mm_mul_ps(y[v], g));
+	}
+	acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+
+	float fSum[4];
+	_mm_storeu_ps(&fSum[0], acc);
+#else
+	float y[LR_XOVER_LANES];
+	UINT uLanes = 4*m_uVectors;
+	for(UINT i = 0; i < uLanes; i++)
+		y[i] = (i & 1) ? fR : fL;
+
+	for(UINT s = 0; s < m_uSections; s++)
+	{
+		for(UINT i = 0; i < uLanes; i++)
+		{
+			float in = y[i];
+			float out = m_fA0[s][i]*in + m_fZ1[s][i];
+			m_fZ1[s][i] = m_fA1[s][i]*in - m_fB1[s][i]*out + m_fZ2[s][i];
+			m_fZ2[s][i] = m_fA2[s][i]*in - m_fB2[s][i]*out;
+			y[i] = out;
+		}
+	}
+
+	float fSum[2] = {0.0, 0.0};
+	for(UINT i = 0; i < uLanes; i++)
+	{
+		m_fGain[i] += (m_fTargetGain[i] - m_fGain[i])*m_fGainSmoothing;
+		fSum[i & 1] += y[i]*m_fGain[i];
+	}
+#endif
+
+	pOutput[0] = fSum[0];
+	if(uChannels == 2)
+		pOutput[1] = fSum[1];
+
+	if(++m_uFrameCount >= 256)
+	{
+		m_uFrameCount = 0;
+		flushDenormals();
+	}
+}
+
+void CLinkwitzRileyCrossover::processBlock(float** ppInput, float** ppOutput, UINT uChannels, UINT uFrames)
+{
+	// --- once per block
+	if(m_bCoeffsDirty)
+		updateCoefficients();
+	if(m_bGainsDirty)
+		updateGains();
+
+	float fInput[2];
+	float fOutput[2];
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		fInput[0] = ppInput[0][n];
+		fInput[1] = uChannels == 2 ? ppInput[1][n] : 0.0;
+
+		processFrame(&fInput[0], &fOutput[0], uChannels);
+
+		ppOutput[0][n] = fOutput[0];
+		if(uChannels == 2)
+			ppOutput[1][n] = fOutput[1];
+	}
+}
+
+// CTruePeakLimiter Implementation ----------------------------------------------------------------
+//
+// --- the interpolator is the same for every instance, so it is designed once
+struct truePeakKernel
+{
+	float fCoeffs[TRUE_PEAK_TAPS][2*TRUE_PEAK_PHASES];
+
+	truePeakKernel()
+	{
+		// --- 48 tap windowed sinc, 4x, centred on tap 24 so that phase 0 is the
+		//     input sample itself (delayed 6) and phases 1-3 fall 1/4, 1/2 and 3/4
+		//     of the way to the next one; Kaiser window, beta 5
+		const double dBeta = 5.0;
+		const UINT uLength = TRUE_PEAK_PHASES*TRUE_PEAK_TAPS;
+		const double dCentre = 0.5*uLength;
+
+		double dI0Beta = 0.0;
+		double dTerm = 1.0;
+		for(UINT k = 1; k < 30; k++)
+		{
+			dI0Beta += dTerm;
+			dTerm *= (0.25*dBeta*dBeta)/(k*k);
+		}
+
+		for(UINT i = 0; i < uLength; i++)
+		{
+			double t = (i - dCentre)/TRUE_PEAK_PHASES;
+			double dSinc = t == 0.0 ? 1.0 : sin(pi*t)/(pi*t);
+
+			double r = (i - dCentre)/dCentre;
+			double dArg = dBeta*sqrt(1.0 - r*r);
+			double dI0 = 0.0;
+			dTerm = 1.0;
+			for(UINT k = 1; k < 30; k++)
+			{
+				dI0 += dTerm;
+				dTerm *= (0.25*dArg*dArg)/(k*k);
+			}
+
+			// --- tap j of phase p is i = 4j + p: x(n - j) weighted for the point
+			//     n - 6 + p/4
+			UINT j = i/TRUE_PEAK_PHASES;
+			UINT p = i%TRUE_PEAK_PHASES;
+
+			float fCoeff = dSinc*dI0/dI0Beta;
+			fCoeffs[j][p] = fCoeff;
+			fCoeffs[j][p + TRUE_PEAK_PHASES] = fCoeff;
+		}
+	}
+};
+
+CTruePeakLimiter::CTruePeakLimiter(void)
+{
+	static const truePeakKernel kernel;
+	memcpy(m_fPhaseCoeffs, kernel.fCoeffs, sizeof(m_fPhaseCoeffs));
+
+	m_fCeiling = pow(10.0, -1.0/20.0);
+	m_fRelease_ms = 50.0;
+	m_fReleaseCoeff = 0.0;
+	m_fSampleRate = 44100;
+	m_uLookahead = (UINT)(0.0015*m_fSampleRate + 0.5);
+	m_dInvLookahead = 1.0/m_uLookahead;
+	setReleaseTime(m_fRelease_ms);
+
+	// --- the 20 KB of lines are cleared by init(), which runs before any audio
+	m_fGain = 1.0;
+}
+
+CTruePeakLimiter::~CTruePeakLimiter(void)
+{
+}
+
+void CTruePeakLimiter::init(float fSampleRate)
+{
+	m_fSampleRate = fSampleRate;
+
+	m_uLookahead = (UINT)(0.0015*fSampleRate + 0.5);
+	if(m_uLookahead < 1) m_uLookahead = 1;
+	if(m_uLookahead > TRUE_PEAK_MAX_LOOKAHEAD) m_uLookahead = TRUE_PEAK_MAX_LOOKAHEAD;
+	m_dInvLookahead = 1.0/m_uLookahead;
+
+	setReleaseTime(m_fRelease_ms);
+	reset();
+}
+
+void CTruePeakLimiter::setCeiling(float fCeiling_dB)
+{
+	m_fCeiling = pow(10.0, fCeiling_dB/20.0);
+}
+
+void CTruePeakLimiter::setReleaseTime(float fRelease_ms)
+{
+	m_fRelease_ms = fRelease_ms;
+	m_fReleaseCoeff = 1.0 - exp(-1000.0/(fRelease_ms*m_fSampleRate));
+}
+
+float CTruePeakLimiter::getGainReduction_dB()
+{
+	return 20.0*log10(m_fGain);
+}
+
+void CTruePeakLimiter::reset()
+{
+	memset(m_fHistory, 0, sizeof(m_fHistory));
+	memset(m_fDelay, 0, sizeof(m_fDelay));
+	m_uHistoryIndex = 0;
+	m_uDelayIndex = 0;
+
+	m_uMinFront = 0;
+	m_uMinCount = 0;
+	m_uTime = 0;
+
+	for(UINT i = 0; i < m_uLookahead; i++)
+		m_fAverage[i] = 1.0;
+	m_dAverageSum = m_uLookahead;
+	m_uAverageIndex = 0;
+
+	m_fReleaseGain = 1.0;
+	m_fGain = 1.0;
+}
+
+// --- push one frame into the interpolator; returns the largest |value| over
+//     the 4 phases of both channels
+float CTruePeakLimiter::detectPeak(float fLeft, float fRight)
+{
+	// --- newest first: taps read m_fHistory[index .. index + TAPS - 1]
+	m_uHistoryIndex = m_uHistoryIndex == 0 ? TRUE_PEAK_TAPS - 1 : m_uHistoryIndex - 1;
+	float* pNew = &m_fHistory[m_uHistoryIndex][0];
+	float* pCopy = &m_fHistory[m_uHistoryIndex + TRUE_PEAK_TAPS][0];
+	const float* pHistory = pNew;
+
+#if RAFX_OBJECTS_AVX
+	__m256 x = _mm256_setr_ps(fLeft, fLeft, fLeft, fLeft, fRight, fRight, fRight, fRight);
+	_mm256_storeu_ps(pNew, x);
+	_mm256_storeu_ps(pCopy, x);
+
+	// --- 3 partial sums to keep the adds off one dependency chain
+	__m256 acc[3] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+	for(UINT j = 0; j < TRUE_PEAK_TAPS; j += 3)
+	{
+		for(UINT k = 0; k < 3; k++)
+			acc[k] = _mm256_add_ps(acc[k], _mm256_mul_ps(_mm256_loadu_ps(&m_fPhaseCoeffs[j + k][0]), _mm256_loadu_ps(pHistory + 8*(j + k))));
+	}
+	acc[0] = _mm256_add_ps(_mm256_add_ps(acc[0], acc[1]), acc[2]);
+
+	// --- |x| by clearing the sign bits, then the max across the lanes
+	__m256 a = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), acc[0]);
+	__m128 m = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+#elif RAFX_OBJECTS_SSE
+	__m128 xL = _mm_set1_ps(fLeft);
+	__m128 xR = _mm_set1_ps(fRight);
+	_mm_storeu_ps(pNew, xL);
+	_mm_storeu_ps(pNew + 4, xR);
+	_mm_storeu_ps(pCopy, xL);
+	_mm_storeu_ps(pCopy + 4, xR);
+
+	// --- 2 partial sums per channel to keep the adds off one dependency chain
+	__m128 accL[2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+	__m128 accR[2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+	for(UINT j = 0; j < TRUE_PEAK_TAPS; j += 2)
+	{
+		for(UINT k = 0; k < 2; k++)
+		{
+			__m128 c = _mm_loadu_ps(&m_fPhaseCoeffs[j + k][0]);
+			accL[k] = _mm_add_ps(accL[k], _mm_mul_ps(c, _mm_loadu_ps(pHistory + 8*(j + k))));
+			accR[k] = _mm_add_ps(accR[k], _mm_mul_ps(c, _mm_loadu_ps(pHistory + 8*(j + k) + 4)));
+		}
+	}
+
+	__m128 signMask = _mm_set1_ps(-0.0f);
+	__m128 m = _mm_max_ps(_mm_andnot_ps(signMask, _mm_add_ps(accL[0], accL[1])), _mm_andnot_ps(signMask, _mm_add_ps(accR[0], accR[1])));
+#else
+	for(UINT i = 0; i < TRUE_PEAK_PHASES; i++)
+	{
+		pNew[i] = pCopy[i] = fLeft;
+		pNew[i + TRUE_PEAK_PHASES] = pCopy[i + TRUE_PEAK_PHASES] = fRight;
+	}
+
+	float fPeak = 0.0;
+	for(UINT i = 0; i < 2*TRUE_PEAK_PHASES; i++)
+	{
+		float fAcc = 0.0;
+		for(UINT j = 0; j < TRUE_PEAK_TAPS; j++)
+			fAcc += m_fPhaseCoeffs[j][i]*pHistory[8*j + i];
+		fAcc = fabs(fAcc);
+		fPeak = fAcc > fPeak ? fAcc : fPeak;
+	}
+	return fPeak;
+#endif
+
+#if RAFX_OBJECTS_SSE
+	m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+	m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+	return _mm_cvtss_f32(m);
+#endif
+}
+
+// --- required gain -> sliding min over lookahead + 1 detections -> release
+//     -> moving average over the lookahead; the result applies to the sample
+//     leaving the delay line now
+float CTruePeakLimiter::computeGain(float fPeak)
+{
+	const UINT uMask = TRUE_PEAK_QUEUE_SIZE - 1;
+	float fRequired = fPeak > m_fCeiling ? m_fCeiling/fPeak : 1.0;
+
+	// --- drop the queued gains that are no smaller than the new one, then the
+	//     one that has slid out of the window
+	while(m_uMinCount > 0 && m_fMinGain[(m_uMinFront + m_uMinCount - 1)&uMask] >= fRequired)
+		m_uMinCount--;
+
+	UINT uBack = (m_uMinFront + m_uMinCount)&uMask;
+	m_fMinGain[uBack] = fRequired;
+	m_uMinTime[uBack] = m_uTime;
+	m_uMinCount++;
+
+	if(m_uTime - m_uMinTime[m_uMinFront] > m_uLookahead)
+	{
+		m_uMinFront = (m_uMinFront + 1)&uMask;
+		m_uMinCount--;
+	}
+	m_uTime++;
+
+	float fMin = m_fMinGain[m_uMinFront];
+
+	// --- attack is instant here, the average does the smoothing
+	if(fMin < m_fReleaseGain)
+		m_fReleaseGain = fMin;
+	else
+		m_fReleaseGain += (fMin - m_fReleaseGain)*m_fReleaseCoeff;
+
+	m_dAverageSum += m_fReleaseGain - m_fAverage[m_uAverageIndex];
+	m_fAverage[m_uAverageIndex] = m_fReleaseGain;
+	if(++m_uAverageIndex >= m_uLookahead)
+		m_uAverageIndex = 0;
+
+	m_fGain = m_dAverageSum*m_dInvLookahead;
+	return m_fGain;
+}
+
+void CTruePeakLimiter::processFrame(const float* pInput, float* pOutput, UINT uChannels)
+{
+	float fLeft = pInput[0];
+	float fRight = uChannels == 2 ? pInput[1] : fLeft;
+
+	float fGain = computeGain(detectPeak(fLeft, fRight));
+
+	UINT uRead = (m_uDelayIndex - getLatencyInSamples())&(TRUE_PEAK_DELAY_SIZE - 1);
+	m_fDelay[0][m_uDelayIndex] = fLeft;
+	m_fDelay[1][m_uDelayIndex] = fRight;
+	m_uDelayIndex = (m_uDelayIndex + 1)&(TRUE_PEAK_DELAY_SIZE - 1);
+
+	pOutput[0] = m_fDelay[0][uRead]*fGain;
+	if(uChannels == 2)
+		pOutput[1] = m_fDelay[1][uRead]*fGain;
+}
+
+void CTruePeakLimiter::processBlock(float** ppInput, float** ppOutput, UINT uChannels, UINT uFrames)
+{
+	float fGain[TRUE_PEAK_BLOCK];
+	float fDelayed[2][TRUE_PEAK_BLOCK];
+	UINT uLatency = getLatencyInSamples();
+
+	for(UINT uStart = 0; uStart < uFrames; uStart += TRUE_PEAK_BLOCK)
+	{
+		UINT uCount = uFrames - uStart < TRUE_PEAK_BLOCK ? uFrames - uStart : TRUE_PEAK_BLOCK;
+
+		// --- detection and gain per frame; the delay line swaps input for output
+		for(UINT n = 0; n < uCount; n++)
+		{
+			float fLeft = ppInput[0][uStart + n];
+			float fRight = uChannels == 2 ? ppInput[1][uStart + n] : fLeft;
+
+			fGain[n] = computeGain(detectPeak(fLeft, fRight));
+
+			UINT uRead = (m_uDelayIndex - uLatency)&(TRUE_PEAK_DELAY_SIZE - 1);
+			fDelayed[0][n] = m_fDelay[0][uRead];
+			fDelayed[1][n] = m_fDelay[1][uRead];
+			m_fDelay[0][m_uDelayIndex] = fLeft;
+			m_fDelay[1][m_uDelayIndex] = fRight;
+			m_uDelayIndex = (m_uDelayIndex + 1)&(TRUE_PEAK_DELAY_SIZE - 1);
+		}
+
+		// --- apply the gain
+		for(UINT c = 0; c < uChannels; c++)
+		{
+			float* pOut = &ppOutput[c][uStart];
+			UINT n = 0;
+#if RAFX_OBJECTS_SSE
+			for(; n + 4 <= uCount; n += 4)
+				_mm_storeu_ps(pOut + n, _mm_mul_ps(_mm_loadu_ps(&fDelayed[c][n]), _mm_loadu_ps(&fGain[n])));
+#endif
+			for(; n < uCount; n++)
+				pOut[n] = fDelayed[c][n]*fGain[n];
+		}
+	}
+}
+
+
+// CLoudnessMeter Implementation ----------------------------------------------------------------
+//
+CLoudnessMeter::CLoudnessMeter(void)
+{
+	m_fSampleRate = 48000;
+	m_uChannels = 2;
+	init(m_fSampleRate);
+}
+
+CLoudnessMeter::~CLoudnessMeter(void)
+{
+}
+
+void CLoudnessMeter::init(float fSampleRate)
+{
+	m_fSampleRate = fSampleRate;
+	m_uSubBlockLength = (UINT)(0.1*fSampleRate + 0.5);
+	if(m_uSubBlockLength < 1) m_uSubBlockLength = 1;
+
+	calculateKWeighting();
+	reset();
+}
+
+// --- BS.1770 pre-filter and RLB high-pass from their analog prototypes, so
+//     any sample rate gets the same curve (at 48 kHz these are the published
+//     coefficients)
+void CLoudnessMeter::calculateKWeighting()
+{
+	// --- stage 0: high shelf, +4 dB above ~1.7 kHz
+	double K = tan(pi*1681.974450955533/m_fSampleRate);
+	double Q = 0.7071752369554196;
+	double Vh = pow(10.0, 3.999843853973347/20.0);
+	double Vb = pow(Vh, 0.4996667741545416);
+	double a0 = 1.0 + K/Q + K*K;
+
+	m_dB0[0] = (Vh + Vb*K/Q + K*K)/a0;
+	m_dB1[0] = 2.0*(K*K - Vh)/a0;
+	m_dB2[0] = (Vh - Vb*K/Q + K*K)/a0;
+	m_dA1[0] = 2.0*(K*K - 1.0)/a0;
+	m_dA2[0] = (1.0 - K/Q + K*K)/a0;
+
+	// --- stage 1: RLB high-pass at ~38 Hz
+	K = tan(pi*38.13547087602444/m_fSampleRate);
+	Q = 0.5003270373238773;
+	a0 = 1.0 + K/Q + K*K;
+
+	m_dB0[1] = 1.0;
+	m_dB1[1] = -2.0;
+	m_dB2[1] = 1.0;
+	m_dA1[1] = 2.0*(K*K - 1.0)/a0;
+	m_dA2[1] = (1.0 - K/Q + K*K)/a0;
+}
+
+void CLoudnessMeter::reset()
+{
+	memset(m_dZ1, 0, sizeof(m_dZ1));
+	memset(m_dZ2, 0, sizeof(m_dZ2));
+	m_uChunkCount = 0;
+
+	m_dSubBlockSum = 0.0;
+	m_uSubBlockCount = 0;
+	memset(m_dSubBlocks, 0, sizeof(m_dSubBlocks));
+	m_uSubBlockIndex = 0;
+	m_uSubBlocksDone = 0;
+
+	memset(m_uBinCount, 0, sizeof(m_uBinCount));
+	memset(m_dBinEnergy, 0, sizeof(m_dBinEnergy));
+	m_dGatedEnergy = 0.0;
+	m_uGatedBlocks = 0;
+
+	m_fMomentary_LUFS = LOUDNESS_SILENCE;
+	m_fShortTerm_LUFS = LOUDNESS_SILENCE;
+	m_fIntegrated_LUFS = LOUDNESS_SILENCE;
+}
+
+float CLoudnessMeter::toLUFS(double dMeanSquare)
+{
+	if(dMeanSquare <= 0.0)
+		return LOUDNESS_SILENCE;
+
+	double dLUFS = -0.691 + 10.0*log10(dMeanSquare);
+	return dLUFS > LOUDNESS_SILENCE ? dLUFS : LOUDNESS_SILENCE;
+}
+
+bool CLoudnessMeter::processFrame(const float* pInput, UINT uChannels)
+{
+	m_uChannels = uChannels == 2 ? 2 : 1;
+	m_fChunk[0][m_uChunkCount] = pInput[0];
+	if(m_uChannels == 2)
+		m_fChunk[1][m_uChunkCount] = pInput[1];
+
+	if(++m_uChunkCount < LOUDNESS_CHUNK)
+		return false;
+
+	return processChunk(LOUDNESS_CHUNK);
+}
+
+bool CLoudnessMeter::processBlock(float** ppInput, UINT uChannels, UINT uFrames)
+{
+	m_uChannels = uChannels == 2 ? 2 : 1;
+	bool bUpdated = false;
+
+	UINT n = 0;
+	while(n < uFrames)
+	{
+		UINT uCount = LOUDNESS_CHUNK - m_uChunkCount;
+		if(uCount > uFrames - n)
+			uCount = uFrames - n;
+
+		for(UINT c = 0; c < m_uChannels; c++)
+			memcpy(&m_fChunk[c][m_uChunkCount], &ppInput[c][n], uCount*sizeof(float));
+
+		m_uChunkCount += uCount;
+		n += uCount;
+
+		if(m_uChunkCount == LOUDNESS_CHUNK)
+			bUpdated = processChunk(LOUDNESS_CHUNK) || bUpdated;
+	}
+
+	return bUpdated;
+}
+
+// --- sum of x^2, 4 lanes at a time; chunks are short enough for float partial sums
+static double sumOfSquares(const float* pInput, UINT uCount)
+{
+	UINT n = 0;
+	double dSum = 0.0;
+#if RAFX_OBJECTS_SSE
+	__m128 acc = _mm_setzero_ps();
+	for(; n + 4 <= uCount; n += 4)
+	{
+		__m128 x = _mm_loadu_ps(pInput + n);
+		acc = _mm_add_ps(acc, _mm_mul_ps(x, x));
+	}
+	float fSum[4];
+	_mm_storeu_ps(&fSum[0], acc);
+	dSum = (double)fSum[0] + fSum[1] + fSum[2] + fSum[3];
+#endif
+	for(; n < uCount; n++)
+		dSum += pInput[n]*pInput[n];
+
+	return dSum;
+}
+
+bool CLoudnessMeter::processChunk(UINT uFrames)
+{
+	// --- K-weighting: both biquads per sample, per channel, into the weighted
+	//     chunk, which is then squared and summed per sub-block segment
+	float fWeighted[2][LOUDNESS_CHUNK];
+	for(UINT c = 0; c < m_uChannels; c++)
+	{
+		double z10 = m_dZ1[c][0], z20 = m_dZ2[c][0];
+		double z11 = m_dZ1[c][1], z21 = m_dZ2[c][1];
+		const float* pIn = &m_fChunk[c][0];
+		float* pOut = &fWeighted[c][0];
+
+		for(UINT n = 0; n < uFrames; n++)
+		{
+			double x = pIn[n];
+			double y = m_dB0[0]*x + z10;
+			z10 = m_dB1[0]*x - m_dA1[0]*y + z20;
+			z20 = m_dB2[0]*x - m_dA2[0]*y;
+
+			double w = y + z11;
+			z11 = -2.0*y - m_dA1[1]*w + z21;
+			z21 = y - m_dA2[1]*w;
+
+			pOut[n] = w;
+		}
+
+		// --- keep the states out of the denormal range in silence
+		m_dZ1[c][0] = fabs(z10) < 1.0e-30 ? 0.0 : z10;
+		m_dZ2[c][0] = fabs(z20) < 1.0e-30 ? 0.0 : z20;
+		m_dZ1[c][1] = fabs(z11) < 1.0e-30 ? 0.0 : z11;
+		m_dZ2[c][1] = fabs(z21) < 1.0e-30 ? 0.0 : z21;
+	}
+	m_uChunkCount = 0;
+
+	bool bUpdated = false;
+	UINT n = 0;
+	while(n < uFrames)
+	{
+		UINT uCount = m_uSubBlockLength - m_uSubBlockCount;
+		if(uCount > uFrames - n)
+			uCount = uFrames - n;
+
+		for(UINT c = 0; c < m_uChannels; c++)
+			m_dSubBlockSum += sumOfSquares(&fWeighted[c][n], uCount);
+
+		m_uSubBlockCount += uCount;
+		n += uCount;
+
+		if(m_uSubBlockCount == m_uSubBlockLength)
+		{
+			endSubBlock();
+			bUpdated = true;
+		}
+	}
+
+	return bUpdated;
+}
+
+void CLoudnessMeter::endSubBlock()
+{
+	m_dSubBlocks[m_uSubBlockIndex] = m_dSubBlockSum/m_uSubBlockLength;
+	m_dSubBlockSum = 0.0;
+	m_uSubBlockCount = 0;
+	m_uSubBlocksDone++;
+
+	// --- momentary and short-term: means over the most recent sub-blocks
+	double dMomentary = 0.0;
+	double dShortTerm = 0.0;
+	for(UINT i = 0; i < LOUDNESS_SHORT_TERM_BLOCKS; i++)
+	{
+		UINT uIndex = (m_uSubBlockIndex + LOUDNESS_SHORT_TERM_BLOCKS - i)%LOUDNESS_SHORT_TERM_BLOCKS;
+		if(i < LOUDNESS_MOMENTARY_BLOCKS)
+			dMomentary += m_dSubBlocks[uIndex];
+		dShortTerm += m_dSubBlocks[uIndex];
+	}
+	dMomentary /= LOUDNESS_MOMENTARY_BLOCKS;
+	dShortTerm /= LOUDNESS_SHORT_TERM_BLOCKS;
+
+	m_uSubBlockIndex = (m_uSubBlockIndex + 1)%LOUDNESS_SHORT_TERM_BLOCKS;
+
+	m_fMomentary_LUFS = toLUFS(dMomentary);
+	m_fShortTerm_LUFS = m_uSubBlocksDone >= LOUDNESS_SHORT_TERM_BLOCKS ? toLUFS(dShortTerm) : LOUDNESS_SILENCE;
+
+	// --- every full momentary block is a gating block
+	if(m_uSubBlocksDone < LOUDNESS_MOMENTARY_BLOCKS || m_fMomentary_LUFS < LOUDNESS_HISTOGRAM_MIN)
+		return;
+
+	int nBin = (int)((m_fMomentary_LUFS - LOUDNESS_HISTOGRAM_MIN)/LOUDNESS_HISTOGRAM_STEP);
+	if(nBin >= (int)LOUDNESS_HISTOGRAM_BINS)
+		nBin = LOUDNESS_HISTOGRAM_BINS - 1;
+
+	m_uBinCount[nBin]++;
+	m_dBinEnergy[nBin] += dMomentary;
+	m_dGatedEnergy += dMomentary;
+	m_uGatedBlocks++;
+
+	// --- relative gate from the running totals, then the bins whose centre
+	//     is at or over it
+	float fRelativeGate = toLUFS(m_dGatedEnergy/m_uGatedBlocks) - 10.0;
+	int nFirst = (int)ceil((fRelativeGate - LOUDNESS_HISTOGRAM_MIN)/LOUDNESS_HISTOGRAM_STEP - 0.5);
+	if(nFirst < 0)
+		nFirst = 0;
+
+	double dEnergy = 0.0;
+	UINT uBlocks = 0;
+	for(UINT i = nFirst; i < LOUDNESS_HISTOGRAM_BINS; i++)
+	{
+		dEnergy += m_dBinEnergy[i];
+		uBlocks += m_uBinCount[i];
+	}
+
+	m_fIntegrated_LUFS = uBlocks > 0 ? toLUFS(dEnergy/uBlocks) : LOUDNESS_SILENCE;
+}
+
+
+// CMeterEngine Implementation ----------------------------------------------------------------
+//
+static const float METER_VU_SINE_SCALE = 1.11072073;		// pi/(2 sqrt 2): rectified average -> RMS of a sine
+static const float METER_FLOOR_AMPLITUDE = 1e-6;			// METER_FLOOR_DB
+static const float METER_FLUSH = 1e-20;						// below this a release is over
+
+// --- log2 of a positive normal float: the exponent, plus the log of the mantissa
+//     taken into [sqrt(1/2), sqrt(2)) so that t = (m - 1)/(m + 1) stays under
+//     0.172 and the atanh series 2 (t + t^3/3 + t^5/5 + t^7/7)/ln 2 is good to
+//     about 1e-8
+static const float LOG2_SERIES_SCALE = 2.88539008;			// 2/ln 2
+
+#if RAFX_OBJECTS_SSE2
+static inline __m128 fastLog2(__m128 x)
+{
+	__m128i bits = _mm_castps_si128(x);
+	__m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+	__m128 mantissa = _mm_or_ps(_mm_castsi128_ps(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF))), _mm_set1_ps(1.0f));
+
+	__m128 high = _mm_cmpgt_ps(mantissa, _mm_set1_ps(1.41421356f));
+	mantissa = _mm_sub_ps(mantissa, _mm_and_ps(high, _mm_mul_ps(mantissa, _mm_set1_ps(0.5f))));
+	exponent = _mm_add_ps(exponent, _mm_and_ps(high, _mm_set1_ps(1.0f)));
+
+	__m128 t = _mm_div_ps(_mm_sub_ps(mantissa, _mm_set1_ps(1.0f)), _mm_add_ps(mantissa, _mm_set1_ps(1.0f)));
+	__m128 t2 = _mm_mul_ps(t, t);
+	__m128 series = _mm_add_ps(_mm_set1_ps(1.0f/5.0f), _mm_mul_ps(t2, _mm_set1_ps(1.0f/7.0f)));
+	series = _mm_add_ps(_mm_set1_ps(1.0f/3.0f), _mm_mul_ps(t2, series));
+	series = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(t2, series));
+
+	return _mm_add_ps(exponent, _mm_mul_ps(_mm_mul_ps(t, series), _mm_set1_ps(LOG2_SERIES_SCALE)));
+}
+#endif
+
+static inline float fastLog2(float x)
+{
+	UINT uBits;
+	memcpy(&uBits, &x, sizeof(float));
+	float fExponent = (float)((int)(uBits >> 23) - 127);
+
+	UINT uMantissa = (uBits & 0x007FFFFF) | 0x3F800000;
+	float fMantissa;
+	memcpy(&fMantissa, &uMantissa, sizeof(float));
+
+	if(fMantissa > 1.41421356f)
+	{
+		fMantissa *= 0.5f;
+		fExponent += 1.0f;
+	}
+
+	float t = (fMantissa - 1.0f)/(fMantissa + 1.0f);
+	float t2 = t*t;
+	return fExponent + LOG2_SERIES_SCALE*t*(1.0f + t2*(1.0f/3.0f + t2*(1.0f/5.0f + t2*(1.0f/7.0f))));
+}
+
+// --- 20 log10(x) = 20 log10(2) log2(x)
+static const float DB_PER_OCTAVE_AMPLITUDE = 6.02059991;
+static const float DB_PER_OCTAVE_POWER = 3.01029996;
+
+float CMeterEngine::fastAmplitudeTodB(float fAmplitude)
+{
+	return fAmplitude > METER_FLOOR_AMPLITUDE ? DB_PER_OCTAVE_AMPLITUDE*fastLog2(fAmplitude) : METER_FLOOR_DB;
+}
+
+float CMeterEngine::fastPowerTodB(float fPower)
+{
+	const float fFloor = METER_FLOOR_AMPLITUDE*METER_FLOOR_AMPLITUDE;
+	return fPower > fFloor ? DB_PER_OCTAVE_POWER*fastLog2(fPower) : METER_FLOOR_DB;
+}
+
+// --- a row of amplitudes or powers to dB, floored
+static void rowTodB(const float* pIn, float* pOut, UINT uCount, float fdBPerOctave, float fFloor)
+{
+	UINT i = 0;
+#if RAFX_OBJECTS_SSE2
+	__m128 floor = _mm_set1_ps(fFloor);
+	__m128 scale = _mm_set1_ps(fdBPerOctave);
+	for(; i < uCount; i += 4)
+		_mm_storeu_ps(&pOut[i], _mm_mul_ps(scale, fastLog2(_mm_max_ps(_mm_loadu_ps(&pIn[i]), floor))));
+#endif
+	for(; i < uCount; i++)
+		pOut[i] = fdBPerOctave*fastLog2(fmax(pIn[i], fFloor));
+}
+
+CMeterEngine::CMeterEngine(void)
+{
+	m_uChannels = 0;
+	m_uStride = 0;
+	m_ppSources = NULL;
+	m_pInput = NULL;
+	m_pDisplay = NULL;
+	m_fSampleRate = 44100;
+
+	allocate(0);
+	setSampleRate(44100);
+}
+
+CMeterEngine::~CMeterEngine(void)
+{
+	delete [] m_ppSources;
+	delete [] m_pInput;
+	delete [] m_pDisplay;
+}
+
+// --- one allocation for the per channel state; every array is m_uStride long
+//     so the kernel never needs a tail loop
+void CMeterEngine::allocate(UINT uChannels)
+{
+	delete [] m_ppSources;
+	delete [] m_pInput;
+	delete [] m_pDisplay;
+
+	m_uChannels = uChannels;
+	m_uStride = (uChannels + 3) & ~3;
+	UINT uStride = m_uStride > 0 ? m_uStride : 4;
+
+	m_ppSources = new float*[uStride];
+	memset(m_ppSources, 0, uStride*sizeof(float*));
+
+	const UINT uArrays = 14;
+	m_pInput = new float[uArrays*uStride];
+	memset(m_pInput, 0, uArrays*uStride*sizeof(float));
+	m_pPeak = m_pInput + uStride;
+	m_pEnvelope = m_pPeak + uStride;
+	m_pEnvelopeMax = m_pEnvelope + uStride;
+	m_pVU = m_pEnvelopeMax + uStride;
+	m_pPPM = m_pVU + uStride;
+	m_pMeanSquare = m_pPPM + uStride;
+	m_pAttackCoeff = m_pMeanSquare + uStride;
+	m_pReleaseCoeff = m_pAttackCoeff + uStride;
+	m_pDetectSquare = m_pReleaseCoeff + uStride;
+	m_pDetectRoot = m_pDetectSquare + uStride;
+	m_pPeakHold_dB = m_pDetectRoot + uStride;
+	m_pHoldFrames = m_pPeakHold_dB + uStride;
+	// --- the 14th is scratch for endBlock()
+
+	m_pDisplay = new float[(METER_READINGS + 1)*uStride];
+	for(UINT i = 0; i < METER_READINGS*uStride; i++)
+		m_pDisplay[i] = METER_FLOOR_DB;
+	memset(&m_pDisplay[METER_READINGS*uStride], 0, uStride*sizeof(float));
+	m_bDisplayFrames = false;
+}
+
+void CMeterEngine::setChannels(UINT uChannels, float** ppSources)
+{
+	allocate(uChannels);
+	for(UINT i = 0; i < uChannels; i++)
+	{
+		m_ppSources[i] = ppSources ? ppSources[i] : NULL;
+		setDetector(i, 10.0, 500.0, 0);
+	}
+	reset();
+}
+
+void CMeterEngine::setDetector(UINT uChannel, float fAttack_ms, float fRelease_ms, UINT uDetect)
+{
+	if(uChannel >= m_uChannels)
+		return;
+
+	// --- same coefficients as the RackAFX meter detector with analog TC, but
+	//     at the audio rate instead of the GUI timer rate
+	m_pAttackCoeff[uChannel] = exp(ANALOG_TC/(fmax(fAttack_ms, 0.001)*m_fSampleRate*0.001));
+	m_pReleaseCoeff[uChannel] = exp(ANALOG_TC/(fmax(fRelease_ms, 0.001)*m_fSampleRate*0.001));
+
+	// --- stored as masks so the kernel selects with and/andnot
+	UINT uSquare = uDetect == 0 ? 0 : 0xFFFFFFFF;
+	UINT uRoot = uDetect == 2 ? 0xFFFFFFFF : 0;
+	memcpy(&m_pDetectSquare[uChannel], &uSquare, sizeof(float));
+	memcpy(&m_pDetectRoot[uChannel], &uRoot, sizeof(float));
+}
+
+void CMeterEngine::setSampleRate(float fSampleRate)
+{
+	m_fSampleRate = fSampleRate;
+
+	double dMsec = 0.001*fSampleRate;
+	m_fVUCoeff = exp(DIGITAL_TC/(METER_VU_MSEC*dMsec));
+	m_fPPMAttackCoeff = exp(log(0.2)/(METER_PPM_ATTACK_MSEC*dMsec));
+	m_fPPMReleaseCoeff = pow(10.0, -METER_PPM_FALL_DB/20.0/(METER_PPM_FALL_MSEC*dMsec));
+	m_fRMSCoeff = exp(-1.0/(METER_RMS_MSEC*dMsec));
+	m_fHoldFrames = METER_PEAK_HOLD_MSEC*dMsec;
+	m_fFall_dB_PerFrame = METER_PEAK_FALL_DB_PER_SEC/fSampleRate;
+
+	reset();
+}
+
+void CMeterEngine::reset()
+{
+	for(UINT i = 0; i < m_uStride; i++)
+	{
+		m_pInput[i] = 0.0;
+		m_pPeak[i] = 0.0;
+		m_pEnvelope[i] = 0.0;
+		m_pEnvelopeMax[i] = 0.0;
+		m_pVU[i] = 0.0;
+		m_pPPM[i] = 0.0;
+		m_pMeanSquare[i] = 0.0;
+		m_pPeakHold_dB[i] = METER_FLOOR_DB;
+		m_pHoldFrames[i] = 0.0;
+	}
+	m_uBlockFrames = 0;
+}
+
+void CMeterEngine::processFrame()
+{
+	for(UINT i = 0; i < m_uChannels; i++)
+		m_pInput[i] = m_ppSources[i] ? *m_ppSources[i] : 0.0;
+
+	processKernel(1);
+}
+
+void CMeterEngine::processHeld(UINT uFrames, bool bSilent)
+{
+	if(uFrames == 0)
+		return;
+
+	for(UINT i = 0; i < m_uChannels; i++)
+		m_pInput[i] = bSilent || !m_ppSources[i] ? 0.0 : *m_ppSources[i];
+
+	processKernel(uFrames);
+}
+
+// --- the ballistics of every channel, uFrames times over the same inputs
+void CMeterEngine::processKernel(UINT uFrames)
+{
+	m_uBlockFrames += uFrames;
+
+#if RAFX_OBJECTS_SSE
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 flush = _mm_set1_ps(METER_FLUSH);
+	const __m128 vuCoeff = _mm_set1_ps(m_fVUCoeff);
+	const __m128 ppmAttack = _mm_set1_ps(m_fPPMAttackCoeff);
+	const __m128 ppmRelease = _mm_set1_ps(m_fPPMReleaseCoeff);
+	const __m128 rmsCoeff = _mm_set1_ps(m_fRMSCoeff);
+
+	for(UINT c = 0; c < m_uStride; c += 4)
+	{
+		__m128 x = _mm_loadu_ps(&m_pInput[c]);
+		__m128 a = _mm_andnot_ps(signMask, x);
+		__m128 sq = _mm_mul_ps(x, x);
+		__m128 detectSquare = _mm_loadu_ps(&m_pDetectSquare[c]);
+		__m128 detect = _mm_or_ps(_mm_and_ps(detectSquare, sq), _mm_andnot_ps(detectSquare, a));
+		__m128 attack = _mm_loadu_ps(&m_pAttackCoeff[c]);
+		__m128 release = _mm_loadu_ps(&m_pReleaseCoeff[c]);
+
+		__m128 envelope = _mm_loadu_ps(&m_pEnvelope[c]);
+		__m128 envelopeMax = _mm_loadu_ps(&m_pEnvelopeMax[c]);
+		__m128 vu = _mm_loadu_ps(&m_pVU[c]);
+		__m128 ppm = _mm_loadu_ps(&m_pPPM[c]);
+		__m128 ms = _mm_loadu_ps(&m_pMeanSquare[c]);
+
+		for(UINT n = 0; n < uFrames; n++)
+		{
+			// --- y = c(y - x) + x, c from the attack or release side
+			__m128 rising = _mm_cmpgt_ps(detect, envelope);
+			__m128 coeff = _mm_or_ps(_mm_and_ps(rising, attack), _mm_andnot_ps(rising, release));
+			envelope = _mm_add_ps(_mm_mul_ps(coeff, _mm_sub_ps(envelope, detect)), detect);
+			envelope = _mm_min_ps(envelope, one);
+			envelope = _mm_and_ps(envelope, _mm_cmpge_ps(envelope, flush));
+			envelopeMax = _mm_max_ps(envelopeMax, envelope);
+
+			vu = _mm_add_ps(_mm_mul_ps(vuCoeff, _mm_sub_ps(vu, a)), a);
+			vu = _mm_and_ps(vu, _mm_cmpge_ps(vu, flush));
+
+			rising = _mm_cmpgt_ps(a, ppm);
+			coeff = _mm_or_ps(_mm_and_ps(rising, ppmAttack), _mm_andnot_ps(rising, ppmRelease));
+			ppm = _mm_add_ps(_mm_mul_ps(coeff, _mm_sub_ps(ppm, a)), a);
+			ppm = _mm_and_ps(ppm, _mm_cmpge_ps(ppm, flush));
+
+			ms = _mm_add_ps(_mm_mul_ps(rmsCoeff, _mm_sub_ps(ms, sq)), sq);
+			ms = _mm_and_ps(ms, _mm_cmpge_ps(ms, flush));
+		}
+
+		_mm_storeu_ps(&m_pPeak[c], _mm_max_ps(_mm_loadu_ps(&m_pPeak[c]), a));
+		_mm_storeu_ps(&m_pEnvelope[c], envelope);
+		_mm_storeu_ps(&m_pEnvelopeMax[c], envelopeMax);
+		_mm_storeu_ps(&m_pVU[c], vu);
+		_mm_storeu_ps(&m_pPPM[c], ppm);
+		_mm_storeu_ps(&m_pMeanSquare[c], ms);
+	}
+#else
+	for(UINT c = 0; c < m_uChannels; c++)
+	{
+		float a = fabs(m_pInput[c]);
+		float sq = m_pInput[c]*m_pInput[c];
+		UINT uSquare;
+		memcpy(&uSquare, &m_pDetectSquare[c], sizeof(UINT));
+		float detect = uSquare ? sq : a;
+
+		for(UINT n = 0; n < uFrames; n++)
+		{
+			float coeff = detect > m_pEnvelope[c] ? m_pAttackCoeff[c] : m_pReleaseCoeff[c];
+			m_pEnvelope[c] = fmin(coeff*(m_pEnvelope[c] - detect) + detect, 1.0);
+			if(m_pEnvelope[c] < METER_FLUSH) m_pEnvelope[c] = 0.0;
+			if(m_pEnvelope[c] > m_pEnvelopeMax[c]) m_pEnvelopeMax[c] = m_pEnvelope[c];
+
+			m_pVU[c] = m_fVUCoeff*(m_pVU[c] - a) + a;
+			if(m_pVU[c] < METER_FLUSH) m_pVU[c] = 0.0;
+
+			coeff = a > m_pPPM[c] ? m_fPPMAttackCoeff : m_fPPMReleaseCoeff;
+			m_pPPM[c] = coeff*(m_pPPM[c] - a) + a;
+			if(m_pPPM[c] < METER_FLUSH) m_pPPM[c] = 0.0;
+
+			m_pMeanSquare[c] = m_fRMSCoeff*(m_pMeanSquare[c] - sq) + sq;
+			if(m_pMeanSquare[c] < METER_FLUSH) m_pMeanSquare[c] = 0.0;
+		}
+
+		if(a > m_pPeak[c]) m_pPeak[c] = a;
+	}
+#endif
+}
+
+bool CMeterEngine::endBlock(float* pFrame)
+{
+	if(m_uBlockFrames == 0 || m_uChannels == 0)
+		return false;
+
+	float* pScratch = m_pHoldFrames + m_uStride;
+	const float fFloorPower = METER_FLOOR_AMPLITUDE*METER_FLOOR_AMPLITUDE;
+
+	// --- the detector as the parameter has it: RMS mode is the root of the mean square
+	float* pDetector = &pFrame[METER_READINGS*m_uStride];
+	for(UINT i = 0; i < m_uStride; i++)
+	{
+		UINT uRoot;
+		memcpy(&uRoot, &m_pDetectRoot[i], sizeof(UINT));
+		pDetector[i] = uRoot ? sqrt(m_pEnvelopeMax[i]) : m_pEnvelopeMax[i];
+	}
+
+	for(UINT i = 0; i < m_uStride; i++)
+		pScratch[i] = m_pVU[i]*METER_VU_SINE_SCALE;
+
+	rowTodB(pDetector, &pFrame[METER_READING_DETECTOR*m_uStride], m_uStride, DB_PER_OCTAVE_AMPLITUDE, METER_FLOOR_AMPLITUDE);
+	rowTodB(m_pPeak, &pFrame[METER_READING_PEAK_HOLD*m_uStride], m_uStride, DB_PER_OCTAVE_AMPLITUDE, METER_FLOOR_AMPLITUDE);
+	rowTodB(pScratch, &pFrame[METER_READING_VU*m_uStride], m_uStride, DB_PER_OCTAVE_AMPLITUDE, METER_FLOOR_AMPLITUDE);
+	rowTodB(m_pPPM, &pFrame[METER_READING_PPM*m_uStride], m_uStride, DB_PER_OCTAVE_AMPLITUDE, METER_FLOOR_AMPLITUDE);
+	rowTodB(m_pMeanSquare, &pFrame[METER_READING_RMS*m_uStride], m_uStride, DB_PER_OCTAVE_POWER, fFloorPower);
+
+	// --- peak hold on the block peak, in dB
+	float* pHold = &pFrame[METER_READING_PEAK_HOLD*m_uStride];
+	float fFrames = (float)m_uBlockFrames;
+	for(UINT i = 0; i < m_uChannels; i++)
+	{
+		if(pHold[i] >= m_pPeakHold_dB[i])
+		{
+			m_pPeakHold_dB[i] = pHold[i];
+			m_pHoldFrames[i] = m_fHoldFrames;
+		}
+		else if(m_pHoldFrames[i] > fFrames)
+			m_pHoldFrames[i] -= fFrames;
+		else
+		{
+			m_pPeakHold_dB[i] = fmax(m_pPeakHold_dB[i] - (fFrames - m_pHoldFrames[i])*m_fFall_dB_PerFrame, fmax(pHold[i], METER_FLOOR_DB));
+			m_pHoldFrames[i] = 0.0;
+		}
+		pHold[i] = m_pPeakHold_dB[i];
+	}
+
+	memset(m_pPeak, 0, m_uStride*sizeof(float));
+	memset(m_pEnvelopeMax, 0, m_uStride*sizeof(float));
+	m_uBlockFrames = 0;
+	return true;
+}
+
+void CMeterEngine::displayFrame(const float* pFrame)
+{
+	// --- the detector is the highest since the last tick, the rest the newest
+	float* pDetector = &m_pDisplay[METER_READINGS*m_uStride];
+	float* pDetector_dB = &m_pDisplay[METER_READING_DETECTOR*m_uStride];
+	if(!m_bDisplayFrames)
+	{
+		for(UINT i = 0; i < m_uStride; i++)
+		{
+			pDetector[i] = 0.0;
+			pDetector_dB[i] = METER_FLOOR_DB;
+		}
+		m_bDisplayFrames = true;
+	}
+
+	for(UINT i = 0; i < m_uStride; i++)
+	{
+		pDetector[i] = fmax(pDetector[i], pFrame[METER_READINGS*m_uStride + i]);
+		pDetector_dB[i] = fmax(pDetector_dB[i], pFrame[METER_READING_DETECTOR*m_uStride + i]);
+	}
+	memcpy(&m_pDisplay[m_uStride], &pFrame[m_uStride], (METER_READINGS - 1)*m_uStride*sizeof(float));
+}
+
+bool CMeterEngine::updateDisplay()
+{
+	if(!m_bDisplayFrames)
+		return false;
+
+	m_bDisplayFrames = false;
+	for(size_t i = 0; i < m_Listeners.size(); i++)
+		m_Listeners[i]->meterDisplayChanged();
+
+	return true;
+}
+
+void CMeterEngine::addListener(IMeterDisplayListener* pListener)
+{
+	for(size_t i = 0; i < m_Listeners.size(); i++)
+		if(m_Listeners[i] == pListener)
+			return;
+
+	m_Listeners.push_back(pListener);
+}
+
+void CMeterEngine::removeListener(IMeterDisplayListener* pListener)
+{
+	for(size_t i = 0; i < m_Listeners.size(); i++)
+	{
+		if(m_Listeners[i] == pListener)
+		{
+			m_Listeners.erase(m_Listeners.begin() + i);
+			return;
+		}
+	}
+}
+
+
+// CParamDirtyBits Implementation ----------------------------------------------------------------
+//
+CParamDirtyBits::CParamDirtyBits(void)
+{
+	for(UINT i = 0; i < PARAM_DIRTY_WORDS; i++)
+		m_uWords[i].store(0);
+	m_uSummary.store(0);
+}
+
+// --- the flag goes in before the summary bit that announces it; a take()
+//     in between finds it either now or on its next call. Both are release
+//     stores, so whichever one take() sees, it also sees the variable the
+//     plug-in changed before calling set()
+void CParamDirtyBits::set(UINT uIndex)
+{
+	if(uIndex >= PARAM_DIRTY_MAX)
+	{
+		setAll();
+		return;
+	}
+
+	UINT uWord = uIndex >> 5;
+	m_uWords[uWord].fetch_or(1u << (uIndex & 31), std::memory_order_release);
+	m_uSummary.fetch_or(1u << uWord, std::memory_order_release);
+}
+
+void CParamDirtyBits::setAll()
+{
+	for(UINT i = 0; i < PARAM_DIRTY_WORDS; i++)
+		m_uWords[i].store(0xFFFFFFFF, std::memory_order_release);
+	m_uSummary.store(0xFFFFFFFF, std::memory_order_release);
+}
+
+UINT CParamDirtyBits::take(UINT* pIndexes)
+{
+	if(m_uSummary.load(std::memory_order_relaxed) == 0)
+		return 0;
+
+	UINT uSummary = m_uSummary.exchange(0, std::memory_order_acquire);
+	UINT uCount = 0;
+
+	for(UINT uWord = 0; uSummary != 0; uWord++, uSummary >>= 1)
+	{
+		if(!(uSummary & 1))
+			continue;
+
+		UINT uBits = m_uWords[uWord].exchange(0, std::memory_order_acquire);
+		for(UINT uBit = 0; uBits != 0; uBit++, uBits >>= 1)
+		{
+			if(uBits & 1)
+				pIndexes[uCount++] = (uWord << 5) + uBit;
+		}
+	}
+
+	return uCount;
+}
+
+// CJoystickProgram Implementation ----------------------------------------------------------------
+//
+CJoystickProgram::CJoystickProgram(float* pJSProgramTable, UINT uMode)
+{
+	m_bRunning = false;
+	m_uSampleCount = 0;
+	m_pJSProgramTable = pJSProgramTable;
+	m_fTimerDurationMSec = 0;
+	m_nCurrentProgramStep = 0;
+	m_fA_Mix = 0.25;
+	m_fB_Mix = 0.25;
+	m_fC_Mix = 0.25;
+	m_fD_Mix = 0.25;
+	m_fAC_Mix = 0.0;
+	m_fBD_Mix = 0.0;
+	m_uJSMode = uMode;
+	m_bDirInc = true;
+}
+
+void CJoystickProgram::setJSMode(UINT uMode)
+{
+	m_uJSMode = uMode;
+	m_bDirInc = true;
+}
+
+void CJoystickProgram::setSampleRate(int nSampleRate)
+{
+	m_fSampleRate = (float)nSampleRate;
+}
+
+CJoystickProgram::~CJoystickProgram(void)
+{
+
+}
+
+void CJoystickProgram::incTimer()
+{
+	if(!m_bRunning)
+		return;
+
+	m_uSampleCount++;
+
+	calculateCurrentVectorMix();
+
+	if(m_uSampleCount > (UINT)m_nTimerDurationSamples)
+	{
+		// goto the next step
+		if(m_bDirInc)
+			m_nCurrentProgramStep++;
+		else
+			m_nCurrentProgramStep--;
+
+		if(m_nCurrentProgramStep > m_nNumSteps || m_nCurrentProgramStep < 0)
+		{
+			if(m_uJSMode == JS_ONESHOT)
+			{
+				reset();
+				return;
+			}
+			else if(m_uJSMode == JS_LOOP)
+			{
+				m_nCurrentProgramStep = 0;
+			}
+			else if(m_uJSMode == JS_LOOP_BACKANDFORTH)
+			{
+				m_bDirInc = !m_bDirInc;
+				if(m_bDirInc)
+					m_nCurrentProgramStep +=2;
+				else
+					m_nCurrentProgramStep -= 2;
+			}
+			else if(m_uJSMode == JS_SUSTAIN)
+			{
+				m_bRunning = false;
+				return; // just return
+			}
+		}
+		else if(m_uJSMode == JS_SUSTAIN && m_nCurrentProgramStep == m_nNumSteps)
+		{
+			pauseProgram(); // until user restarts with a note-off event
+		}
+
+		// setup for next step
+		m_uSampleCount = 0;
+
+		m_fStartA_Mix = m_fEndA_Mix;
+		m_fStartB_Mix = m_fEndB_Mix;
+		m_fStartC_Mix = m_fEndC_Mix;
+		m_fStartD_Mix = m_fEndD_Mix;
+		m_fStartAC_Mix = m_fEndAC_Mix;
+		m_fStartBD_Mix = m_fEndBD_Mix;
+
+		m_fEndA_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,0)];
+		m_fEndB_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,1)];
+		m_fEndC_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,2)];
+		m_fEndD_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,3)];
+		m_fEndAC_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,5)];
+		m_fEndBD_Mix = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,6)];
+
+		if(m_bDirInc)
+			m_fTimerDurationMSec = m_nCurrentProgramStep > 0 ? m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep-1,4)] : m_pJSProgramTable[JS_PROG_INDEX(m_nNumSteps,4)];
+		else
+			m_fTimerDurationMSec = m_pJSProgramTable[JS_PROG_INDEX(m_nCurrentProgramStep,4)];
+
+		m_nTimerDurationSamples = (int)((m_fTimerDurationMSec/1000.0)*(m_fSampleRate));
+	}
+}
+
+void CJoystickProgram::calculateCurrentVectorMix()
+{
+	float m = (m_fEndA_Mix - m_fStartA_Mix)/(float)m_nTimerDurationSamples;
+	m_fA_Mix = m*(float)m_uSampleCount + m_fStartA_Mix;
+
+	m = (m_fEndB_Mix - m_fStartB_Mix)/(float)m_nTimerDurationSamples;
+	m_fB_Mix = m*(float)m_uSampleCount + m_fStartB_Mix;
+
+	m = (m_fEndC_Mix - m_fStartC_Mix)/(float)m_nTimerDurationSamples;
+	m_fC_Mix = m*(float)m_uSampleCount + m_fStartC_Mix;
+
+	m = (m_fEndD_Mix - m_fStartD_Mix)/(float)m_nTimerDurationSamples;
+	m_fD_Mix = m*(float)m_uSampleCount + m_fStartD_Mix;
+
+	m = (m_fEndAC_Mix - m_fStartAC_Mix)/(float)m_nTimerDurationSamples;
+	m_fAC_Mix = m*(float)m_uSampleCount + m_fStartAC_Mix;
+
+	m = (m_fEndBD_Mix - m_fStartBD_Mix)/(float)m_nTimerDurationSamples;
+	m_fBD_Mix = m*(float)m_uSampleCount + m_fStartBD_Mix;
+}
+
+void CJoystickProgram::startProgram()
+{
+	m_nNumSteps = 0;
+	for(int i=1; i<MAX_JS_PROGRAM_STEPS; i++)
+	{
+		if(m_pJSProgramTable[JS_PROG_INDEX(i,4)] > 0)
+			m_nNumSteps++;
+	}
+
+	if(m_nNumSteps == 0)
+		return;
+
+	m_bDirInc = true;
+	m_nCurrentProgramStep = 1;
+
+	m_fStartA_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,0)];
+	m_fStartB_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,1)];
+	m_fStartC_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,2)];
+	m_fStartD_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,3)];
+	m_fStartAC_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,5)];
+	m_fStartBD_Mix = m_pJSProgramTable[JS_PROG_INDEX(0,6)];
+
+	m_fEndA_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,0)];
+	m_fEndB_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,1)];
+	m_fEndC_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,2)];
+	m_fEndD_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,3)];
+	m_fEndAC_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,5)];
+	m_fEndBD_Mix = m_pJSProgramTable[JS_PROG_INDEX(1,6)];
+
+	m_fTimerDurationMSec = m_pJSProgramTable[JS_PROG_INDEX(0,4)];
+	m_nTimerDurationSamples = (int)((m_fTimerDurationMSec/1000.0)*(m_fSampleRate));
+
+	m_bRunning = true;
+}
+
+// CWaveFileReader Implementation ----------------------------------------------------------------
+//
+#if !defined _WINDOWS && !defined _WINDLL
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const UINT WAVE_TAG_PCM = 0x0001;
+static const UINT WAVE_TAG_IEEE_FLOAT = 0x0003;
+static const UINT WAVE_TAG_EXTENSIBLE = 0xFFFE;
+static const unsigned long long WAVE_CHUNK_HEADER = 8;
+
+// --- header fields byte by byte, so they need no alignment
+static inline UINT readLE16(const unsigned char* p)
+{
+	return (UINT)p[0] | ((UINT)p[1] << 8);
+}
+
+static inline UINT readLE32(const unsigned char* p)
+{
+	return (UINT)p[0] | ((UINT)p[1] << 8) | ((UINT)p[2] << 16) | ((UINT)p[3] << 24);
+}
+
+static inline unsigned long long readLE64(const unsigned char* p)
+{
+	return (unsigned long long)readLE32(p) | ((unsigned long long)readLE32(p + 4) << 32);
+}
+
+CWaveFileReader::CWaveFileReader(void)
+{
+	m_pFile = NULL;
+	m_uFileSize = 0;
+	m_hFile = NULL;
+	m_hMapping = NULL;
+	m_pData = NULL;
+	close();
+}
+
+CWaveFileReader::~CWaveFileReader(void)
+{
+	close();
+}
+
+bool CWaveFileReader::open(const char* pFilePath)
+{
+	close();
+	if(!pFilePath)
+		return false;
+
+#if defined _WINDOWS || defined _WINDLL
+	HANDLE hFile = CreateFileA(pFilePath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if(hFile == INVALID_HANDLE_VALUE)
+		return false;
+	m_hFile = hFile;
+
+	LARGE_INTEGER size;
+	if(!GetFileSizeEx(hFile, &size) || size.QuadPart == 0)
+	{
+		close();
+		return false;
+	}
+	m_uFileSize = (unsigned long long)size.QuadPart;
+
+	m_hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if(m_hMapping)
+		m_pFile = (const unsigned char*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+#else
+	int nFile = ::open(pFilePath, O_RDONLY);
+	if(nFile < 0)
+		return false;
+
+	struct stat info;
+	if(fstat(nFile, &info) == 0 && info.st_size > 0)
+	{
+		m_uFileSize = (unsigned long long)info.st_size;
+		void* pMapping = mmap(NULL, (size_t)m_uFileSize, PROT_READ, MAP_PRIVATE, nFile, 0);
+		if(pMapping != MAP_FAILED)
+		{
+			m_pFile = (const unsigned char*)pMapping;
+			madvise(pMapping, (size_t)m_uFileSize, MADV_SEQUENTIAL);
+		}
+	}
+
+	// --- the mapping keeps the file
+	::close(nFile);
+#endif
+
+	if(!m_pFile || !parse())
+	{
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+void CWaveFileReader::close()
+{
+#if defined _WINDOWS || defined _WINDLL
+	if(m_pFile)
+		UnmapViewOfFile(m_pFile);
+	if(m_hMapping)
+		CloseHandle((HANDLE)m_hMapping);
+	if(m_hFile)
+		CloseHandle((HANDLE)m_hFile);
+#else
+	if(m_pFile)
+		munmap((void*)m_pFile, (size_t)m_uFileSize);
+#endif
+
+	m_pFile = NULL;
+	m_uFileSize = 0;
+	m_hFile = NULL;
+	m_hMapping = NULL;
+
+	m_pData = NULL;
+	m_uChannels = 0;
+	m_uSampleRate = 0;
+	m_uFormat = WAVE_SAMPLE_NONE;
+	m_uBytesPerSample = 0;
+	m_uFrames = 0;
+	m_bHasSamplerInfo = false;
+	memset(&m_SamplerInfo, 0, sizeof(waveSamplerInfo));
+}
+
+// --- RIFF/WAVE or RF64/WAVE, then one pass over the chunks; a data chunk
+//     that claims more than the file holds (a recording cut short, or a size
+//     left at 0 or 0xFFFFFFFF by a streaming writer) is read to the end
+bool CWaveFileReader::parse()
+{
+	if(m_uFileSize < 12 || memcmp(&m_pFile[8], "WAVE", 4) != 0)
+		return false;
+
+	bool bRF64 = memcmp(m_pFile, "RF64", 4) == 0;
+	if(!bRF64 && memcmp(m_pFile, "RIFF", 4) != 0)
+		return false;
+
+	unsigned long long uDataSize64 = 0;
+	const unsigned char* pData = NULL;
+	unsigned long long uDataSize = 0;
+	bool bFormat = false;
+
+	unsigned long long uPos = 12;
+	while(uPos + WAVE_CHUNK_HEADER <= m_uFileSize)
+	{
+		const unsigned char* pChunk = &m_pFile[uPos];
+		unsigned long long uSize = readLE32(&pChunk[4]);
+		unsigned long long uAvailable = m_uFileSize - uPos - WAVE_CHUNK_HEADER;
+
+		if(memcmp(pChunk, "data", 4) == 0)
+		{
+			if(bRF64 && uSize == 0xFFFFFFFF)
+				uSize = uDataSize64;
+			if(uSize == 0 || uSize > uAvailable)
+				uSize = uAvailable;
+
+			pData = &pChunk[WAVE_CHUNK_HEADER];
+			uDataSize = uSize;
+		}
+		else if(uSize > uAvailable)
+			break;
+		else if(memcmp(pChunk, "fmt ", 4) == 0)
+			bFormat = parseFormat(&pChunk[WAVE_CHUNK_HEADER], uSize);
+		else if(memcmp(pChunk, "ds64", 4) == 0 && uSize >= 16)
+			uDataSize64 = readLE64(&pChunk[WAVE_CHUNK_HEADER + 8]);
+		else if(memcmp(pChunk, "smpl", 4) == 0)
+			parseSampler(&pChunk[WAVE_CHUNK_HEADER], uSize);
+
+		// --- chunks are padded to an even size
+		uPos += WAVE_CHUNK_HEADER + uSize + (uSize & 1);
+	}
+
+	if(!bFormat || !pData)
+		return false;
+
+	m_pData = pData;
+	m_uFrames = uDataSize/(m_uChannels*m_uBytesPerSample);
+	return m_uFrames > 0;
+}
+
+bool CWaveFileReader::parseFormat(const unsigned char* pChunk, unsigned long long uSize)
+{
+	if(uSize < 16)
+		return false;
+
+	UINT uTag = readLE16(&pChunk[0]);
+	UINT uChannels = readLE16(&pChunk[2]);
+	UINT uSampleRate = readLE32(&pChunk[4]);
+	UINT uBlockAlign = readLE16(&pChunk[12]);
+	UINT uBits = readLE16(&pChunk[14]);
+
+	// --- the sub format GUID starts with the format tag it stands for
+	if(uTag == WAVE_TAG_EXTENSIBLE)
+	{
+		if(uSize < 40)
+			return false;
+		uTag = readLE16(&pChunk[24]);
+	}
+
+	if(uChannels == 0 || uBlockAlign == 0 || uBlockAlign % uChannels != 0)
+		return false;
+
+	// --- the container decides: 24 bits in 4 bytes are left justified, which
+	//     reads correctly as 32-bit
+	UINT uBytes = uBlockAlign/uChannels;
+	UINT uFormat = WAVE_SAMPLE_NONE;
+	if(uTag == WAVE_TAG_PCM)
+	{
+		if(uBytes == 2 && uBits == 16) uFormat = WAVE_SAMPLE_INT16;
+		else if(uBytes == 3 && uBits == 24) uFormat = WAVE_SAMPLE_INT24;
+		else if(uBytes == 4 && (uBits == 24 || uBits == 32)) uFormat = WAVE_SAMPLE_INT32;
+	}
+	else if(uTag == WAVE_TAG_IEEE_FLOAT)
+	{
+		if(uBytes == 4 && uBits == 32) uFormat = WAVE_SAMPLE_FLOAT32;
+		else if(uBytes == 8 && uBits == 64) uFormat = WAVE_SAMPLE_FLOAT64;
+	}
+
+	if(uFormat == WAVE_SAMPLE_NONE)
+		return false;
+
+	m_uChannels = uChannels;
+	m_uSampleRate = uSampleRate;
+	m_uFormat = uFormat;
+	m_uBytesPerSample = uBytes;
+	return true;
+}
+
+/* smpl chunk, after the chunk header
+	0x00	Manufacturer, Product, Sample Period (skipped)
+	0x0C	MIDI Unity Note
+	0x10	MIDI Pitch Fraction
+	0x14	SMPTE Format
+	0x18	SMPTE Offset
+	0x1C	Num Sample Loops
+	0x20	Sampler Data
+	0x24	loops, 24 bytes each: Cue Point ID, Type, Start, End, Fraction, Play Count
+*/
+void CWaveFileReader::parseSampler(const unsigned char* pChunk, unsigned long long uSize)
+{
+	if(uSize < 36)
+		return;
+
+	m_bHasSamplerInfo = true;
+	m_SamplerInfo.uMIDINote = readLE32(&pChunk[0x0C]);
+	m_SamplerInfo.uMIDIPitchFraction = readLE32(&pChunk[0x10]);
+	m_SamplerInfo.uSMPTEFormat = readLE32(&pChunk[0x14]);
+	m_SamplerInfo.uSMPTEOffset = readLE32(&pChunk[0x18]);
+	m_SamplerInfo.uLoopCount = readLE32(&pChunk[0x1C]);
+
+	// --- only the first loop; a sustaining wave needs no more
+	if(m_SamplerInfo.uLoopCount > 0 && uSize >= 36 + 24)
+	{
+		m_SamplerInfo.uLoopType = readLE32(&pChunk[0x24 + 4]);
+		m_SamplerInfo.uLoopStart = readLE32(&pChunk[0x24 + 8]);
+		m_SamplerInfo.uLoopEnd = readLE32(&pChunk[0x24 + 12]);
+	}
+}
+
+UINT CWaveFileReader::read(unsigned long long uFrame, float* pDest, UINT uFrames)
+{
+	if(!m_pData || uFrame >= m_uFrames)
+		return 0;
+
+	if(uFrames > m_uFrames - uFrame)
+		uFrames = (UINT)(m_uFrames - uFrame);
+
+	convert(&m_pData[uFrame*m_uChannels*m_uBytesPerSample], m_uFormat, pDest, (size_t)uFrames*m_uChannels);
+	return uFrames;
+}
+
+const float* CWaveFileReader::getBlock(unsigned long long uFrame, UINT uFrames, float* pScratch, UINT& uFramesRead)
+{
+	uFramesRead = 0;
+	if(!m_pData || uFrame >= m_uFrames)
+		return NULL;
+
+	// --- float files are already what the caller wants
+	const unsigned char* pFrame = &m_pData[uFrame*m_uChannels*m_uBytesPerSample];
+	if(m_uFormat == WAVE_SAMPLE_FLOAT32 && ((size_t)pFrame & 3) == 0)
+	{
+		uFramesRead = uFrames < m_uFrames - uFrame ? uFrames : (UINT)(m_uFrames - uFrame);
+		return (const float*)pFrame;
+	}
+
+	uFramesRead = read(uFrame, pScratch, uFrames);
+	return pScratch;
+}
+
+// --- full scale for each integer width
+static const float WAVE_SCALE_16 = 1.0/32768.0;
+static const float WAVE_SCALE_32 = 1.0/2147483648.0;
+
+void CWaveFileReader::convert(const void* pSource, UINT uFormat, float* pDest, size_t uCount)
+{
+	const unsigned char* pBytes = (const unsigned char*)pSource;
+	size_t i = 0;
+
+	switch(uFormat)
+	{
+		case WAVE_SAMPLE_INT16:
+		{
+#if RAFX_OBJECTS_SSE2
+			// --- each short into the top of an int, then shifted back down with its sign
+			const __m128 scale = _mm_set1_ps(WAVE_SCALE_16);
+			for(; i + 8 <= uCount; i += 8)
+			{
+				__m128i x = _mm_loadu_si128((const __m128i*)&pBytes[2*i]);
+				__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+				__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+				_mm_storeu_ps(&pDest[i], _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+				_mm_storeu_ps(&pDest[i + 4], _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+			}
+#endif
+			for(; i < uCount; i++)
+			{
+				short s;
+				memcpy(&s, &pBytes[2*i], sizeof(short));
+				pDest[i] = s*WAVE_SCALE_16;
+			}
+			break;
+		}
+		case WAVE_SAMPLE_INT24:
+		{
+#if RAFX_OBJECTS_SSE2
+			// --- four 3-byte samples as four 4-byte loads, shifted into the top of
+			//     each int; the last load reads one byte of the next sample, so a
+			//     sample must follow the group
+			const __m128 scale = _mm_set1_ps(WAVE_SCALE_32);
+			for(; i + 5 <= uCount; i += 4)
+			{
+				int n[4];
+				memcpy(&n[0], &pBytes[3*i], 4);
+				memcpy(&n[1], &pBytes[3*i + 3], 4);
+				memcpy(&n[2], &pBytes[3*i + 6], 4);
+				memcpy(&n[3], &pBytes[3*i + 9], 4);
+				__m128i x = _mm_slli_epi32(_mm_loadu_si128((const __m128i*)&n[0]), 8);
+				_mm_storeu_ps(&pDest[i], _mm_mul_ps(_mm_cvtepi32_ps(x), scale));
+			}
+#endif
+			for(; i < uCount; i++)
+			{
+				const unsigned char* p = &pBytes[3*i];
+				int n = (int)(((UINT)p[0] << 8) | ((UINT)p[1] << 16) | ((UINT)p[2] << 24));
+				pDest[i] = n*WAVE_SCALE_32;
+			}
+			break;
+		}
+		case WAVE_SAMPLE_INT32:
+		{
+#if RAFX_OBJECTS_SSE2
+			const __m128 scale = _mm_set1_ps(WAVE_SCALE_32);
+			for(; i + 4 <= uCount; i += 4)
+			{
+				__m128i x = _mm_loadu_si128((const __m128i*)&pBytes[4*i]);
+				_mm_storeu_ps(&pDest[i], _mm_mul_ps(_mm_cvtepi32_ps(x), scale));
+			}
+#endif
+			for(; i < uCount; i++)
+			{
+				int n;
+				memcpy(&n, &pBytes[4*i], sizeof(int));
+				pDest[i] = n*WAVE_SCALE_32;
+			}
+			break;
+		}
+		case WAVE_SAMPLE_FLOAT32:
+		{
+			memcpy(pDest, pBytes, uCount*sizeof(float));
+			break;
+		}
+		case WAVE_SAMPLE_FLOAT64:
+		{
+#if RAFX_OBJECTS_SSE2
+			for(; i + 4 <= uCount; i += 4)
+			{
+				__m128 lo = _mm_cvtpd_ps(_mm_loadu_pd((const double*)&pBytes[8*i]));
+				__m128 hi = _mm_cvtpd_ps(_mm_loadu_pd((const double*)&pBytes[8*i + 16]));
+				_mm_storeu_ps(&pDest[i], _mm_movelh_ps(lo, hi));
+			}
+#endif
+			for(; i < uCount; i++)
+			{
+				double d;
+				memcpy(&d, &pBytes[8*i], sizeof(double));
+				pDest[i] = (float)d;
+			}
+			break;
+		}
+		default:
+			memset(pDest, 0, uCount*sizeof(float));
+			break;
+	}
+}
+
+// CWaveData Implementation ----------------------------------------------------------------
+//
+CWaveData::CWaveData(char* pFilePath)
+{
+	m_bWaveLoaded = false;
 
 	m_pWaveBuffer = NULL;
+	m_uNumChannels = 0;
+	m_uSampleRate = 0;
+	m_uSampleCount = 0;
 	m_uLoopCount = 0;
 	m_uLoopStartIndex = 0;
 	m_uLoopEndIndex = 0;
@@ -1368,6 +3270,41 @@ CWaveData::~CWaveData()
 
 }
 
+#if defined _WINDOWS || defined _WINDLL
+// prompts with file open dialog, returns TRUE if successfuly
+// opened and parsed the file into the member m_pWaveBuffer
+bool CWaveData::initWithUserWAVFile(char* pInitDir)
+{
+	OPENFILENAME ofn; // common dialog box structure
+	char szFile[260]; // buffer for file name
+
+    // open a file name
+	ZeroMemory( &ofn , sizeof( ofn));
+	ofn.lStructSize = sizeof ( ofn );
+	ofn.hwndOwner = NULL  ;
+	ofn.lpstrFile = szFile ;
+	ofn.lpstrFile[0] = '\0';
+	ofn.nMaxFile = sizeof(szFile);
+	ofn.lpstrFilter = "Wave\0*.WAV\0";
+	ofn.nFilterIndex =1;
+	ofn.lpstrFileTitle = NULL ;
+	ofn.nMaxFileTitle = 0 ;
+	ofn.lpstrInitialDir=pInitDir ; // you can default to a directory here
+	ofn.Flags = OFN_PATHMUSTEXIST|OFN_FILEMUSTEXIST ;
+
+	GetOpenFileName( &ofn );
+
+	if(!ofn.lpstrFile)
+		return false;
+
+	m_bWaveLoaded = readWaveFile(ofn.lpstrFile);
+
+	//// Now simply display the file name
+	// MessageBox ( NULL , ofn.lpstrFile , "File Name" , MB_OK);
+
+	return m_bWaveLoaded;
+}
+#else
 // --- prompts with file open dialog, returns TRUE if successfuly
 //     opened and parsed the file into the member m_pWaveBuffer
 //
@@ -1388,10 +3325,11 @@ bool CWaveData::initWithUserWAVFile(char* pInitDir)
     // --- not availale :(
     return false;
 }
+#endif
 
-// THE FOLLOWING TYPES ARE SUPPORTED:
+// THE FOLLOWING TYPES ARE SUPPORTED (see CWaveFileReader):
 //
-// WAVE_FORMAT_PCM and WAVE_FORMAT_EXTENSIBLE
+// WAVE_FORMAT_PCM, WAVE_FORMAT_IEEE_FLOAT and WAVE_FORMAT_EXTENSIBLE
 //
 // 16-BIT Signed Integer PCM
 // 24-BIT Signed Integer PCM 3-ByteAlign
@@ -1399,858 +3337,387 @@ bool CWaveData::initWithUserWAVFile(char* pInitDir)
 // 32-BIT Signed Integer PCM
 // 32-BIT Floating Point
 // 64-BIT Floating Point
-bool CWaveData::readWaveFile(char* pFilePath)
-{
-    bool bSampleLoaded = false;
-    bool bFailed = false;
-    RIFF_CHUNK RiffChunk = {{0}};
-    WAVE_FILE_HEADER WaveFileHeader;
-    DWORD dwIncrementBytes;
-    WAVE_SAMPLE WaveSample;
+bool CWaveData::readWaveFile(char* pFilePath, std::atomic<UINT>* pProgress, const std::atomic<bool>* pCancel)
+{
 	m_uNumChannels = 0;
 	m_uSampleRate = 0;
 	m_uSampleCount = 0;
 
-    // --- create filestream from open binary file
-    ifstream inFile;
-    inFile.open(pFilePath, std::ifstream::binary);
-
-    // --- OK?
-    bool bIsOpen = inFile.is_open();
-
-    if(!bIsOpen)
-        return false;
-
-    // --- this is used to identify each chunk
-    char szIdentifier[5] = {0};
-
-    // --- advance 12 chars
-    inFile.seekg(12);
-
-    // --- read first RiffChunk and the WaveFileHeader
-    inFile.read((char*)(&RiffChunk), sizeof(RiffChunk));
-    inFile.read((char*)(&WaveFileHeader), sizeof(WaveFileHeader));
-
-    // --- set the waveformatex
-    WaveSample.WaveFormatEx.wFormatTag      = WaveFileHeader.wFormatTag;
-    WaveSample.WaveFormatEx.nChannels       = WaveFileHeader.wChannels;
-    WaveSample.WaveFormatEx.nSamplesPerSec  = WaveFileHeader.dwSamplesPerSec;
-    WaveSample.WaveFormatEx.nAvgBytesPerSec = WaveFileHeader.dwAvgBytesPerSec;
-    WaveSample.WaveFormatEx.nBlockAlign     = WaveFileHeader.wBlockAlign;
-    WaveSample.WaveFormatEx.wBitsPerSample  = WaveFileHeader.wBitsPerSample;
-    WaveSample.WaveFormatEx.cbSize          = 0;
-
-    // --- I don't support these types (compressed, uLaw/aLaw, etc..)
-    if(WaveSample.WaveFormatEx.wFormatTag != 1 && WaveSample.WaveFormatEx.wFormatTag != 3)
-    {
-        inFile.close();
-        return false;
-    }
-
-    // --- for backing up the first seek
-    dwIncrementBytes = sizeof(WaveFileHeader);
-
-    do {
-        // RiffChunk.dwLength - dwIncrementBytes sets the file pointer to position 0 first time through
-        // advance by RiffChunk.dwLength - dwIncrementBytes
-        int position = inFile.tellg();
-        inFile.seekg(position + (RiffChunk.dwLength - dwIncrementBytes));
-
-        // --- advanced past end of file?
-        bFailed = inFile.fail();
-
-        if(!bFailed)
-        {
-            // --- read the RiffChunk
-            inFile.read((char*)(&RiffChunk), sizeof(RiffChunk));
-
-            // --- this now makes the seekg() advance in RiffChunk.dwLength chunks
-            //     which vary with the type of chunk
-            dwIncrementBytes = 0;
-
-            // --- extract the chunk identifier
-            memcpy(szIdentifier, RiffChunk.IdentifierString, 4);
-        }
-
-    } while(strcmp(szIdentifier, "data") && !bFailed);
-
-    if(m_pWaveBuffer)
-        delete [] m_pWaveBuffer;
-
-    // --- AUDIO DATA CHUNK data
-    // --- 16 bit
-    if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 16)
-    {
-        WaveSample.pSampleData = (char*)alloca(RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        if(m_pWaveBuffer)
-            delete [] m_pWaveBuffer;
-
-        m_pWaveBuffer = new float[nSampleCount];
-        UInt16* pShorts = new UInt16[nSampleCount];
-
-        memset(pShorts, 0, nSampleCount*sizeof(UInt16));
-        int m = 0;
-        for(UINT i=0; i<nSampleCount; i++)
-        {
-            // MSB
-            pShorts[i] = (unsigned char)WaveSample.pSampleData[m+1];
-            pShorts[i] <<= 8;
-
-            // LSB
-            UInt16 lsb = (unsigned char)WaveSample.pSampleData[m];
-            // in case top of lsb is bad
-            lsb &= 0x00FF;
-            pShorts[i] |= lsb;
-            m+=2;
-        }
-
-        // convert to float -1.0 -> +1.0
-        for(UINT i = 0; i < nSampleCount; i++)
-        {
-            m_pWaveBuffer[i] = ((float)pShorts[i])/32768.0;
-        }
-
-        delete [] pShorts;
-        // free(WaveSample.pSampleData);
-
-        bSampleLoaded = true;
-    }
-    // --- 24 bits
-    else if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 24)
-    {
-        WaveSample.pSampleData = (char*)alloca(RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        // our buffer gets created
-        m_pWaveBuffer = new float[nSampleCount];
-
-        int* pSignedInts = new int[nSampleCount];
-        memset(pSignedInts, 0, nSampleCount*sizeof(int));
-
-        int m = 0;
-        int mask = 0x000000FF;
-
-        // 24-bits in 3-byte packs
-        if(WaveSample.WaveFormatEx.nBlockAlign/WaveSample.WaveFormatEx.nChannels == 3)
-        {
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+2];
-                pSignedInts[i] <<= 24;
-
-                // NSB
-                int nsb = (int)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pSignedInts[i] |= nsb;
-
-                // LSB
-                int lsb = (int)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                lsb <<= 8;
-                pSignedInts[i] |= lsb;
-
-                m+=3;
-            }
-        }
-
-        // --- 24-bits in 4-byte packs
-        if(WaveSample.WaveFormatEx.nBlockAlign/WaveSample.WaveFormatEx.nChannels == 4)
-        {
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+3];
-                pSignedInts[i] <<= 24;
-
-                // NSB
-                int nsb = (int)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pSignedInts[i] |= nsb;
-
-                // NSB2
-                int nsb2 = (int)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 8;
-                pSignedInts[i] |= nsb2;
-
-                // LSB
-                int lsb = (int)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pSignedInts[i] |= lsb;
-
-                m+=4;
-            }
-        }
-
-        // convet to float -1.0 -> +1.0
-        for(UINT i = 0; i < nSampleCount; i++)
-        {
-            m_pWaveBuffer[i] = ((float)pSignedInts[i])/2147483648.0; // 2147483648.0 = 1/2 of 2^32
-        }
-
-        delete [] pSignedInts;
-        //// free(WaveSample.pSampleData);
-
-        bSampleLoaded = true;
-
-    }
-    // --- 32 bits
-    else if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 32)
-    {
-        WaveSample.pSampleData = (char*)alloca(RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        // our buffer gets created
-        m_pWaveBuffer = new float[nSampleCount];
-
-        if(WaveSample.WaveFormatEx.wFormatTag == 1)
-        {
-            int* pSignedInts = new int[nSampleCount];
-            memset(pSignedInts, 0, nSampleCount*sizeof(int));
-
-            int m = 0;
-            int mask = 0x000000FF;
-
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+3];
-                pSignedInts[i] <<= 24;
-
-                // NSB
-                int nsb = (int)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pSignedInts[i] |= nsb;
-
-                // NSB2
-                int nsb2 = (int)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 8;
-                pSignedInts[i] |= nsb2;
-
-                // LSB
-                int lsb = (int)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pSignedInts[i] |= lsb;
-
-                m+=4;
-            }
-
-            // convet to float -1.0 -> +1.0
-            for(UINT i = 0; i < nSampleCount; i++)
-            {
-                m_pWaveBuffer[i] = ((float)pSignedInts[i])/2147483648.0; // 2147483648.0 = 1/2 of 2^32
-            }
-
-            delete [] pSignedInts;
-            // free(WaveSample.pSampleData);
-
-            bSampleLoaded = true;
-        }
-        else if(WaveSample.WaveFormatEx.wFormatTag == 3) // float
-        {
-            UInt32* pUSignedInts = new UInt32[nSampleCount];
-            memset(pUSignedInts, 0, nSampleCount*sizeof(UInt32));
-
-            int m = 0;
-            int mask = 0x000000FF;
-
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pUSignedInts[i] = (unsigned char)WaveSample.pSampleData[m+3];
-                pUSignedInts[i] <<= 24;
-
-                // NSB
-                UInt32 nsb = (UInt32)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 16;
-                pUSignedInts[i] |= nsb;
-
-                // NSB2
-                UInt32 nsb2 = (UInt32)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 8;
-                pUSignedInts[i] |= nsb2;
-
-                // LSB
-                UInt32 lsb = (UInt32)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pUSignedInts[i] |= lsb;
-
-                m+=4;
-            }
-
-            // --- Use the Union trick to re-use same memory location as two different data types
-            UWaveData wd;
-            for(UINT i = 0; i < nSampleCount; i++)
-            {
-                // save uint version
-                wd.u = pUSignedInts[i];
-                m_pWaveBuffer[i] = wd.f;
-            }
-
-            delete []pUSignedInts;
-            // free(WaveSample.pSampleData);
-
-            bSampleLoaded = true;
-        }
-    }
-    // --- 64 bits
-    else if(!bFailed && WaveSample.WaveFormatEx.wBitsPerSample == 64)
-    {
-        WaveSample.pSampleData = (char*)alloca(RiffChunk.dwLength);
-        WaveSample.Size = RiffChunk.dwLength;
-
-        inFile.read(WaveSample.pSampleData, RiffChunk.dwLength);
-
-        UINT nSampleCount = (float)RiffChunk.dwLength/(float)(WaveSample.WaveFormatEx.wBitsPerSample/8.0);
-        m_uSampleCount = nSampleCount;
-
-        m_uNumChannels = WaveSample.WaveFormatEx.nChannels;
-        m_uSampleRate = WaveSample.WaveFormatEx.nSamplesPerSec;
-
-        // our buffer gets created
-        m_pWaveBuffer = new float[nSampleCount];
-
-        // floating point only
-        if(WaveSample.WaveFormatEx.wFormatTag == 3) // float
-        {
-            UInt64* pUSignedLongLongs = new UInt64[nSampleCount];
-            memset(pUSignedLongLongs, 0, nSampleCount*sizeof(UInt64));
-
-            int m = 0;
-            UInt64 mask = 0x00000000000000FF;
-
-            for(UINT i=0; i<nSampleCount; i++)
-            {
-                // MSB
-                pUSignedLongLongs[i] = (unsigned char)WaveSample.pSampleData[m+7];
-                pUSignedLongLongs[i] <<= 56;
-
-                // NSB
-                UInt64 nsb = (UInt64)WaveSample.pSampleData[m+6];
-                // in case top of nsb is bad
-                nsb &= mask;
-                nsb <<= 48;
-                pUSignedLongLongs[i] |= nsb;
-
-                // NSB2
-                UInt64 nsb2 = (UInt64)WaveSample.pSampleData[m+5];
-                // in case top of nsb is bad
-                nsb2 &= mask;
-                nsb2 <<= 40;
-                pUSignedLongLongs[i] |= nsb2;
-
-                // NSB3
-                UInt64 nsb3 = (UInt64)WaveSample.pSampleData[m+4];
-                // in case top of nsb is bad
-                nsb3 &= mask;
-                nsb3 <<= 32;
-                pUSignedLongLongs[i] |= nsb3;
-
-                // NSB4
-                UInt64 nsb4 = (UInt64)WaveSample.pSampleData[m+3];
-                // in case top of nsb is bad
-                nsb4 &= mask;
-                nsb4 <<= 24;
-                pUSignedLongLongs[i] |= nsb4;
-
-                // NSB5
-                UInt64 nsb5 = (UInt64)WaveSample.pSampleData[m+2];
-                // in case top of nsb is bad
-                nsb5 &= mask;
-                nsb5 <<= 16;
-                pUSignedLongLongs[i] |= nsb5;
-
-                // NSB6
-                UInt64 nsb6 = (UInt64)WaveSample.pSampleData[m+1];
-                // in case top of nsb is bad
-                nsb6 &= mask;
-                nsb6 <<= 8;
-                pUSignedLongLongs[i] |= nsb6;
-
-                // LSB
-                UInt64 lsb = (UInt64)WaveSample.pSampleData[m];
-                // in case top of lsb is bad
-                lsb &= mask;
-                pUSignedLongLongs[i] |= lsb;
-
-                m+=8;
-            }
-
-            // Use the Union trick to re-use same memory location as two different data types
-            UWaveData wd;
-            for(UINT i = 0; i < nSampleCount; i++)
-            {
-                wd.u64 = pUSignedLongLongs[i];
-                m_pWaveBuffer[i] = (float)wd.d; // cast the union's double as a float to chop off bottom
-            }
-
-            delete [] pUSignedLongLongs;
-            // free(WaveSample.pSampleData);
-
-            bSampleLoaded = true;
-        }
-    }
-
-    // --- now find the loops, MIDI note info, etc... (smpl)
-    int dInc = 0;
-    do {
-        int position = inFile.tellg();
-		if(position < 0)
-			bFailed = true;
-		else
+	CWaveFileReader reader;
+	if(!reader.open(pFilePath))
+		return false;
+
+	// --- m_uSampleCount counts every channel's samples in a UINT
+	unsigned long long uSamples = reader.getFrameCount()*reader.getChannelCount();
+	if(uSamples > 0xFFFFFFFF)
+		return false;
+
+	float* pWaveBuffer = new(std::nothrow) float[(size_t)uSamples];
+	if(!pWaveBuffer)
+		return false;
+
+	// --- straight out of the mapping; in blocks when someone is watching
+	const unsigned char* pData = (const unsigned char*)reader.getData();
+	size_t uBlock = pProgress || pCancel ? WAVE_LOAD_BLOCK_SAMPLES : (size_t)uSamples;
+	for(size_t i = 0; i < (size_t)uSamples; i += uBlock)
+	{
+		if(pCancel && pCancel->load(std::memory_order_relaxed))
 		{
-			inFile.seekg(position + dInc);
-			bFailed = inFile.fail();
+			delete [] pWaveBuffer;
+			return false;
 		}
 
-        if(!bFailed)
-        {
-            // --- read chunk, looking for 'smpl'
-            inFile.read((char*)(&RiffChunk), sizeof(RiffChunk));
-            dInc = RiffChunk.dwLength;
-            memcpy(szIdentifier, RiffChunk.IdentifierString, 4);
-        }
-    } while(strcmp(szIdentifier, "smpl") && !bFailed) ;
-
-    // Found a smpl chunk
-    /* smpl CHUNK format
-     Offset	Size	Description			Value
-     0x00	4	Chunk ID			"smpl" (0x736D706C)
-     0x04	4	Chunk Data Size		36 + (Num Sample Loops * 24) + Sampler Data
-     0x08	4	Manufacturer		0 - 0xFFFFFFFF	<------ // SKIPPING THIS //
-     0x0C	4	Product				0 - 0xFFFFFFFF	<------ // SKIPPING THIS //
-     0x10	4	Sample Period		0 - 0xFFFFFFFF	<------ // SKIPPING THIS (already know it)//
-     0x14	4	MIDI Unity Note		0 - 127
-     0x18	4	MIDI Pitch Fraction	0 - 0xFFFFFFFF
-     0x1C	4	SMPTE Format		0, 24, 25, 29, 30
-     0x20	4	SMPTE Offset		0 - 0xFFFFFFFF
-     0x24	4	Num Sample Loops	0 - 0xFFFFFFFF
-     0x28	4	Sampler Data		0 - 0xFFFFFFFF
-     0x2C
-     List of Sample Loops ------------------ //
-
-     MIDI Unity Note
-     The MIDI unity note value has the same meaning as the instrument chunk's MIDI Unshifted Note field which
-     specifies the musical note at which the sample will be played at it's original sample rate
-     (the sample rate specified in the format chunk).
-
-     MIDI Pitch Fraction
-     The MIDI pitch fraction specifies the fraction of a semitone up from the specified MIDI unity note field.
-     A value of 0x80000000 means 1/2 semitone (50 cents) and a value of 0x00000000 means no fine tuning
-     between semitones.
-
-     SMPTE Format
-     The SMPTE format specifies the Society of Motion Pictures and Television E time format used in the
-     following SMPTE Offset field. If a value of 0 is set, SMPTE Offset should also be set to 0.
-     Value	SMPTE Format
-     0	no SMPTE offset
-     24	24 frames per second
-     25	25 frames per second
-     29	30 frames per second with frame dropping (30 drop)
-     30	30 frames per second
-
-     SMPTE Offset
-     The SMPTE Offset value specifies the time offset to be used for the synchronization / calibration
-     to the first sample in the waveform. This value uses a format of 0xhhmmssff where hh is a signed value
-     that specifies the number of hours (-23 to 23), mm is an unsigned value that specifies the
-     number of minutes (0 to 59), ss is an unsigned value that specifies the number of seconds
-     (0 to 59) and ff is an unsigned value that specifies the number of frames (0 to -1).
-
-     // Sample Loop Data Struct
-     Offset	Size	Description		Value
-     0x00	4	Cue Point ID	0 - 0xFFFFFFFF
-     0x04	4	Type			0 - 0xFFFFFFFF
-     0x08	4	Start			0 - 0xFFFFFFFF
-     0x0C	4	End				0 - 0xFFFFFFFF
-     0x10	4	Fraction		0 - 0xFFFFFFFF
-     0x14	4	Play Count		0 - 0xFFFFFFFF
-
-     Loop type:
-     Value	Loop Type
-     0	Loop forward (normal)
-     1	Alternating loop (forward/backward, also known as Ping Pong)
-     2	Loop backward (reverse)
-     3 - 31	Reserved for future standard types
-     32 - 0xFFFFFFFF	Sampler specific types (defined by manufacturer)*/
-
-
-    // skipping some stuff; could add later
-    if(!bFailed)
-    {
-        dInc = 12; // 3 don't cares 4 bytes each
-        m_uLoopType = 0;
-        m_uLoopCount = 0;
-        m_uLoopStartIndex = 0;
-        m_uLoopEndIndex = 0;
-        m_uMIDINote = 0;
-        m_uMIDIPitchFraction = 0;
-        m_uSMPTEFormat = 0;
-        m_uSMPTEOffset = 0;
-
-        // found a loop set; currently only taking the FIRST loop set
-        // only need one loop set for potentially sustaining waves
-        int position = inFile.tellg();
-        inFile.seekg(position + dInc);
-
-        // --- MIDI Note Number
-        inFile.read((char*)(&m_uMIDINote), 4);
-
-        // --- m_uMIDIPitchFraction
-        inFile.read((char*)(&m_uMIDIPitchFraction), 4);
-
-        // --- m_uSMPTEFormat
-        inFile.read((char*)(&m_uSMPTEFormat), 4);
-
-        // --- m_uSMPTEOffset
-        inFile.read((char*)(&m_uSMPTEOffset), 4);
-
-        // --- MIDI Note Number
-        inFile.read((char*)(&m_uLoopCount), 4);
-
-        // --- skip cuepoint & sampledata
-        position = inFile.tellg();
-        inFile.seekg(position + 8);
-
-        // --- m_uLoopType
-        inFile.read((char*)(&m_uLoopType), 4);
-
-        // --- loop start sample
-        inFile.read((char*)(&m_uLoopStartIndex), 4);
-        m_uLoopStartIndex *= m_uNumChannels;
-
-        // --- loop end sample
-        inFile.read((char*)(&m_uLoopEndIndex), 4);
-        m_uLoopEndIndex *= m_uNumChannels;
-    }
-    else  // no loops
-    {
-        m_uLoopType = 0;
-        m_uLoopCount = 0;
-        m_uLoopStartIndex = 0;
-        m_uLoopEndIndex = 0;
-        m_uMIDINote = 0;
-        m_uMIDIPitchFraction = 0;
-        m_uSMPTEFormat = 0;
-        m_uSMPTEOffset = 0;
-    }
-
-    // --- close the file
-    inFile.close();
-
-    // --- hope we got one loaded!
-    return bSampleLoaded;
-}
-#endif
+		size_t uCount = (size_t)uSamples - i < uBlock ? (size_t)uSamples - i : uBlock;
+		CWaveFileReader::convert(&pData[i*reader.getBytesPerSample()], reader.getFormat(), &pWaveBuffer[i], uCount);
 
+		if(pProgress)
+			pProgress->store((UINT)((unsigned long long)(i + uCount)*WAVE_LOAD_PROGRESS_MAX/uSamples), std::memory_order_relaxed);
+	}
 
-// UI CONTROL CLASS -- DO NOT DELETE
-CUICtrl::CUICtrl(void)
-{
-	m_pUserCookedIntData = NULL;
-	m_pUserCookedFloatData = NULL;
-	m_pUserCookedDoubleData = NULL;
-	m_pUserCookedUINTData = NULL;
-	m_pCurrentMeterValue = NULL;
+	if(m_pWaveBuffer)
+		delete [] m_pWaveBuffer;
+	m_pWaveBuffer = pWaveBuffer;
 
-	cControlName = &cName[0];
-	cControlUnits = &cUnits[0];
-	cVariableName = &cVName[0];
-	cEnumeratedList = &cVEnumeratedList[0];
-	cMeterVariableName = &cMeterVName[0];
-	uUserDataType = nonData;
+	m_uNumChannels = reader.getChannelCount();
+	m_uSampleRate = reader.getSampleRate();
+	m_uSampleCount = (UINT)uSamples;
 
-	memset(&cName[0], 0, 1024*sizeof(BYTE));
-	memset(&cVName[0], 0, 1024*sizeof(BYTE));
-	memset(&cMeterVName[0], 0, 1024*sizeof(BYTE));
-	memset(&cUnits[0], 0, 1024*sizeof(BYTE));
-	memset(&cEnumeratedList[0], 0, 1024*sizeof(BYTE));
+	// --- loops, MIDI note info, etc... (smpl); the indices count every channel
+	m_uLoopType = 0;
+	m_uLoopCount = 0;
+	m_uLoopStartIndex = 0;
+	m_uLoopEndIndex = 0;
+	m_uMIDINote = 0;
+	m_uMIDIPitchFraction = 0;
+	m_uSMPTEFormat = 0;
+	m_uSMPTEOffset = 0;
 
-	memset(&dPresetData[0], 0, PRESET_COUNT*sizeof(double));
+	const waveSamplerInfo* pInfo = reader.getSamplerInfo();
+	if(pInfo)
+	{
+		m_uMIDINote = pInfo->uMIDINote;
+		m_uMIDIPitchFraction = pInfo->uMIDIPitchFraction;
+		m_uSMPTEFormat = pInfo->uSMPTEFormat;
+		m_uSMPTEOffset = pInfo->uSMPTEOffset;
+		m_uLoopCount = pInfo->uLoopCount;
+		m_uLoopType = pInfo->uLoopType;
+		m_uLoopStartIndex = pInfo->uLoopStart*m_uNumChannels;
+		m_uLoopEndIndex = pInfo->uLoopEnd*m_uNumChannels;
+	}
 
-	bOwnerControl = false;
-	bUseMeter = false;
-	bLogMeter = false;
-	bUpsideDownMeter = false;
-	uMeterColorScheme = csVU;
-	fMeterAttack_ms = 10.0;
-	fMeterRelease_ms = 500.0;
+	return true;
+}
 
-	bLogSlider = false;
-	bExpSlider = false;
+// CWaveDataLoader Implementation ----------------------------------------------------------------
+//
+CWaveDataLoader::CWaveDataLoader(void)
+{
+	m_pCurrent.store(NULL);
+	m_pInUse.store(NULL);
+	m_bCancel.store(false);
+	m_uState.store(WAVE_LOAD_IDLE);
+	m_uProgress.store(0);
+}
 
-	uDetectorMode = DETECT_MODE_RMS;
-	nGUIRow					= -1;
-	nGUIColumn				= -1;
-	pvAddlData				= NULL;
-	memset(&uControlTheme[0], 0, CONTROL_THEME_SIZE*sizeof(UINT));
-	memset(&uFluxCapControl[0], 0, PLUGIN_CONTROL_THEME_SIZE*sizeof(UINT));
-	memset(&fFluxCapData[0], 0, PLUGIN_CONTROL_THEME_SIZE*sizeof(float));
+CWaveDataLoader::~CWaveDataLoader(void)
+{
+	stopWorker();
 
-	bMIDIControl			= false;
-	uMIDIControlCommand		= 0xB0; // CC
-	uMIDIControlName		= 0x03; // default CC #3
-	uMIDIControlChannel		= 0;
+	// --- nobody is playing any more
+	m_pInUse.store(NULL);
+	unload();
+	collectGarbage();
 }
 
-CUICtrl::CUICtrl(const CUICtrl& initCUICtrl)
+void CWaveDataLoader::stopWorker()
 {
-	cControlName = &cName[0];
-	cControlUnits = &cUnits[0];
-	cVariableName = &cVName[0];
-	cEnumeratedList = &cVEnumeratedList[0];
-	cMeterVariableName = &cMeterVName[0];
-
-	uControlType				= initCUICtrl.uControlType;
-	uControlId				= initCUICtrl.uControlId;
-	bOwnerControl			= initCUICtrl.bOwnerControl;
-	bUseMeter			= initCUICtrl.bUseMeter;
-	bLogMeter			= initCUICtrl.bLogMeter;
-	bUpsideDownMeter			= initCUICtrl.bUpsideDownMeter;
-	uDetectorMode			= initCUICtrl.uDetectorMode;
-	bLogSlider			= initCUICtrl.bLogSlider;
-	bExpSlider			= initCUICtrl.bExpSlider;
+	if(m_Worker.joinable())
+	{
+		m_bCancel.store(true);
+		m_Worker.join();
+	}
+	m_bCancel.store(false);
+}
 
-	uMeterColorScheme			= initCUICtrl.uMeterColorScheme;
-	fMeterAttack_ms			= initCUICtrl.fMeterAttack_ms;
-	fMeterRelease_ms			= initCUICtrl.fMeterRelease_ms;
+void CWaveDataLoader::load(const char* pFilePath)
+{
+	stopWorker();
+	collectGarbage();
 
-	fUserDisplayDataLoLimit				= initCUICtrl.fUserDisplayDataLoLimit;
-	fUserDisplayDataHiLimit				= initCUICtrl.fUserDisplayDataHiLimit;
+	m_uProgress.store(0, std::memory_order_relaxed);
+	if(!pFilePath)
+	{
+		m_uState.store(WAVE_LOAD_FAILED, std::memory_order_release);
+		return;
+	}
 
-	uUserDataType				= initCUICtrl.uUserDataType;
-	fInitUserIntValue				= initCUICtrl.fInitUserIntValue;
-	fInitUserFloatValue				= initCUICtrl.fInitUserFloatValue;
-	fInitUserDoubleValue				= initCUICtrl.fInitUserDoubleValue;
-	fInitUserUINTValue				= initCUICtrl.fInitUserUINTValue;
+	m_uState.store(WAVE_LOAD_LOADING, std::memory_order_release);
+	m_Worker = std::thread(&CWaveDataLoader::loadWorker, this, std::string(pFilePath));
+}
 
-	// VST PRESETS
-	fUserCookedIntData				= initCUICtrl.fUserCookedIntData;
-	fUserCookedFloatData				= initCUICtrl.fInitUserFloatValue;
-	fUserCookedDoubleData				= initCUICtrl.fUserCookedDoubleData;
-	fUserCookedUINTData				= initCUICtrl.fUserCookedUINTData;
+void CWaveDataLoader::cancel()
+{
+	stopWorker();
 
-	m_pUserCookedIntData				= initCUICtrl.m_pUserCookedIntData;
-	m_pUserCookedFloatData				= initCUICtrl.m_pUserCookedFloatData;
-	m_pUserCookedDoubleData				= initCUICtrl.m_pUserCookedDoubleData;
-	m_pUserCookedUINTData				= initCUICtrl.m_pUserCookedUINTData;
-	m_pCurrentMeterValue				= initCUICtrl.m_pCurrentMeterValue;
+	// --- a load that finished before it saw the flag stays published
+	UINT uLoading = WAVE_LOAD_LOADING;
+	m_uState.compare_exchange_strong(uLoading, WAVE_LOAD_IDLE, std::memory_order_acq_rel);
+}
 
-	bMIDIControl				= initCUICtrl.bMIDIControl;
-	uMIDIControlCommand			= initCUICtrl.uMIDIControlCommand;
-	uMIDIControlName			= initCUICtrl.uMIDIControlName;
-	uMIDIControlChannel = initCUICtrl.uMIDIControlChannel;
+void CWaveDataLoader::unload()
+{
+	cancel();
+	publish(NULL);
+	m_uState.store(WAVE_LOAD_IDLE, std::memory_order_release);
+}
 
-	nGUIRow					= initCUICtrl.nGUIRow;
-	nGUIColumn				= initCUICtrl.nGUIColumn;
-	pvAddlData				= initCUICtrl.pvAddlData;
-	for(int i=0; i<PRESET_COUNT; i++)
+// --- worker
+void CWaveDataLoader::loadWorker(std::string filePath)
+{
+	CWaveData* pWave = new(std::nothrow) CWaveData;
+	if(pWave && pWave->readWaveFile(&filePath[0], &m_uProgress, &m_bCancel))
 	{
-		dPresetData[i] = initCUICtrl.dPresetData[i];
+		pWave->m_bWaveLoaded = true;
+		publish(pWave);
+		m_uState.store(WAVE_LOAD_READY, std::memory_order_release);
+		collectGarbage();
+		return;
 	}
 
-	for(int i=0; i<CONTROL_THEME_SIZE; i++)
+	delete pWave;
+	if(!m_bCancel.load())
+		m_uState.store(WAVE_LOAD_FAILED, std::memory_order_release);
+}
+
+// --- the swap the audio thread sees; the old wave waits in m_Retired
+void CWaveDataLoader::publish(CWaveData* pWave)
+{
+	CWaveData* pOld = m_pCurrent.exchange(pWave);
+	if(pOld)
 	{
-		uControlTheme[i] = initCUICtrl.uControlTheme[i];
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Retired.push_back(pOld);
 	}
+}
+
+// --- a retired wave the hazard pointer does not name cannot be picked up
+//     again: acquire() re-reads m_pCurrent after announcing, and it has moved on
+void CWaveDataLoader::collectGarbage()
+{
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	CWaveData* pInUse = m_pInUse.load();
 
-	for(int i=0; i<PLUGIN_CONTROL_THEME_SIZE; i++)
+	UINT uKept = 0;
+	for(UINT i = 0; i < m_Retired.size(); i++)
 	{
-		uFluxCapControl[i] = initCUICtrl.uFluxCapControl[i];
+		if(m_Retired[i] == pInUse)
+			m_Retired[uKept++] = m_Retired[i];
+		else
+			delete m_Retired[i];
 	}
+	m_Retired.resize(uKept);
+}
 
-	for(int i=0; i<PLUGIN_CONTROL_THEME_SIZE; i++)
+// --- announce, then make sure it is still the current one; a retry only
+//     happens when a publish landed in between
+CWaveData* CWaveDataLoader::acquire()
+{
+	CWaveData* pWave = m_pCurrent.load();
+	while(true)
 	{
-		fFluxCapData[i] = initCUICtrl.fFluxCapData[i];
+		m_pInUse.store(pWave);
+		CWaveData* pCurrent = m_pCurrent.load();
+		if(pCurrent == pWave)
+			return pWave;
+		pWave = pCurrent;
 	}
+}
 
-    strncpy(cControlName, initCUICtrl.cControlName, 1023);
-    cControlName[1023] = '\0';
+// UI CONTROL CLASS -- DO NOT DELETE
 
-    strncpy(cControlUnits, initCUICtrl.cControlUnits, 1023);
-    cControlUnits[1023] = '\0';
+static CUICtrlInfo makeDefaultUICtrlInfo()
+{
+	// --- same defaults the monolithic CUICtrl used to construct with
+	CUICtrlInfo info = CUICtrlInfo();
+	info.uUserDataType = nonData;
+	info.uMeterColorScheme = csVU;
+	info.fMeterAttack_ms = 10.0;
+	info.fMeterRelease_ms = 500.0;
+	info.uDetectorMode = DETECT_MODE_RMS;
+	info.nGUIRow = -1;
+	info.nGUIColumn = -1;
+	info.uMIDIControlCommand = 0xB0; // CC
+	info.uMIDIControlName = 0x03; // default CC #3
+
+	return info;
+}
 
-    strncpy(cVariableName, initCUICtrl.cVariableName, 1023);
-    cVariableName[1023] = '\0';
+const CUICtrlInfo* CUICtrlInfo::getDefault()
+{
+	static const CUICtrlInfo defaultInfo = makeDefaultUICtrlInfo();
+	return &defaultInfo;
+}
 
-	strncpy(cEnumeratedList, initCUICtrl.cEnumeratedList, 1023);
-	cEnumeratedList[1023] = '\0';
+CUICtrl::CUICtrl(void)
+{
+	m_pUserCookedIntData = NULL;
+	m_pUserCookedFloatData = NULL;
+	m_pUserCookedDoubleData = NULL;
+	m_pUserCookedUINTData = NULL;
+	m_pCurrentMeterValue = NULL;
+	pvAddlData = NULL;
 
-	strncpy(cMeterVariableName, initCUICtrl.cMeterVariableName, 1023);
-	cMeterVariableName[1023] = '\0';
+	setInfo(CUICtrlInfo::getDefault());
 }
 
-CUICtrl::~CUICtrl(void)
+CUICtrl::CUICtrl(const CUICtrlInfo* pCtrlInfo)
 {
+	m_pUserCookedIntData = NULL;
+	m_pUserCookedFloatData = NULL;
+	m_pUserCookedDoubleData = NULL;
+	m_pUserCookedUINTData = NULL;
+	m_pCurrentMeterValue = NULL;
+	pvAddlData = NULL;
+
+	setInfo(pCtrlInfo);
+}
 
+void CUICtrl::setInfo(const CUICtrlInfo* pCtrlInfo)
+{
+	pInfo = pCtrlInfo;
+
+	uControlType = pInfo->uControlType;
+	uControlId = pInfo->uControlId;
+	uUserDataType = pInfo->uUserDataType;
+	fUserDisplayDataLoLimit = pInfo->fUserDisplayDataLoLimit;
+	fUserDisplayDataHiLimit = pInfo->fUserDisplayDataHiLimit;
+	bLogSlider = pInfo->bLogSlider;
+	bExpSlider = pInfo->bExpSlider;
 }
+
 CUIControlList::CUIControlList()
 {
-     p=NULL;
+	m_pBuffer = NULL;
+	m_pControls = NULL;
+	m_nCount = 0;
+	m_nCapacity = 0;
+	memset(&name[0], 0, (uMaxVSTProgramNameLen+1)*sizeof(char));
 }
 
+void CUIControlList::grow(int nCapacity)
+{
+	if(nCapacity <= m_nCapacity)
+		return;
+
+	// --- over-allocate by one line and align by hand; plain new[] only
+	//     guarantees 8 or 16 bytes
+	char* pBuffer = new char[nCapacity*CONTROL_STRIDE + CACHE_LINE_SIZE];
+	char* pControls = (char*)(((size_t)pBuffer + CACHE_LINE_SIZE - 1) & ~((size_t)CACHE_LINE_SIZE - 1));
+
+	if(m_nCount > 0)
+		memcpy(pControls, m_pControls, m_nCount*CONTROL_STRIDE);
+
+	delete [] m_pBuffer;
+	m_pBuffer = pBuffer;
+	m_pControls = pControls;
+	m_nCapacity = nCapacity;
+}
 
 CUICtrl* CUIControlList::getAt(int nIndex)
 {
-	node *q;
-	int c=0;
-	for( q=p ; q != NULL ; q = q->link )
-	{
-		if(c == nIndex)
-			return &q->data;
+	if(nIndex < 0 || nIndex >= m_nCount)
+		return NULL;
 
-		c++;
-	}
+	return slot(nIndex);
+}
 
-	return NULL;
+void CUIControlList::append(CUICtrl num)
+{
+	addafter(m_nCount - 1, num);
+}
 
+void CUIControlList::append(const CUICtrlInfo* pCtrlInfo, int* pVariable)
+{
+	CUICtrl ctrl(pCtrlInfo);
+	ctrl.m_pUserCookedIntData = pVariable;
+	append(ctrl);
 }
 
-void CUIControlList::append(CUICtrl num)
+void CUIControlList::append(const CUICtrlInfo* pCtrlInfo, float* pVariable)
 {
-     node *q,*t;
+	CUICtrl ctrl(pCtrlInfo);
+	if(pCtrlInfo->uControlType == FILTER_CONTROL_LED_METER)
+		ctrl.m_pCurrentMeterValue = pVariable;
+	else
+		ctrl.m_pUserCookedFloatData = pVariable;
+	append(ctrl);
+}
 
-   if( p == NULL )
-   {
-        p = new node;
-      p->data = num;
-      p->link = NULL;
-   }
-   else
-   {
-        q = p;
-      while( q->link != NULL )
-           q = q->link;
+void CUIControlList::append(const CUICtrlInfo* pCtrlInfo, double* pVariable)
+{
+	CUICtrl ctrl(pCtrlInfo);
+	ctrl.m_pUserCookedDoubleData = pVariable;
+	append(ctrl);
+}
 
-      t = new node;
-      t->data = num;
-      t->link = NULL;
-      q->link = t;
-   }
+void CUIControlList::append(const CUICtrlInfo* pCtrlInfo, UINT* pVariable)
+{
+	CUICtrl ctrl(pCtrlInfo);
+	ctrl.m_pUserCookedUINTData = pVariable;
+	append(ctrl);
 }
 
 void CUIControlList::add_as_first(CUICtrl num)
 {
-     node *q;
-
-   q = new node;
-   q->data = num;
-   q->link = p;
-   p = q;
+	addafter(-1, num);
 }
 
+// --- inserts after index c; c = -1 inserts at the front
 void CUIControlList::addafter( int c, CUICtrl num)
 {
-     node *q,*t;
-   int i;
-   for(i=0,q=p;i<c;i++)
-   {
-        q = q->link;
-      if( q == NULL )
-      {
-           //cout<<"\nThere are less than "<<c<<" elements.";
-         return;
-      }
-   }
+	if(c < -1 || c >= m_nCount)
+	{
+		//cout<<"\nThere are less than "<<c<<" elements.";
+		return;
+	}
+
+	if(m_nCount == m_nCapacity)
+		grow(m_nCapacity < 8 ? 8 : 2*m_nCapacity);
+
+	int nInsert = c + 1;
+	if(nInsert < m_nCount)
+		memmove(slot(nInsert + 1), slot(nInsert), (m_nCount - nInsert)*CONTROL_STRIDE);
 
-   t = new node;
-   t->data = num;
-   t->link = q->link;
-   q->link = t;
+	new (slot(nInsert)) CUICtrl(num);
+	m_nCount++;
 }
 
 void CUIControlList::update( CUICtrl num )
 {
-     node *q,*r;
-   q = p;
-   if( q->data.uControlId == num.uControlId )
-   {
-	   q->data = num;
-      return;
-   }
-
-   r = q;
-   while( q!=NULL )
-   {
-      if( q->data.uControlId == num.uControlId )
-      {
-		   q->data = num;
-		  return;
-      }
-	  r = q;
-	  q = q->link;
-    }
-
+	for(int i=0; i<m_nCount; i++)
+	{
+		if(slot(i)->uControlId == num.uControlId)
+		{
+			*slot(i) = num;
+			return;
+		}
+	}
 
    //cout<<"\nElement "<<num<<" not Found.";
 }
 void CUIControlList::del( CUICtrl num )
 {
-     node *q,*r;
-   q = p;
-   if( q->data.uControlId == num.uControlId )
-   {
-        p = q->link;
-      delete q;
-      return;
-   }
-
-   r = q;
-   while( q!=NULL )
-   {
-        if( q->data.uControlId == num.uControlId )
-      {
-           r->link = q->link;
-         delete q;
-         return;
-      }
-
-      r = q;
-      q = q->link;
-   }
+	for(int i=0; i<m_nCount; i++)
+	{
+		if(slot(i)->uControlId == num.uControlId)
+		{
+			if(i < m_nCount - 1)
+				memmove(slot(i), slot(i + 1), (m_nCount - i - 1)*CONTROL_STRIDE);
+
+			m_nCount--;
+			return;
+		}
+	}
    //cout<<"\nElement "<<num<<" not Found.";
 }
 
@@ -2265,58 +3732,47 @@ void CUIControlList::display()
 }
 int CUIControlList::countLegalVSTIF()
 {
-     node *q;
-   int c=0;
-   for( q=p ; q != NULL ; q = q->link )
-   {
-	   if(q->data.uControlType == FILTER_CONTROL_CONTINUOUSLY_VARIABLE ||
-		   q->data.uControlType == FILTER_CONTROL_RADIO_SWITCH_VARIABLE)
-	   {
+	int c=0;
+	for(int i=0; i<m_nCount; i++)
+	{
+		if(slot(i)->uControlType == FILTER_CONTROL_CONTINUOUSLY_VARIABLE ||
+		   slot(i)->uControlType == FILTER_CONTROL_RADIO_SWITCH_VARIABLE)
+		{
 			c++;
-	   }
-   }
-   return c;
+		}
+	}
+	return c;
 }
 
 int CUIControlList::countLegalCustomVSTGUI()
 {
-     node *q;
-   int c=0;
-   for( q=p ; q != NULL ; q = q->link )
-   {
-		if(q->data.uControlType == FILTER_CONTROL_CONTINUOUSLY_VARIABLE)
+	int c=0;
+	for(int i=0; i<m_nCount; i++)
+	{
+		if(slot(i)->uControlType == FILTER_CONTROL_CONTINUOUSLY_VARIABLE)
 		{
 			 c++;
 		}
-		if(q->data.uControlType == FILTER_CONTROL_RADIO_SWITCH_VARIABLE)
+		if(slot(i)->uControlType == FILTER_CONTROL_RADIO_SWITCH_VARIABLE)
 		{
 				c++;
 		}
-   }
+	}
 
-   return c;
+	return c;
 }
 
 int CUIControlList::count()
 {
-     node *q;
-   int c=0;
-   for( q=p ; q != NULL ; q = q->link )
-        c++;
-
-   return c;
+	return m_nCount;
 }
 
 CUIControlList::~CUIControlList()
 {
-    node *q;
-   if( p == NULL )
-        return;
-
-   while( p != NULL )
-   {
-        q = p->link;
-      delete p;
-      p = q;
-   }
+	// --- controls are plain data; the shared CUICtrlInfo pool is not ours
+	delete [] m_pBuffer;
+	m_pBuffer = NULL;
+	m_pControls = NULL;
+	m_nCount = 0;
+	m_nCapacity = 0;
 }
\ No newline at end of file
@@ -0,0 +1,183 @@
+/*
+	BiQuadBankBench.cpp
+
+	Throughput of CBiQuadBank against the same filters run as separate CBiQuad
+	objects, for a console-style workload: one B2 HPF per mono channel, every
+	channel with its own cutoff.
+
+	For each channel count it checks that all three paths produce the same
+	output, then reports per channel: ns per sample and the realtime multiple
+	(how many times faster than realtime one channel's share of the work runs).
+
+		CBiQuad      one object per channel, doBiQuad() per sample
+		bank         CBiQuadBank::process(), one buffer per channel
+		interleaved  CBiQuadBank::processInterleaved(), frame-major buffer
+
+	Build (Linux/macOS, from this folder; drop -mavx for the SSE path):
+		g++ -std=c++11 -O2 -mavx -D__stdcall= -I../source BiQuadBankBench.cpp \
+			../source/pluginobjects.cpp -o BiQuadBankBench
+
+	Usage:
+		BiQuadBankBench [-n 8,16,64,128] [-b buffer frames] [-s seconds] [-fs 48000]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "pluginconstants.h"
+#include "filtercoeffs.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+static std::vector<UINT> parseList(const char* psz)
+{
+	std::vector<UINT> list;
+	while(*psz)
+	{
+		list.push_back((UINT)atoi(psz));
+		const char* pComma = strchr(psz, ',');
+		if(!pComma)
+			break;
+		psz = pComma + 1;
+	}
+	return list;
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<UINT> channelCounts = parseList("8,16,64,128");
+	UINT uBufferSize = 512;
+	double dSeconds = 2.0;
+	float fSampleRate = 48000.0f;
+
+	for(int i = 1; i < argc - 1; i++)
+	{
+		if(strcmp(argv[i], "-n") == 0)
+			channelCounts = parseList(argv[++i]);
+		else if(strcmp(argv[i], "-b") == 0)
+			uBufferSize = (UINT)atoi(argv[++i]);
+		else if(strcmp(argv[i], "-s") == 0)
+			dSeconds = atof(argv[++i]);
+		else if(strcmp(argv[i], "-fs") == 0)
+			fSampleRate = (float)atof(argv[++i]);
+	}
+
+#if defined(__AVX__)
+	printf("CBiQuadBank lanes: AVX\n");
+#else
+	printf("CBiQuadBank lanes: SSE/scalar\n");
+#endif
+	printf("%u frame buffers at %.0f Hz, %.1f s of audio per point\n\n", uBufferSize, fSampleRate, dSeconds);
+	printf("%9s  %22s  %22s  %22s  %10s\n", "channels", "CBiQuad ns/smp (xRT)", "bank ns/smp (xRT)", "interleaved ns/smp (xRT)", "max diff");
+
+	for(size_t c = 0; c < channelCounts.size(); c++)
+	{
+		UINT N = channelCounts[c];
+		if(N == 0)
+			continue;
+
+		// --- one cutoff per channel, 20..200 Hz
+		std::vector<float> cutoffs(N);
+		for(UINT ch = 0; ch < N; ch++)
+			cutoffs[ch] = 20.0f + 180.0f*(float)ch/(float)N;
+
+		std::vector<float> coeffStore(5*N);
+		biquadCoeffArrays coeffs = {&coeffStore[0], &coeffStore[N], &coeffStore[2*N], &coeffStore[3*N], &coeffStore[4*N]};
+		calculateB2HPFCoeffsBatch(&cutoffs[0], N, fSampleRate, coeffs);
+
+		std::vector<CBiQuad> filters(N);
+		for(UINT ch = 0; ch < N; ch++)
+		{
+			filters[ch].m_f_a0 = coeffs.pA0[ch];
+			filters[ch].m_f_a1 = coeffs.pA1[ch];
+			filters[ch].m_f_a2 = coeffs.pA2[ch];
+			filters[ch].m_f_b1 = coeffs.pB1[ch];
+			filters[ch].m_f_b2 = coeffs.pB2[ch];
+			filters[ch].flushDelays();
+		}
+
+		CBiQuadBank bank;
+		bank.init(N);
+		bank.setHPFCutoffs(&cutoffs[0], fSampleRate);
+
+		CBiQuadBank bankInterleaved;
+		bankInterleaved.init(N);
+		bankInterleaved.setHPFCutoffs(&cutoffs[0], fSampleRate);
+
+		// --- noise input, per channel and frame-major copies
+		std::vector<float> input(N*uBufferSize), output(N*uBufferSize), outputBank(N*uBufferSize);
+		std::vector<float> inputInterleaved(N*uBufferSize), outputInterleaved(N*uBufferSize);
+		std::vector<float*> ppInput(N), ppOutput(N);
+		srand(1);
+		for(UINT ch = 0; ch < N; ch++)
+		{
+			ppInput[ch] = &input[ch*uBufferSize];
+			ppOutput[ch] = &outputBank[ch*uBufferSize];
+			for(UINT n = 0; n < uBufferSize; n++)
+			{
+				float x = (float)rand()/(float)RAND_MAX - 0.5f;
+				input[ch*uBufferSize + n] = x;
+				inputInterleaved[n*N + ch] = x;
+			}
+		}
+
+		// --- correctness, first buffer
+		for(UINT ch = 0; ch < N; ch++)
+			for(UINT n = 0; n < uBufferSize; n++)
+				output[ch*uBufferSize + n] = filters[ch].doBiQuad(input[ch*uBufferSize + n]);
+		bank.process(&ppInput[0], &ppOutput[0], uBufferSize);
+		bankInterleaved.processInterleaved(&inputInterleaved[0], &outputInterleaved[0], uBufferSize);
+
+		double dMaxDiff = 0.0;
+		for(UINT ch = 0; ch < N; ch++)
+		{
+			for(UINT n = 0; n < uBufferSize; n++)
+			{
+				double d1 = fabs(output[ch*uBufferSize + n] - outputBank[ch*uBufferSize + n]);
+				double d2 = fabs(output[ch*uBufferSize + n] - outputInterleaved[n*N + ch]);
+				dMaxDiff = d1 > dMaxDiff ? d1 : dMaxDiff;
+				dMaxDiff = d2 > dMaxDiff ? d2 : dMaxDiff;
+			}
+		}
+
+		// --- timing
+		UINT uBuffers = (UINT)(dSeconds*fSampleRate/uBufferSize) + 1;
+		double dNs[3];
+		for(UINT m = 0; m < 3; m++)
+		{
+			benchClock::time_point start = benchClock::now();
+			for(UINT b = 0; b < uBuffers; b++)
+			{
+				if(m == 0)
+				{
+					for(UINT ch = 0; ch < N; ch++)
+					{
+						CBiQuad& filter = filters[ch];
+						const float* pIn = &input[ch*uBufferSize];
+						float* pOut = &output[ch*uBufferSize];
+						for(UINT n = 0; n < uBufferSize; n++)
+							pOut[n] = filter.doBiQuad(pIn[n]);
+					}
+				}
+				else if(m == 1)
+					bank.process(&ppInput[0], &ppOutput[0], uBufferSize);
+				else
+					bankInterleaved.processInterleaved(&inputInterleaved[0], &outputInterleaved[0], uBufferSize);
+			}
+			double dElapsed = std::chrono::duration<double>(benchClock::now() - start).count();
+			dNs[m] = dElapsed*1.0e9/((double)uBuffers*uBufferSize*N);
+		}
+
+		// --- realtime multiple per channel: 1 s of one channel / time spent on it
+		char szCol[3][64];
+		for(UINT m = 0; m < 3; m++)
+			sprintf(szCol[m], "%.2f (%.0fx)", dNs[m], 1.0e9/(dNs[m]*fSampleRate));
+
+		printf("%9u  %22s  %22s  %22s  %10.2g\n", N, szCol[0], szCol[1], szCol[2], dMaxDiff);
+	}
+
+	return 0;
+}
@@ -0,0 +1,309 @@
+/*
+	FilterCoeffsBench.cpp
+
+	Accuracy and speed check for the fast coefficient math in filtercoeffs.h.
+
+	1) Sweeps fastTan/fastSin/fastCos/fastPow10 against double precision libm
+	   over the ranges the coefficient calculators use (and well beyond) and
+	   reports the worst case error, so the bounds quoted in filtercoeffs.h can
+	   be re-checked after any change.
+	2) Runs every batch calculator over a log sweep of cutoffs (10 Hz .. 0.45 fs)
+	   at 44.1k/96k/192k and reports the worst absolute coefficient error against
+	   the same formulas evaluated in double with libm.
+	3) Times the batch calculators against the same formulas written with the
+	   float libm calls (tanf/cosf/powf) in ns per coefficient set.
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source FilterCoeffsBench.cpp -o FilterCoeffsBench
+
+	Usage:
+		FilterCoeffsBench [-n cutoffs per batch] [-r repetitions]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "filtercoeffs.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+// --- keeps the optimizer from discarding the timed loops
+static volatile float g_fSink = 0.0f;
+
+// --- points where |ref| > dPoleLimit are skipped: near a pole of tan() the float input and
+//     the reduced argument carry a relative error that grows with |tan|
+static double maxError(double (*pRef)(double), float (*pFast)(float), double dLo, double dHi, UINT uSteps, bool bRelative, double dPoleLimit = 1.0e30)
+{
+	double dMax = 0.0;
+	for(UINT i = 0; i <= uSteps; i++)
+	{
+		float x = (float)(dLo + (dHi - dLo)*(double)i/(double)uSteps);
+		double ref = pRef((double)x);
+		double err = fabs((double)pFast(x) - ref);
+		if(bRelative)
+		{
+			if(fabs(ref) > dPoleLimit)
+				continue;
+			err /= fabs(ref) > 1.0e-3 ? fabs(ref) : 1.0e-3;
+		}
+		dMax = err > dMax ? err : dMax;
+	}
+	return dMax;
+}
+
+static double pow10d(double x){return pow(10.0, x);}
+
+// --- double precision reference formulas, same terms as CResonantLPF
+enum{B2LPF, B2HPF, B2BPF, B2BSF, CONSTQ, PARAMETRIC, NUM_TYPES};
+static const char* g_szTypeNames[NUM_TYPES] = {"B2LPF", "B2HPF", "B2BPF", "B2BSF", "ConstQ", "Parametric"};
+
+static void referenceCoeffs(UINT uType, double fc, double Q, double dB, double fs, double* c)
+{
+	double theta = pi*fc/fs;
+	switch(uType)
+	{
+		case B2LPF:
+		{
+			double C = 1.0/tan(theta);
+			double a0 = 1.0/(1.0 + sqrt(2.0)*C + C*C);
+			c[0] = a0; c[1] = 2.0*a0; c[2] = a0; c[3] = 2.0*a0*(1.0 - C*C); c[4] = a0*(1.0 - sqrt(2.0)*C + C*C);
+			break;
+		}
+		case B2HPF:
+		{
+			double C = tan(theta);
+			double a0 = 1.0/(1.0 + sqrt(2.0)*C + C*C);
+			c[0] = a0; c[1] = -2.0*a0; c[2] = a0; c[3] = 2.0*a0*(C*C - 1.0); c[4] = a0*(1.0 - sqrt(2.0)*C + C*C);
+			break;
+		}
+		case B2BPF:
+		case B2BSF:
+		{
+			double BW = fc/Q;
+			double C = tan(pi*fc*BW/fs);
+			double D = 2.0*cos(2.0*theta);
+			if(uType == B2BPF)
+			{
+				C = 1.0/C;
+				double a0 = 1.0/(1.0 + C);
+				c[0] = a0; c[1] = 0.0; c[2] = -a0; c[3] = -a0*C*D; c[4] = a0*(C - 1.0);
+			}
+			else
+			{
+				double a0 = 1.0/(1.0 + C);
+				c[0] = a0; c[1] = -a0*D; c[2] = a0; c[3] = -a0*D; c[4] = a0*(1.0 - C);
+			}
+			break;
+		}
+		case CONSTQ:
+		{
+			double K = tan(theta);
+			double Vo = pow(10.0, dB/20.0);
+			double d0 = 1.0 + K/Q + K*K;
+			double e0 = 1.0 + K/(Vo*Q) + K*K;
+			double beta = 2.0*(K*K - 1.0);
+			if(dB >= 0.0)
+			{
+				c[0] = (1.0 + Vo*K/Q + K*K)/d0; c[1] = beta/d0; c[2] = (1.0 - Vo*K/Q + K*K)/d0;
+				c[3] = beta/d0; c[4] = (1.0 - K/Q + K*K)/d0;
+			}
+			else
+			{
+				c[0] = d0/e0; c[1] = beta/e0; c[2] = (1.0 - K/Q + K*K)/e0;
+				c[3] = beta/e0; c[4] = (1.0 - K/(Vo*Q) + K*K)/e0;
+			}
+			break;
+		}
+		case PARAMETRIC:
+		{
+			double theta_c = 2.0*theta;
+			double tanArg = theta_c/(2.0*Q);
+			if(tanArg >= pi/2.0)
+				tanArg = 0.95*pi/2.0;
+			double T = 4.0/(1.0 + pow(10.0, dB/20.0))*tan(tanArg);
+			double beta = 0.5*(1.0 - T)/(1.0 + T);
+			double gamma = (0.5 + beta)*cos(theta_c);
+			c[0] = 0.5 - beta; c[1] = 0.0; c[2] = -(0.5 - beta); c[3] = -2.0*gamma; c[4] = 2.0*beta;
+			break;
+		}
+	}
+}
+
+static void runBatch(UINT uType, const float* pFc, UINT uCount, float Q, float dB, float fs, const biquadCoeffArrays& coeffs)
+{
+	switch(uType)
+	{
+		case B2LPF: calculateB2LPFCoeffsBatch(pFc, uCount, fs, coeffs); break;
+		case B2HPF: calculateB2HPFCoeffsBatch(pFc, uCount, fs, coeffs); break;
+		case B2BPF: calculateB2BPFCoeffsBatch(pFc, uCount, Q, fs, coeffs); break;
+		case B2BSF: calculateB2BSFCoeffsBatch(pFc, uCount, Q, fs, coeffs); break;
+		case CONSTQ: calculateConstQCoeffsBatch(pFc, uCount, Q, dB, fs, coeffs); break;
+		case PARAMETRIC: calculateParametricCoeffsBatch(pFc, uCount, Q, dB, fs, coeffs); break;
+	}
+}
+
+// --- the libm float path the CResonantLPF functions took before: one coefficient set per call
+static void runLibm(UINT uType, const float* pFc, UINT uCount, float Q, float dB, float fs, const biquadCoeffArrays& coeffs)
+{
+	for(UINT i = 0; i < uCount; i++)
+	{
+		float fc = pFc[i];
+		float theta = (float)pi*fc/fs;
+		float a0, a1, a2, b1, b2;
+		switch(uType)
+		{
+			case B2LPF:
+			case B2HPF:
+			{
+				float C = uType == B2LPF ? 1.0f/tanf(theta) : tanf(theta);
+				a0 = 1.0f/(1.0f + powf(2.0f, 0.5f)*C + C*C);
+				a1 = uType == B2LPF ? 2.0f*a0 : -2.0f*a0;
+				a2 = a0;
+				b1 = uType == B2LPF ? 2.0f*a0*(1.0f - C*C) : 2.0f*a0*(C*C - 1.0f);
+				b2 = a0*(1.0f - powf(2.0f, 0.5f)*C + C*C);
+				break;
+			}
+			case B2BPF:
+			case B2BSF:
+			{
+				float C = tanf((float)pi*fc*(fc/Q)/fs);
+				float D = 2.0f*cosf(2.0f*theta);
+				C = uType == B2BPF ? 1.0f/C : C;
+				a0 = 1.0f/(1.0f + C);
+				a1 = uType == B2BPF ? 0.0f : -a0*D;
+				a2 = uType == B2BPF ? -a0 : a0;
+				b1 = uType == B2BPF ? -a0*C*D : -a0*D;
+				b2 = uType == B2BPF ? a0*(C - 1.0f) : a0*(1.0f - C);
+				break;
+			}
+			case CONSTQ:
+			{
+				float K = tanf(theta);
+				float Vo = powf(10.0f, dB/20.0f);
+				float d0 = 1.0f + K/Q + K*K;
+				float e0 = 1.0f + K/(Vo*Q) + K*K;
+				float beta = 2.0f*(K*K - 1.0f);
+				bool bBoost = dB >= 0.0f;
+				a0 = bBoost ? (1.0f + Vo*K/Q + K*K)/d0 : d0/e0;
+				a1 = bBoost ? beta/d0 : beta/e0;
+				a2 = bBoost ? (1.0f - Vo*K/Q + K*K)/d0 : (1.0f - K/Q + K*K)/e0;
+				b1 = a1;
+				b2 = bBoost ? (1.0f - K/Q + K*K)/d0 : (1.0f - K/(Vo*Q) + K*K)/e0;
+				break;
+			}
+			default:
+			{
+				float theta_c = 2.0f*theta;
+				float tanArg = theta_c/(2.0f*Q);
+				if(tanArg >= (float)pi/2.0f)
+					tanArg = 0.95f*(float)pi/2.0f;
+				float T = 4.0f/(1.0f + powf(10.0f, dB/20.0f))*tanf(tanArg);
+				float beta = 0.5f*(1.0f - T)/(1.0f + T);
+				a0 = 0.5f - beta; a1 = 0.0f; a2 = -a0;
+				b1 = -2.0f*(0.5f + beta)*cosf(theta_c);
+				b2 = 2.0f*beta;
+				break;
+			}
+		}
+		coeffs.pA0[i] = a0;
+		coeffs.pA1[i] = a1;
+		coeffs.pA2[i] = a2;
+		coeffs.pB1[i] = b1;
+		coeffs.pB2[i] = b2;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	UINT uCount = 256;
+	UINT uReps = 4000;
+	for(int i = 1; i < argc - 1; i++)
+	{
+		if(strcmp(argv[i], "-n") == 0)
+			uCount = (UINT)atoi(argv[++i]);
+		else if(strcmp(argv[i], "-r") == 0)
+			uReps = (UINT)atoi(argv[++i]);
+	}
+
+	// --- 1) function error bounds
+	printf("function error vs double libm\n");
+	printf("  fastTan   rel  [0, pi/2)        %.3g\n", maxError(tan, fastTan, 0.0, 1.5707, 1000000, true));
+	printf("  fastTan   rel  [-1e4, 1e4]      %.3g  (|tan| < 100)\n", maxError(tan, fastTan, -1.0e4, 1.0e4, 4000000, true, 100.0));
+	printf("  fastSin   abs  [-pi, pi]        %.3g\n", maxError(sin, fastSin, -pi, pi, 1000000, false));
+	printf("  fastSin   abs  [-1e4, 1e4]      %.3g\n", maxError(sin, fastSin, -1.0e4, 1.0e4, 4000000, false));
+	printf("  fastCos   abs  [-1e4, 1e4]      %.3g\n", maxError(cos, fastCos, -1.0e4, 1.0e4, 4000000, false));
+	printf("  fastPow10 rel  [-6, 6]          %.3g\n", maxError(pow10d, fastPow10, -6.0, 6.0, 1000000, true));
+	printf("  fastPow10 rel  [-37, 37]        %.3g\n", maxError(pow10d, fastPow10, -37.0, 37.0, 1000000, true));
+
+	// --- 2) coefficient error over cutoff sweeps
+	const float fSampleRates[3] = {44100.0f, 96000.0f, 192000.0f};
+	const float fQ = 0.707f;
+	const float fBoosts[2] = {12.0f, -12.0f};
+
+	std::vector<float> fc(uCount);
+	std::vector<float> store(5*uCount);
+	biquadCoeffArrays coeffs = {&store[0], &store[uCount], &store[2*uCount], &store[3*uCount], &store[4*uCount]};
+
+	printf("\nmax abs coefficient error vs double reference (fc 10 Hz .. 0.45 fs, Q %.3f, +/-12 dB)\n", fQ);
+	for(UINT t = 0; t < NUM_TYPES; t++)
+	{
+		double dMax = 0.0;
+		for(UINT s = 0; s < 3; s++)
+		{
+			float fs = fSampleRates[s];
+
+			// --- the BW = fc/Q terms of B2BPF/B2BSF put fc^2 into tan(); keep the argument below pi/2
+			float fHi = (t == B2BPF || t == B2BSF) ? sqrtf(0.45f*fs*fQ) : 0.45f*fs;
+			for(UINT i = 0; i < uCount; i++)
+				fc[i] = 10.0f*powf(fHi/10.0f, (float)i/(float)(uCount - 1));
+
+			for(UINT b = 0; b < 2; b++)
+			{
+				runBatch(t, &fc[0], uCount, fQ, fBoosts[b], fs, coeffs);
+				for(UINT i = 0; i < uCount; i++)
+				{
+					double ref[5];
+					referenceCoeffs(t, fc[i], fQ, fBoosts[b], fs, ref);
+					for(UINT k = 0; k < 5; k++)
+					{
+						double err = fabs((double)store[k*uCount + i] - ref[k]);
+						dMax = err > dMax ? err : dMax;
+					}
+				}
+			}
+		}
+		printf("  %-12s %.3g\n", g_szTypeNames[t], dMax);
+	}
+
+	// --- 3) speed; a slow per-rep drift on the cutoffs keeps the calls from being hoisted
+	printf("\nns per coefficient set (%u cutoffs per call)\n", uCount);
+	printf("  %-12s %10s %10s %8s\n", "type", "libm", "batch", "speedup");
+	for(UINT i = 0; i < uCount; i++)
+		fc[i] = 20.0f*powf(1000.0f, (float)i/(float)(uCount - 1));
+
+	for(UINT t = 0; t < NUM_TYPES; t++)
+	{
+		double dNs[2];
+		for(UINT m = 0; m < 2; m++)
+		{
+			benchClock::time_point start = benchClock::now();
+			for(UINT r = 0; r < uReps; r++)
+			{
+				fc[r % uCount] += 1.0e-3f;
+				if(m == 0)
+					runLibm(t, &fc[0], uCount, fQ, 6.0f, 44100.0f, coeffs);
+				else
+					runBatch(t, &fc[0], uCount, fQ, 6.0f, 44100.0f, coeffs);
+				g_fSink += store[r % (5*uCount)];
+			}
+			double dSeconds = std::chrono::duration<double>(benchClock::now() - start).count();
+			dNs[m] = dSeconds*1.0e9/((double)uReps*(double)uCount);
+		}
+		printf("  %-12s %10.2f %10.2f %7.1fx\n", g_szTypeNames[t], dNs[0], dNs[1], dNs[0]/dNs[1]);
+	}
+
+	return 0;
+}
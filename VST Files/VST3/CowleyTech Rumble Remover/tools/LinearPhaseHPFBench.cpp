@@ -0,0 +1,131 @@
+/*
+	LinearPhaseHPFBench.cpp
+
+	Checks that CLinearPhaseHPF changes its cutoff without a click, and times
+	the part of it the audio thread sees.
+
+	A 40 Hz sine at 0.9 runs through the filter at a 20 Hz cutoff (passed),
+	then the cutoff moves to 200 Hz (removed):
+		crossfade   the design thread's FIR is faded in across one block; the
+		            largest step between samples stays near the sine's own
+		after       once the fade is over the output is exactly that of a
+		            convolver that only ever had the new FIR
+		hard swap   the new FIR replacing the old at a block boundary, as it
+		            used to, for comparison: a step of about the sine's level
+
+	Speed:
+		setCutoff   what a cutoff change costs the audio thread
+		design      setCutoff() to the new FIR being ready, on the design thread
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -pthread -I../source LinearPhaseHPFBench.cpp \
+			../source/FFTConvolver.cpp -o LinearPhaseHPFBench
+
+	Usage:
+		LinearPhaseHPFBench [-s sample rate]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "FFTConvolver.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+static float sine(UINT n, float fSampleRate)
+{
+	return 0.9*sin(2.0*pi*40.0*n/fSampleRate);
+}
+
+int main(int argc, char* argv[])
+{
+	float fSampleRate = 48000.0;
+	for(int i = 1; i < argc - 1; i++)
+		if(strcmp(argv[i], "-s") == 0)
+			fSampleRate = (float)atof(argv[i + 1]);
+
+	CLinearPhaseHPF hpf;
+	hpf.setCutoff(20.0);
+	hpf.init(fSampleRate, 1);
+
+	// --- the same FIRs set directly, for the reference and the hard swap
+	UINT uLength = hpf.getLength();
+	UINT uBlock = hpf.getLatencyInSamples() - (uLength - 1)/2;
+	std::vector<float> oldTaps(uLength), newTaps(uLength);
+	CLinearPhaseHPF::designHPF(&oldTaps[0], uLength, 20.0, fSampleRate);
+	CLinearPhaseHPF::designHPF(&newTaps[0], uLength, 200.0, fSampleRate);
+
+	CPartitionedConvolver hard, reference;
+	hard.init(uBlock, uLength, 1);
+	reference.init(uBlock, uLength, 1);
+	hard.setImpulseResponse(&oldTaps[0], uLength);
+	reference.setImpulseResponse(&newTaps[0], uLength);
+
+	// --- settle past the FIR, then change on a block boundary
+	UINT uChange = (uLength/uBlock + 4)*uBlock;
+	UINT uTotal = uChange + uLength + 4*uBlock;
+	std::vector<float> faded(uTotal), swapped(uTotal), expected(uTotal);
+
+	double dSetCutoffNs = 0.0, dDesignMs = 0.0;
+	for(UINT n = 0; n < uTotal; n++)
+	{
+		if(n == uChange)
+		{
+			UINT uDesign = hpf.getDesignCount();
+			benchClock::time_point start = benchClock::now();
+			hpf.setCutoff(200.0);
+			dSetCutoffNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count();
+
+			// --- wait for the design, so the fade lands on this block
+			while(hpf.getDesignCount() == uDesign)
+				std::this_thread::yield();
+			dDesignMs = std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+
+			hard.setImpulseResponse(&newTaps[0], uLength);
+		}
+
+		float fIn = sine(n, fSampleRate);
+		hpf.processFrame(&fIn, &faded[n]);
+		hard.processFrame(&fIn, &swapped[n]);
+		reference.processFrame(&fIn, &expected[n]);
+	}
+
+	// --- steps: the steady sine, then around the change
+	float fSineStep = 0.0, fFadedStep = 0.0, fHardStep = 0.0;
+	for(UINT n = 1; n < uTotal; n++)
+	{
+		float fFaded = fabs(faded[n] - faded[n - 1]);
+		float fHard = fabs(swapped[n] - swapped[n - 1]);
+		if(n < uChange)
+			fSineStep = fmax(fSineStep, fFaded);
+		else
+		{
+			fFadedStep = fmax(fFadedStep, fFaded);
+			fHardStep = fmax(fHardStep, fHard);
+		}
+	}
+
+	// --- after the fade block (output lags by a block) it is the new FIR alone
+	float fAfterError = 0.0;
+	for(UINT n = uChange + 2*uBlock; n < uTotal; n++)
+		fAfterError = fmax(fAfterError, fabs(faded[n] - expected[n]));
+
+	bool bFade = fFadedStep < fSineStep + 2.0/uBlock;
+	bool bAfter = fAfterError < 1e-5;
+	bool bHard = fHardStep > 10.0*fFadedStep;
+
+	printf("%u taps, %u sample blocks\n", uLength, uBlock);
+	printf("sine       largest step %.4f\n", fSineStep);
+	printf("crossfade  largest step %.4f  %s\n", fFadedStep, bFade ? "ok" : "FAIL");
+	printf("after      error %.2e  %s\n", fAfterError, bAfter ? "ok" : "FAIL");
+	printf("hard swap  largest step %.4f  %s\n", fHardStep, bHard ? "ok" : "FAIL");
+
+	printf("\nsetCutoff  %8.0f ns\n", dSetCutoffNs);
+	printf("design     %8.3f ms\n", dDesignMs);
+
+	return bFade && bAfter && bHard ? 0 : 1;
+}
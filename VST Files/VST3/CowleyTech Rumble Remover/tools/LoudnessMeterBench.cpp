@@ -0,0 +1,147 @@
+/*
+	LoudnessMeterBench.cpp
+
+	Checks CLoudnessMeter against the EBU Tech 3341 minimum requirements that
+	use stereo 1 kHz tones, and times it.
+
+	Cases (expected result +/-0.1 LU; the tones are stereo, so each channel at
+	-23 dBFS reads -23 LUFS):
+		1   -23 dBFS 20 s                            M, S, I = -23
+		2   -33 dBFS 20 s                            M, S, I = -33
+		3   -36/-23/-36 dBFS, 10/60/10 s             I = -23 (relative gate)
+		4   -72/-36/-23/-36/-72 dBFS, 10/10/60/10/10 s  I = -23 (both gates)
+		5   -26/-20/-26 dBFS, 20/20.1/20 s           I = -23
+
+	Every case runs at 44.1 and 48 kHz, through processBlock() in host-sized
+	buffers. Speed is ns per stereo frame.
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source LoudnessMeterBench.cpp \
+			../source/pluginobjects.cpp -o LoudnessMeterBench
+
+	Usage:
+		LoudnessMeterBench [-b buffer frames]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "pluginconstants.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+typedef struct
+{
+	float fLevel_dB;
+	float fSeconds;
+}toneSegment;
+
+// --- runs the segments through the meter; M and S as they stand at the end
+static void runTone(CLoudnessMeter& meter, const toneSegment* pSegments, UINT uSegments, float fSampleRate, UINT uBufferSize)
+{
+	std::vector<float> left(uBufferSize), right(uBufferSize);
+	double dPhase = 0.0;
+	double dInc = 2.0*pi*1000.0/fSampleRate;
+
+	meter.reset();
+	for(UINT s = 0; s < uSegments; s++)
+	{
+		double dAmp = pow(10.0, pSegments[s].fLevel_dB/20.0);
+		UINT uFrames = (UINT)(pSegments[s].fSeconds*fSampleRate + 0.5);
+		while(uFrames > 0)
+		{
+			UINT uCount = uFrames < uBufferSize ? uFrames : uBufferSize;
+			for(UINT n = 0; n < uCount; n++)
+			{
+				left[n] = right[n] = dAmp*sin(dPhase);
+				dPhase += dInc;
+			}
+			float* ppIn[2] = {&left[0], &right[0]};
+			meter.processBlock(ppIn, 2, uCount);
+			uFrames -= uCount;
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	UINT uBufferSize = 512;
+	for(int i = 1; i < argc - 1; i++)
+	{
+		if(strcmp(argv[i], "-b") == 0)
+			uBufferSize = (UINT)atoi(argv[++i]);
+	}
+	if(uBufferSize < 1)
+		uBufferSize = 1;
+
+	const toneSegment case1[] = {{-23.0, 20.0}};
+	const toneSegment case2[] = {{-33.0, 20.0}};
+	const toneSegment case3[] = {{-36.0, 10.0}, {-23.0, 60.0}, {-36.0, 10.0}};
+	const toneSegment case4[] = {{-72.0, 10.0}, {-36.0, 10.0}, {-23.0, 60.0}, {-36.0, 10.0}, {-72.0, 10.0}};
+	const toneSegment case5[] = {{-26.0, 20.0}, {-20.0, 20.1}, {-26.0, 20.0}};
+
+	const toneSegment* pCases[] = {case1, case2, case3, case4, case5};
+	const UINT uCounts[] = {1, 1, 3, 5, 3};
+	const float fExpected[] = {-23.0, -33.0, -23.0, -23.0, -23.0};
+	const float fRates[] = {44100.0, 48000.0};
+
+	bool bOK = true;
+	CLoudnessMeter meter;
+	printf("%4s %8s %9s %9s %9s\n", "case", "fs", "M", "S", "I");
+	for(UINT r = 0; r < 2; r++)
+	{
+		meter.init(fRates[r]);
+		for(UINT c = 0; c < 5; c++)
+		{
+			runTone(meter, pCases[c], uCounts[c], fRates[r], uBufferSize);
+
+			float fM = meter.getMomentaryLoudness();
+			float fS = meter.getShortTermLoudness();
+			float fI = meter.getIntegratedLoudness();
+
+			bool bPass = fabs(fI - fExpected[c]) <= 0.1;
+			if(c < 2)
+				bPass = bPass && fabs(fM - fExpected[c]) <= 0.1 && fabs(fS - fExpected[c]) <= 0.1;
+
+			printf("%4u %8.0f %9.2f %9.2f %9.2f  %s\n", c + 1, fRates[r], fM, fS, fI, bPass ? "ok" : "FAIL");
+			bOK = bOK && bPass;
+		}
+	}
+
+	// --- speed on 60 s of stereo noise
+	const UINT uFrames = 60*48000;
+	std::vector<float> left(uFrames), right(uFrames);
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		left[n] = 0.1f*(2.0f*rand()/RAND_MAX - 1.0f);
+		right[n] = 0.1f*(2.0f*rand()/RAND_MAX - 1.0f);
+	}
+
+	meter.init(48000.0);
+	benchClock::time_point start = benchClock::now();
+	for(UINT n = 0; n < uFrames; n += uBufferSize)
+	{
+		UINT uCount = uFrames - n < uBufferSize ? uFrames - n : uBufferSize;
+		float* ppIn[2] = {&left[n], &right[n]};
+		meter.processBlock(ppIn, 2, uCount);
+	}
+	double dBlock = std::chrono::duration<double>(benchClock::now() - start).count();
+
+	meter.reset();
+	start = benchClock::now();
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		float fIn[2] = {left[n], right[n]};
+		meter.processFrame(&fIn[0], 2);
+	}
+	double dFrame = std::chrono::duration<double>(benchClock::now() - start).count();
+
+	printf("\nstereo, ns/frame: processBlock %.2f, processFrame %.2f (I = %.2f LUFS)\n",
+		   1.0e9*dBlock/uFrames, 1.0e9*dFrame/uFrames, meter.getIntegratedLoudness());
+
+	printf("%s\n", bOK ? "PASS" : "FAIL");
+	return bOK ? 0 : 1;
+}
@@ -0,0 +1,309 @@
+/*
+	MeterEngineBench.cpp
+
+	Checks CMeterEngine's readings and times it on the audio thread.
+
+	Checks:
+		dB        fastAmplitudeTodB() against 20 log10 from -120 to +12 dB
+		sine      a 1 kHz sine at 0.5 after the ballistics settled reads
+		          VU and RMS -9.03 dB, PPM a little under -6.02 dB, the peak
+		          hold -6.02 dB and the detector just under 0.5 (a 10 ms
+		          attack does not catch every crest)
+		hold      after a burst the peak hold stays for METER_PEAK_HOLD_MSEC,
+		          then falls at METER_PEAK_FALL_DB_PER_SEC
+		held      processHeld(N) reads exactly as N processFrame() calls on
+		          the same value
+
+	Frames go through a CControllerMessageQueue as in the VST3 wrapper.
+
+	Speed, ns per frame for 8 channels (2 in, 2 out, 4 spare), 512 frame
+	buffers, the GUI draining the queue every 30 ms:
+		engine    processFrame() + endBlock() into the queue + displayFrame()
+		          and updateDisplay()
+		naive     per channel, per sample: the RackAFX meter detector with its
+		          log detector plus VU, PPM and RMS one-poles each put through
+		          20 log10, for comparison
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source MeterEngineBench.cpp \
+			../source/pluginobjects.cpp -o MeterEngineBench
+
+	Usage:
+		MeterEngineBench [-s sample rate]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "pluginconstants.h"
+#include "ControllerMessages.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+static const UINT BENCH_CHANNELS = 8;
+static const UINT BENCH_BUFFER = 512;
+
+static bool near(float fValue, float fExpected, float fTolerance)
+{
+	return fabs(fValue - fExpected) <= fTolerance;
+}
+
+// --- audio thread side of Processor::sendAudioMessages()
+static void endBlock(CMeterEngine& engine, CControllerMessageQueue& queue)
+{
+	controllerMessage* pMessage = queue.beginPush(CONTROLLER_MSG_METER_FRAME);
+	if(!pMessage)
+		return;
+
+	pMessage->meterFrame.uChannels = engine.getChannelCount();
+	if(engine.endBlock(&pMessage->meterFrame.fFrame[0]))
+		queue.push();
+}
+
+// --- and the GUI tick's
+static void updateDisplay(CMeterEngine& engine, CControllerMessageQueue& queue)
+{
+	for(const controllerMessage* pMessage = queue.front(); pMessage; pMessage = queue.front())
+	{
+		engine.displayFrame(&pMessage->meterFrame.fFrame[0]);
+		queue.pop();
+	}
+	engine.updateDisplay();
+}
+
+// --- runs uFrames of a generator through one channel, GUI ticks included
+template <typename T> static void run(CMeterEngine& engine, CControllerMessageQueue& queue, float& fSource, float fSampleRate, UINT uFrames, T generator, UINT& uFrame)
+{
+	UINT uTick = (UINT)(0.03*fSampleRate);
+	for(UINT n = 0; n < uFrames; n++, uFrame++)
+	{
+		fSource = generator(uFrame);
+		engine.processFrame();
+		if(uFrame % BENCH_BUFFER == BENCH_BUFFER - 1)
+			endBlock(engine, queue);
+		if(uFrame % uTick == uTick - 1)
+			updateDisplay(engine, queue);
+	}
+	endBlock(engine, queue);
+	updateDisplay(engine, queue);
+}
+
+static bool checkdB()
+{
+	float fWorst = 0.0;
+	for(float fdB = -120.0; fdB <= 12.0; fdB += 0.01)
+	{
+		float fAmplitude = pow(10.0, fdB/20.0);
+		float fError = fabs(CMeterEngine::fastAmplitudeTodB(fAmplitude) - 20.0*log10(fAmplitude));
+		if(fError > fWorst)
+			fWorst = fError;
+	}
+
+	bool bPass = fWorst < 0.001;
+	printf("dB     worst error %.6f dB  %s\n", fWorst, bPass ? "ok" : "FAIL");
+	return bPass;
+}
+
+static bool checkSine(float fSampleRate)
+{
+	float fSource = 0.0;
+	float* pSource = &fSource;
+	CMeterEngine engine;
+	CControllerMessageQueue queue;
+	engine.setChannels(1, &pSource);
+	engine.setSampleRate(fSampleRate);
+	engine.setDetector(0, 10.0, 500.0, 0);
+
+	UINT uFrame = 0;
+	run(engine, queue, fSource, fSampleRate, 3*(UINT)fSampleRate, [&](UINT n){return (float)(0.5*sin(2.0*pi*1000.0*n/fSampleRate));}, uFrame);
+
+	float fVU = engine.getReading_dB(0, METER_READING_VU);
+	float fRMS = engine.getReading_dB(0, METER_READING_RMS);
+	float fPPM = engine.getReading_dB(0, METER_READING_PPM);
+	float fHold = engine.getReading_dB(0, METER_READING_PEAK_HOLD);
+	float fDetector = engine.getDetector(0);
+
+	bool bPass = near(fVU, -9.03, 0.1) && near(fRMS, -9.03, 0.1) && fPPM < -6.0 && fPPM > -7.5 &&
+				 near(fHold, -6.02, 0.01) && fDetector < 0.5 && fDetector > 0.45;
+	printf("sine   VU %6.2f  RMS %6.2f  PPM %6.2f  hold %6.2f  detector %5.3f  %s\n", fVU, fRMS, fPPM, fHold, fDetector, bPass ? "ok" : "FAIL");
+	return bPass;
+}
+
+static bool checkHold(float fSampleRate)
+{
+	float fSource = 0.0;
+	float* pSource = &fSource;
+	CMeterEngine engine;
+	CControllerMessageQueue queue;
+	engine.setChannels(1, &pSource);
+	engine.setSampleRate(fSampleRate);
+
+	UINT uFrame = 0;
+	UINT uBurst = (UINT)(0.1*fSampleRate);
+	run(engine, queue, fSource, fSampleRate, uBurst, [&](UINT n){return (float)(0.5*sin(2.0*pi*1000.0*n/fSampleRate));}, uFrame);
+
+	// --- one second in, still holding; a second after the hold ran out, 20 dB down
+	auto silence = [](UINT){return 0.0f;};
+	run(engine, queue, fSource, fSampleRate, (UINT)fSampleRate, silence, uFrame);
+	float fHolding = engine.getReading_dB(0, METER_READING_PEAK_HOLD);
+
+	run(engine, queue, fSource, fSampleRate, (UINT)(0.001*(METER_PEAK_HOLD_MSEC + 1000.0)*fSampleRate) - (UINT)fSampleRate, silence, uFrame);
+	float fFalling = engine.getReading_dB(0, METER_READING_PEAK_HOLD);
+	float fExpected = -6.02 - METER_PEAK_FALL_DB_PER_SEC;
+
+	// --- a buffer of slack either way
+	float fSlack = METER_PEAK_FALL_DB_PER_SEC*BENCH_BUFFER/fSampleRate;
+	bool bPass = near(fHolding, -6.02, 0.01) && near(fFalling, fExpected, fSlack + 0.01);
+	printf("hold   after 1 s %6.2f  after %.1f s %6.2f (%.2f)  %s\n", fHolding, 0.001*METER_PEAK_HOLD_MSEC + 1.0, fFalling, fExpected, bPass ? "ok" : "FAIL");
+	return bPass;
+}
+
+static bool checkHeld(float fSampleRate)
+{
+	float fSources[2] = {0.0, 0.0};
+	float* pSources[2] = {&fSources[0], &fSources[1]};
+	CMeterEngine frames, held;
+	CControllerMessageQueue framesQueue, heldQueue;
+	frames.setChannels(2, pSources);
+	held.setChannels(2, pSources);
+	frames.setSampleRate(fSampleRate);
+	held.setSampleRate(fSampleRate);
+	frames.setDetector(1, 5.0, 200.0, 2);
+	held.setDetector(1, 5.0, 200.0, 2);
+
+	// --- values held a buffer at a time, as a once per buffer plug-in meters
+	bool bSame = true;
+	srand(1);
+	for(UINT uBuffer = 0; uBuffer < 200; uBuffer++)
+	{
+		UINT uFrames = 1 + rand() % BENCH_BUFFER;
+		fSources[0] = uBuffer < 150 ? (float)rand()/RAND_MAX : 0.0;
+		fSources[1] = uBuffer < 150 ? (float)rand()/RAND_MAX - 0.5 : 0.0;
+
+		for(UINT n = 0; n < uFrames; n++)
+			frames.processFrame();
+		held.processHeld(uFrames);
+		endBlock(frames, framesQueue);
+		endBlock(held, heldQueue);
+		updateDisplay(frames, framesQueue);
+		updateDisplay(held, heldQueue);
+
+		for(UINT c = 0; c < 2; c++)
+		{
+			bSame &= frames.getDetector(c) == held.getDetector(c);
+			for(UINT r = 0; r < METER_READINGS; r++)
+				bSame &= frames.getReading_dB(c, r) == held.getReading_dB(c, r);
+		}
+	}
+
+	printf("held   %s\n", bSame ? "ok" : "FAIL (differs from per frame)");
+	return bSame;
+}
+
+// --- what metering every variable per sample costs
+class CNaiveMeter
+{
+public:
+	CNaiveMeter(float fSampleRate)
+	{
+		double dMsec = 0.001*fSampleRate;
+		m_fAttack = exp(ANALOG_TC/(10.0*dMsec));
+		m_fRelease = exp(ANALOG_TC/(500.0*dMsec));
+		m_fVUCoeff = exp(DIGITAL_TC/(METER_VU_MSEC*dMsec));
+		m_fPPMAttack = exp(log(0.2)/(METER_PPM_ATTACK_MSEC*dMsec));
+		m_fPPMRelease = pow(10.0, -METER_PPM_FALL_DB/20.0/(METER_PPM_FALL_MSEC*dMsec));
+		m_fRMSCoeff = exp(-1.0/(METER_RMS_MSEC*dMsec));
+		m_fEnvelope = m_fVU = m_fPPM = m_fMS = 0.0;
+		fDetector = fVU = fPPM = fRMS = 0.0;
+	}
+
+	inline void detect(float fInput)
+	{
+		float a = fabs(fInput);
+
+		float fEnvelope = a > m_fEnvelope ? m_fAttack*(m_fEnvelope - a) + a : m_fRelease*(m_fEnvelope - a) + a;
+		if(fEnvelope > 0.0 && fEnvelope < FLT_MIN_PLUS) fEnvelope = 0;
+		m_fEnvelope = fmax(fmin(fEnvelope, (float)1.0), (float)0.0);
+		fDetector = m_fEnvelope > 0 ? (fmax(METER_MIN_DB, 20*log10(m_fEnvelope)) - METER_MIN_DB)/-METER_MIN_DB : 0;
+
+		m_fVU = m_fVUCoeff*(m_fVU - a) + a;
+		fVU = 20*log10(fmax(m_fVU, 1e-6f));
+
+		m_fPPM = a > m_fPPM ? m_fPPMAttack*(m_fPPM - a) + a : m_fPPMRelease*(m_fPPM - a) + a;
+		fPPM = 20*log10(fmax(m_fPPM, 1e-6f));
+
+		m_fMS = m_fRMSCoeff*(m_fMS - fInput*fInput) + fInput*fInput;
+		fRMS = 10*log10(fmax(m_fMS, 1e-12f));
+	}
+
+	float fDetector, fVU, fPPM, fRMS;
+
+protected:
+	float m_fAttack, m_fRelease, m_fVUCoeff, m_fPPMAttack, m_fPPMRelease, m_fRMSCoeff;
+	float m_fEnvelope, m_fVU, m_fPPM, m_fMS;
+};
+
+int main(int argc, char* argv[])
+{
+	float fSampleRate = 48000.0;
+	for(int i = 1; i < argc - 1; i++)
+		if(strcmp(argv[i], "-s") == 0)
+			fSampleRate = (float)atof(argv[i + 1]);
+
+	bool bPass = true;
+	bPass &= checkdB();
+	bPass &= checkSine(fSampleRate);
+	bPass &= checkHold(fSampleRate);
+	bPass &= checkHeld(fSampleRate);
+
+	// --- speed, over 20 s of sines
+	UINT uFrames = 20*(UINT)fSampleRate;
+	std::vector<float> input(uFrames);
+	for(UINT n = 0; n < uFrames; n++)
+		input[n] = 0.5*sin(2.0*pi*1000.0*n/fSampleRate);
+
+	float fSources[BENCH_CHANNELS];
+	float* pSources[BENCH_CHANNELS];
+	for(UINT c = 0; c < BENCH_CHANNELS; c++)
+		pSources[c] = &fSources[c];
+
+	CMeterEngine engine;
+	CControllerMessageQueue queue;
+	engine.setChannels(BENCH_CHANNELS, pSources);
+	engine.setSampleRate(fSampleRate);
+	UINT uTick = (UINT)(0.03*fSampleRate);
+
+	benchClock::time_point start = benchClock::now();
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		for(UINT c = 0; c < BENCH_CHANNELS; c++)
+			fSources[c] = input[n]*(c + 1)*0.125f;
+		engine.processFrame();
+		if(n % BENCH_BUFFER == BENCH_BUFFER - 1)
+			endBlock(engine, queue);
+		if(n % uTick == uTick - 1)
+			updateDisplay(engine, queue);
+	}
+	double dEngine = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/uFrames;
+
+	std::vector<CNaiveMeter> naive(BENCH_CHANNELS, CNaiveMeter(fSampleRate));
+	float fSum = 0.0;
+	start = benchClock::now();
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		for(UINT c = 0; c < BENCH_CHANNELS; c++)
+		{
+			naive[c].detect(input[n]*(c + 1)*0.125f);
+			fSum += naive[c].fDetector + naive[c].fVU + naive[c].fPPM + naive[c].fRMS;
+		}
+	}
+	double dNaive = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/uFrames;
+
+	printf("\nengine %6.2f ns/frame (%d)\n", dEngine, (int)engine.getDetector(0));
+	printf("naive  %6.2f ns/frame (%d)\n", dNaive, (int)fSum & 1);
+
+	return bPass ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+/*
+	ParallelIIRBench.cpp
+
+	Accuracy and single-channel speed of CParallelIIR against the biquad cascade
+	it was converted from, for Butterworth HPFs of order 4 to 16.
+
+	Accuracy, per order and cutoff: the max error of the float CBiQuad cascade and
+	of CParallelIIR against the same cascade run in double, on 1 s of white noise,
+	in dB relative to the output RMS. Both forms lose precision as the poles crowd
+	towards z = 1, the parallel form faster: its sections' outputs grow large and
+	cancel in the sum. setFromCascade() refuses ("--") where its estimate says the
+	parallel form would be the noisier one. Checks:
+		accepted    the parallel error is at most the cascade's (+0.5 dB)
+		16th order  refused at every cutoff; the parallel form measures worse
+		            there (e.g. -31.5 vs -43.6 dB at 20 Hz, 48 kHz)
+		4th order   accepted at every cutoff
+	and the exit code is 1 if any fails.
+
+	Speed: ns per sample for the CBiQuad cascade (doBiQuad per section) and for
+	CParallelIIR::processBlock(), on one channel, at 40 Hz.
+
+	Build (Linux/macOS, from this folder; drop -mavx for the SSE path):
+		g++ -std=c++11 -O2 -mavx -D__stdcall= -I../source ParallelIIRBench.cpp \
+			../source/pluginobjects.cpp -o ParallelIIRBench
+
+	Usage:
+		ParallelIIRBench [-fs 48000] [-s seconds]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "pluginconstants.h"
+#include "filtercoeffs.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+// --- the same cascade in double, as the reference for both float forms
+static void runReference(const float* pCoeffs, UINT uSections, const float* pInput, double* pOutput, UINT uFrames)
+{
+	double x1[PARALLEL_IIR_MAX_SECTIONS] = {0}, x2[PARALLEL_IIR_MAX_SECTIONS] = {0};
+	double y1[PARALLEL_IIR_MAX_SECTIONS] = {0}, y2[PARALLEL_IIR_MAX_SECTIONS] = {0};
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		double x = pInput[n];
+		for(UINT k = 0; k < uSections; k++)
+		{
+			const float* c = pCoeffs + 5*k;
+			double y = c[0]*x + c[1]*x1[k] + c[2]*x2[k] - c[3]*y1[k] - c[4]*y2[k];
+			x2[k] = x1[k];
+			x1[k] = x;
+			y2[k] = y1[k];
+			y1[k] = y;
+			x = y;
+		}
+		pOutput[n] = x;
+	}
+}
+
+static void runCascade(std::vector<CBiQuad>& cascade, const float* pInput, float* pOutput, UINT uFrames)
+{
+	UINT uSections = (UINT)cascade.size();
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		float y = pInput[n];
+		for(UINT k = 0; k < uSections; k++)
+			y = cascade[k].doBiQuad(y);
+		pOutput[n] = y;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	float fSampleRate = 48000.0f;
+	double dSeconds = 1.0;
+	for(int i = 1; i < argc - 1; i++)
+	{
+		if(strcmp(argv[i], "-fs") == 0)
+			fSampleRate = (float)atof(argv[++i]);
+		else if(strcmp(argv[i], "-s") == 0)
+			dSeconds = atof(argv[++i]);
+	}
+
+#if defined(__AVX__)
+	printf("CParallelIIR lanes: AVX\n");
+#else
+	printf("CParallelIIR lanes: SSE/scalar\n");
+#endif
+
+	const float fCutoffs[4] = {20.0f, 40.0f, 100.0f, 1000.0f};
+	const UINT uFrames = (UINT)fSampleRate;
+
+	std::vector<float> noise(uFrames), out1(uFrames), out2(uFrames);
+	srand(1);
+	for(UINT n = 0; n < uFrames; n++)
+		noise[n] = (float)rand()/(float)RAND_MAX - 0.5f;
+
+	printf("\nmax error vs double cascade at %.0f Hz, dB re output RMS (float cascade / parallel)\n", fSampleRate);
+	printf("%6s", "order");
+	for(UINT c = 0; c < 4; c++)
+		printf("  %12.0f Hz", fCutoffs[c]);
+	printf("\n");
+
+	bool bPass = true;
+	std::vector<double> reference(uFrames);
+	for(UINT uOrder = 4; uOrder <= 16; uOrder += 2)
+	{
+		printf("%6u", uOrder);
+		for(UINT c = 0; c < 4; c++)
+		{
+			float fCoeffs[5*PARALLEL_IIR_MAX_SECTIONS];
+			UINT uSections = uOrder/2;
+			calculateButterworthHPFCascade(fCutoffs[c], fSampleRate, uOrder, &fCoeffs[0]);
+
+			std::vector<CBiQuad> cascade(uSections);
+			for(UINT k = 0; k < uSections; k++)
+			{
+				cascade[k].m_f_a0 = fCoeffs[5*k];
+				cascade[k].m_f_a1 = fCoeffs[5*k + 1];
+				cascade[k].m_f_a2 = fCoeffs[5*k + 2];
+				cascade[k].m_f_b1 = fCoeffs[5*k + 3];
+				cascade[k].m_f_b2 = fCoeffs[5*k + 4];
+				cascade[k].flushDelays();
+			}
+
+			CParallelIIR parallel;
+			bool bAccepted = parallel.setFromCascade(&fCoeffs[0], uSections);
+
+			runReference(&fCoeffs[0], uSections, &noise[0], &reference[0], uFrames);
+			runCascade(cascade, &noise[0], &out1[0], uFrames);
+			if(bAccepted)
+				parallel.processBlock(&noise[0], &out2[0], uFrames);
+
+			double dErr1 = 0.0, dErr2 = 0.0, dPower = 0.0;
+			for(UINT n = 0; n < uFrames; n++)
+			{
+				double d1 = fabs(out1[n] - reference[n]);
+				double d2 = fabs(out2[n] - reference[n]);
+				dErr1 = d1 > dErr1 ? d1 : dErr1;
+				dErr2 = d2 > dErr2 ? d2 : dErr2;
+				dPower += reference[n]*reference[n];
+			}
+			double dRMS = sqrt(dPower/uFrames);
+			double dCascade_dB = 20.0*log10(dErr1/dRMS + 1.0e-30);
+			double dParallel_dB = 20.0*log10(dErr2/dRMS + 1.0e-30);
+
+			bool bOK = true;
+			if(bAccepted)
+				bOK = dParallel_dB <= dCascade_dB + 0.5 && uOrder < 16;
+			else
+				bOK = uOrder > 4;
+			bPass &= bOK;
+
+			if(bAccepted)
+				printf("  %6.1f /%6.1f%s", dCascade_dB, dParallel_dB, bOK ? " " : "!");
+			else
+				printf("  %6.1f /%6s%s", dCascade_dB, "--", bOK ? " " : "!");
+		}
+		printf("\n");
+	}
+	printf("accuracy  %s\n", bPass ? "ok" : "FAIL (marked !)");
+
+	// --- speed at 40 Hz, where the parallel form goes to 12th order
+	printf("\nsingle channel speed at 40 Hz, ns/sample\n");
+	printf("%6s  %10s  %10s  %8s\n", "order", "cascade", "parallel", "speedup");
+	UINT uReps = (UINT)(dSeconds) > 0 ? (UINT)dSeconds : 1;
+	for(UINT uOrder = 4; uOrder <= 16; uOrder += 2)
+	{
+		float fCoeffs[5*PARALLEL_IIR_MAX_SECTIONS];
+		UINT uSections = uOrder/2;
+		calculateButterworthHPFCascade(40.0f, fSampleRate, uOrder, &fCoeffs[0]);
+
+		std::vector<CBiQuad> cascade(uSections);
+		for(UINT k = 0; k < uSections; k++)
+		{
+			cascade[k].m_f_a0 = fCoeffs[5*k];
+			cascade[k].m_f_a1 = fCoeffs[5*k + 1];
+			cascade[k].m_f_a2 = fCoeffs[5*k + 2];
+			cascade[k].m_f_b1 = fCoeffs[5*k + 3];
+			cascade[k].m_f_b2 = fCoeffs[5*k + 4];
+			cascade[k].flushDelays();
+		}
+		CParallelIIR parallel;
+		bool bAccepted = parallel.setFromCascade(&fCoeffs[0], uSections);
+
+		double dNs[2] = {0.0, 0.0};
+		for(UINT m = 0; m < (bAccepted ? 2u : 1u); m++)
+		{
+			benchClock::time_point start = benchClock::now();
+			for(UINT r = 0; r < 4*uReps; r++)
+			{
+				// --- 512 frame buffers, like a host
+				for(UINT n = 0; n + 512 <= uFrames; n += 512)
+				{
+					if(m == 0)
+						runCascade(cascade, &noise[n], &out1[n], 512);
+					else
+						parallel.processBlock(&noise[n], &out2[n], 512);
+				}
+			}
+			double dElapsed = std::chrono::duration<double>(benchClock::now() - start).count();
+			dNs[m] = dElapsed*1.0e9/(4.0*uReps*(uFrames/512)*512);
+		}
+		if(bAccepted)
+			printf("%6u  %10.2f  %10.2f  %7.2fx\n", uOrder, dNs[0], dNs[1], dNs[0]/dNs[1]);
+		else
+			printf("%6u  %10.2f  %10s\n", uOrder, dNs[0], "--");
+	}
+
+	return bPass ? 0 : 1;
+}
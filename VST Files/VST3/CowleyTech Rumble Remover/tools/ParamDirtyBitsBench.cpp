@@ -0,0 +1,165 @@
+/*
+	ParamDirtyBitsBench.cpp
+
+	Checks CParamDirtyBits, the marks the VST3 GUI timer pushes to the
+	controller, and times the timer's side of it.
+
+	Checks:
+		order       indexes marked out of order, some twice, come back once each
+		            and ascending; the next take() finds nothing
+		setAll      take() returns every index up to PARAM_DIRTY_MAX
+		overflow    set() past PARAM_DIRTY_MAX does the same as setAll()
+		threads     "plug-in threads" store a value and then mark its index while
+		            the "GUI timer" keeps taking; every value a take() finds is at
+		            least the one it found before, and once the writers stop the
+		            last take() has found every writer's last value, so no mark
+		            was lost
+
+	Speed:
+		idle take() nothing marked, the timer tick with the plug-in idle
+		set()       one mark
+		take()      64 marks spread over all the words
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -pthread -I../source ParamDirtyBitsBench.cpp \
+			../source/pluginobjects.cpp -o ParamDirtyBitsBench
+
+	Usage:
+		ParamDirtyBitsBench
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "pluginconstants.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+static bool takesEverything(CParamDirtyBits& dirty, UINT* pIndexes)
+{
+	if(dirty.take(pIndexes) != PARAM_DIRTY_MAX)
+		return false;
+
+	for(UINT i = 0; i < PARAM_DIRTY_MAX; i++)
+	{
+		if(pIndexes[i] != i)
+			return false;
+	}
+	return dirty.take(pIndexes) == 0;
+}
+
+int main()
+{
+	bool bPass = true;
+	CParamDirtyBits dirty;
+	std::vector<UINT> indexes(PARAM_DIRTY_MAX);
+
+	// --- order
+	const UINT uMarked[] = {700, 3, 31, 32, 1023, 3, 0, 64, 700, 95};
+	const UINT uExpected[] = {0, 3, 31, 32, 64, 95, 700, 1023};
+	const UINT uExpectedCount = sizeof(uExpected)/sizeof(UINT);
+	for(UINT i = 0; i < sizeof(uMarked)/sizeof(UINT); i++)
+		dirty.set(uMarked[i]);
+
+	UINT uCount = dirty.take(&indexes[0]);
+	bool bOrder = uCount == uExpectedCount && memcmp(&indexes[0], uExpected, sizeof(uExpected)) == 0 &&
+				  dirty.take(&indexes[0]) == 0;
+	printf("order     %u indexes  %s\n", uCount, bOrder ? "ok" : "FAIL");
+	bPass &= bOrder;
+
+	// --- setAll
+	dirty.set(5);
+	dirty.setAll();
+	bool bSetAll = takesEverything(dirty, &indexes[0]);
+	printf("setAll    %s\n", bSetAll ? "ok" : "FAIL");
+	bPass &= bSetAll;
+
+	// --- overflow
+	dirty.set(PARAM_DIRTY_MAX + 5);
+	bool bOverflow = takesEverything(dirty, &indexes[0]);
+	printf("overflow  %s\n", bOverflow ? "ok" : "FAIL");
+	bPass &= bOverflow;
+
+	// --- threads: each writer owns every uWriters'th index
+	const UINT uWriters = 3;
+	const UINT uGenerations = 100000;
+	std::vector<std::atomic<UINT>> values(PARAM_DIRTY_MAX);
+	std::vector<UINT> seen(PARAM_DIRTY_MAX, 0);
+	for(UINT i = 0; i < PARAM_DIRTY_MAX; i++)
+		values[i].store(0);
+
+	std::atomic<UINT> uRunning(uWriters);
+	std::vector<std::thread> writers;
+	for(UINT w = 0; w < uWriters; w++)
+	{
+		writers.push_back(std::thread([&, w]()
+		{
+			for(UINT uGeneration = 1; uGeneration <= uGenerations; uGeneration++)
+			{
+				UINT uIndex = w + uWriters*(uGeneration % (PARAM_DIRTY_MAX/uWriters));
+				values[uIndex].store(uGeneration, std::memory_order_relaxed);
+				dirty.set(uIndex);
+			}
+			uRunning--;
+		}));
+	}
+
+	bool bMonotonic = true;
+	UINT uTakes = 0;
+	for(bool bLast = false; !bLast; )
+	{
+		bLast = uRunning.load() == 0;
+		uCount = dirty.take(&indexes[0]);
+		for(UINT i = 0; i < uCount; i++)
+		{
+			UINT uValue = values[indexes[i]].load(std::memory_order_relaxed);
+			bMonotonic &= uValue > 0 && uValue >= seen[indexes[i]];
+			seen[indexes[i]] = uValue;
+		}
+		uTakes++;
+	}
+	for(UINT w = 0; w < uWriters; w++)
+		writers[w].join();
+
+	bool bComplete = true;
+	for(UINT i = 0; i < PARAM_DIRTY_MAX; i++)
+		bComplete &= seen[i] == values[i].load();
+
+	bool bThreads = bMonotonic && bComplete;
+	printf("threads   %u writers, %u takes  %s\n", uWriters, uTakes, bThreads ? "ok" : "FAIL");
+	bPass &= bThreads;
+
+	// --- speed
+	const UINT uRuns = 1000000;
+	UINT uSink = 0;
+	benchClock::time_point start = benchClock::now();
+	for(UINT n = 0; n < uRuns; n++)
+		uSink += dirty.take(&indexes[0]);
+	double dIdleNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/uRuns;
+
+	start = benchClock::now();
+	for(UINT n = 0; n < uRuns; n++)
+		dirty.set(n & (PARAM_DIRTY_MAX - 1));
+	double dSetNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/uRuns;
+	dirty.take(&indexes[0]);
+
+	const UINT uTakeRuns = 100000;
+	double dTakeNs = 0.0;
+	for(UINT n = 0; n < uTakeRuns; n++)
+	{
+		for(UINT i = 0; i < 64; i++)
+			dirty.set(i*(PARAM_DIRTY_MAX/64) + (n & 15));
+		start = benchClock::now();
+		uSink += dirty.take(&indexes[0]);
+		dTakeNs += std::chrono::duration<double, std::nano>(benchClock::now() - start).count();
+	}
+
+	printf("\nidle take() %8.1f ns\n", dIdleNs);
+	printf("set()       %8.1f ns\n", dSetNs);
+	printf("take()      %8.1f ns for 64 marks\n", dTakeNs/uTakeRuns);
+
+	return bPass && uSink == 64*uTakeRuns ? 0 : 1;
+}
@@ -0,0 +1,446 @@
+/*
+	RafxStressHarness.cpp
+
+	Multi-instance stress harness for the RackAFX core.
+
+	Creates N plugin instances through CRafxPluginFactory, spreads them across T
+	pinned worker threads (the way a busy host spreads tracks across its audio
+	workers) and drives them with realistic, randomly varying buffer sizes and
+	random parameter automation. For each (N, T) point it reports the aggregate
+	throughput (as a multiple of realtime) and the per-block latency tail.
+
+	The per-sample loop mirrors Processor::process() so the numbers reflect what
+	the VST3 wrapper does, without needing the VST SDK to build.
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source RafxStressHarness.cpp \
+			../source/plugin.cpp ../source/pluginobjects.cpp ../source/SimpleHPF.cpp \
+			../source/RafxPluginFactory.cpp ../source/RackAFXGUIFactory.cpp ../source/FFTConvolver.cpp \
+			../source/SpectrumAnalyzer.cpp ../source/ResponseCurve.cpp ../source/StereoAnalyzer.cpp \
+			-lpthread -o RafxStressHarness
+
+	(on macOS add -I<path to a folder with MacTypes.h> if the SDK headers are not
+	 on the include path)
+
+	Usage:
+		RafxStressHarness [-n 1,8,64,256] [-t 1,2,4] [-s seconds] [-fs 44100] [-shared]
+		RafxStressHarness -construct [-n 1,8,64,256]
+
+		-n       comma separated list of instance counts
+		-t       comma separated list of thread counts (default 1,2,4,...,cores)
+		-s       seconds to run each (N, T) point (default 1.0)
+		-fs      sample rate (default 44100)
+		-shared  all instances read/write ONE shared input/output buffer pair,
+		         like the dummyInputL/R globals in VSTProcessor.cpp; this shows
+		         the cost of cross-thread cache-line sharing
+		-construct  instead of processing, time instance creation/destruction
+		         (what a host pays when scanning or restoring a session) for
+		         batches of N instances; "faults" counts the fresh pages each
+		         creation touches (Linux/macOS), which is most of the cost once
+		         a batch no longer fits in memory the allocator already has
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <random>
+
+#if defined _WINDOWS || defined _WINDLL || defined _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sys/resource.h>
+#endif
+
+#include "RafxPluginFactory.h"
+
+// --- plugin.cpp references the MacOS VST bundle path; unused here
+#if !defined _WINDOWS && !defined _WINDLL && !defined _WIN32
+char gPath = 0;
+#endif
+
+// --- buffer sizes hosts commonly use
+static const int g_nBufferSizes[] = {32, 64, 128, 256, 512, 1024};
+static const int g_nNumBufferSizes = sizeof(g_nBufferSizes)/sizeof(int);
+static const int MAX_BUFFER_SIZE = 1024;
+
+// --- one shared pair of buffers for -shared mode (the dummyInputL/R pattern)
+static float g_fSharedInL[MAX_BUFFER_SIZE];
+static float g_fSharedInR[MAX_BUFFER_SIZE];
+static float g_fSharedOutL[MAX_BUFFER_SIZE];
+static float g_fSharedOutR[MAX_BUFFER_SIZE];
+
+struct CHarnessInstance
+{
+	CPlugIn* pPlugIn;
+	float* pInL;
+	float* pInR;
+	float* pOutL;
+	float* pOutR;
+};
+
+struct CHarnessThreadResult
+{
+	std::vector<float> fBlockLatency_us;	// --- one entry per instance-block
+	unsigned long long uSamples;			// --- samples per channel processed
+	unsigned long long uDeadlineMisses;		// --- blocks slower than their realtime budget
+};
+
+// --- pin the calling thread to a core
+static void pinThisThread(int nCore)
+{
+#if defined _WINDOWS || defined _WINDLL || defined _WIN32
+	SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << nCore);
+#elif defined __linux__
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(nCore, &set);
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+	// --- MacOS has no hard affinity; threads float
+	(void)nCore;
+#endif
+}
+
+// --- the same per-frame loop as Processor::process()
+static void processBlock(CHarnessInstance& inst, int nSamples)
+{
+	CPlugIn* pPlugIn = inst.pPlugIn;
+
+	if(pPlugIn->m_bWantVSTBuffers)
+	{
+		float* pIn[2] = {inst.pInL, inst.pInR};
+		float* pOut[2] = {inst.pOutL, inst.pOutR};
+		pPlugIn->processVSTAudioBuffer(&pIn[0], &pOut[0], 2, nSamples);
+		return;
+	}
+
+	float fInputs[2]; fInputs[0] = 0.0; fInputs[1] = 0.0;
+	float fOutputs[2]; fOutputs[0] = 0.0; fOutputs[1] = 0.0;
+
+	for(int sample = 0; sample < nSamples; sample++)
+	{
+		fInputs[0] = inst.pInL[sample];
+		fInputs[1] = inst.pInR[sample];
+
+		pPlugIn->processAudioFrame(&fInputs[0], &fOutputs[0], 2, 2);
+
+		inst.pOutL[sample] = fOutputs[0];
+		inst.pOutR[sample] = fOutputs[1];
+	}
+}
+
+static void workerThread(int nCore, std::vector<CHarnessInstance>* pInstances, double dSeconds, int nSampleRate,
+						 std::atomic<int>* pReady, std::atomic<bool>* pGo, unsigned int uSeed, CHarnessThreadResult* pResult)
+{
+	pinThisThread(nCore);
+
+	std::mt19937 rng(uSeed);
+	std::uniform_int_distribution<int> pickBuffer(0, g_nNumBufferSizes - 1);
+	std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+	pResult->uSamples = 0;
+	pResult->uDeadlineMisses = 0;
+	pResult->fBlockLatency_us.reserve(1 << 16);
+
+	// --- wait for everyone so the threads contend for the whole run
+	pReady->fetch_add(1);
+	while(!pGo->load())
+		std::this_thread::yield();
+
+	typedef std::chrono::steady_clock clock;
+	clock::time_point tEnd = clock::now() + std::chrono::microseconds((long long)(dSeconds*1000000.0));
+
+	while(clock::now() < tEnd)
+	{
+		// --- one host cycle: every instance on this thread gets one buffer
+		int nSamples = g_nBufferSizes[pickBuffer(rng)];
+		float fBudget_us = 1000000.0f*(float)nSamples/(float)nSampleRate;
+
+		for(size_t i = 0; i < pInstances->size(); i++)
+		{
+			CHarnessInstance& inst = (*pInstances)[i];
+
+			clock::time_point t0 = clock::now();
+
+			// --- random automation: about one block in four touches a control,
+			//     exactly like a host parameter queue flushed before process()
+			if(unit(rng) < 0.25f)
+			{
+				int nCount = inst.pPlugIn->m_UIControlList.count();
+				if(nCount > 0)
+				{
+					UINT uIndex = (UINT)(unit(rng)*nCount) % nCount;
+					inst.pPlugIn->setParameter(uIndex, unit(rng));
+				}
+			}
+
+			processBlock(inst, nSamples);
+
+			float fElapsed_us = std::chrono::duration<float, std::micro>(clock::now() - t0).count();
+			pResult->fBlockLatency_us.push_back(fElapsed_us);
+			if(fElapsed_us > fBudget_us)
+				pResult->uDeadlineMisses++;
+			pResult->uSamples += nSamples;
+		}
+	}
+}
+
+static float percentile(std::vector<float>& values, double dPct)
+{
+	if(values.empty())
+		return 0.0f;
+
+	size_t n = (size_t)(dPct*(double)(values.size() - 1));
+	std::nth_element(values.begin(), values.begin() + n, values.end());
+	return values[n];
+}
+
+static void fillNoise(float* pBuffer, int nSamples, std::mt19937& rng)
+{
+	// --- rumble-ish test signal: low frequency sine plus broadband noise
+	std::uniform_real_distribution<float> noise(-0.25f, 0.25f);
+	for(int i = 0; i < nSamples; i++)
+		pBuffer[i] = 0.5f*(float)sin(2.0*3.14159265358979*30.0*i/44100.0) + noise(rng);
+}
+
+static void runPoint(int nInstances, int nThreads, double dSeconds, int nSampleRate, bool bShared)
+{
+	std::mt19937 rng(1234 + nInstances*31 + nThreads);
+	int nCores = (int)std::thread::hardware_concurrency();
+	if(nCores <= 0) nCores = 1;
+
+	// --- create the instances the way the VST3 Processor does
+	std::vector<CPlugIn*> plugins;
+	std::vector<float> privateBuffers;
+	if(!bShared)
+		privateBuffers.resize((size_t)nInstances*4*MAX_BUFFER_SIZE);
+
+	std::vector< std::vector<CHarnessInstance> > perThread(nThreads);
+	for(int i = 0; i < nInstances; i++)
+	{
+		CPlugIn* pPlugIn = CRafxPluginFactory::getRafxPlugIn();
+		pPlugIn->m_nSampleRate = nSampleRate;
+		pPlugIn->initialize();
+		pPlugIn->prepareForPlay();
+		plugins.push_back(pPlugIn);
+
+		CHarnessInstance inst;
+		inst.pPlugIn = pPlugIn;
+		if(bShared)
+		{
+			inst.pInL = &g_fSharedInL[0];
+			inst.pInR = &g_fSharedInR[0];
+			inst.pOutL = &g_fSharedOutL[0];
+			inst.pOutR = &g_fSharedOutR[0];
+		}
+		else
+		{
+			float* pBase = &privateBuffers[(size_t)i*4*MAX_BUFFER_SIZE];
+			inst.pInL = pBase;
+			inst.pInR = pBase + MAX_BUFFER_SIZE;
+			inst.pOutL = pBase + 2*MAX_BUFFER_SIZE;
+			inst.pOutR = pBase + 3*MAX_BUFFER_SIZE;
+			fillNoise(inst.pInL, MAX_BUFFER_SIZE, rng);
+			fillNoise(inst.pInR, MAX_BUFFER_SIZE, rng);
+		}
+
+		// --- round robin across the workers
+		perThread[i % nThreads].push_back(inst);
+	}
+
+	if(bShared)
+	{
+		fillNoise(&g_fSharedInL[0], MAX_BUFFER_SIZE, rng);
+		fillNoise(&g_fSharedInR[0], MAX_BUFFER_SIZE, rng);
+	}
+
+	std::vector<CHarnessThreadResult> results(nThreads);
+	std::vector<std::thread> threads;
+	std::atomic<int> nReady(0);
+	std::atomic<bool> bGo(false);
+
+	for(int t = 0; t < nThreads; t++)
+		threads.push_back(std::thread(workerThread, t % nCores, &perThread[t], dSeconds, nSampleRate,
+									  &nReady, &bGo, (unsigned int)(77 + t), &results[t]));
+
+	while(nReady.load() < nThreads)
+		std::this_thread::yield();
+
+	std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+	bGo.store(true);
+
+	for(int t = 0; t < nThreads; t++)
+		threads[t].join();
+
+	double dWall = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	// --- merge
+	std::vector<float> latency;
+	unsigned long long uSamples = 0;
+	unsigned long long uMisses = 0;
+	for(int t = 0; t < nThreads; t++)
+	{
+		latency.insert(latency.end(), results[t].fBlockLatency_us.begin(), results[t].fBlockLatency_us.end());
+		uSamples += results[t].uSamples;
+		uMisses += results[t].uDeadlineMisses;
+	}
+
+	double dRealtime = (double)uSamples/((double)nSampleRate*dWall);
+	float fMax = latency.empty() ? 0.0f : *std::max_element(latency.begin(), latency.end());
+
+	printf("%6d %4d %12.1f %10.1f %9.2f %9.2f %9.2f %9.2f %8llu\n",
+		   nInstances, nThreads, dRealtime, dRealtime/(double)nInstances,
+		   percentile(latency, 0.50), percentile(latency, 0.99), percentile(latency, 0.999), fMax, uMisses);
+	fflush(stdout);
+
+	for(size_t i = 0; i < plugins.size(); i++)
+		delete plugins[i];
+}
+
+// --- page faults so far; none counted on Windows
+static long minorFaults()
+{
+#if defined _WINDOWS || defined _WINDLL || defined _WIN32
+	return 0;
+#else
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_minflt;
+#endif
+}
+
+// --- creation cost: construct (and initialize) N instances, then destroy them
+static void runConstruct(int nInstances, int nSampleRate)
+{
+	typedef std::chrono::steady_clock clock;
+	std::vector<CPlugIn*> plugins(nInstances);
+
+	// --- repeat small batches so the numbers are stable
+	int nRepeats = 1 + 20000/nInstances;
+	std::vector<float> createTimes;
+	double dCreate_us = 0.0;
+	double dDestroy_us = 0.0;
+	long nFaults = 0;
+
+	for(int r = 0; r < nRepeats; r++)
+	{
+		long nFaultsBefore = minorFaults();
+		for(int i = 0; i < nInstances; i++)
+		{
+			clock::time_point t0 = clock::now();
+			CPlugIn* pPlugIn = CRafxPluginFactory::getRafxPlugIn();
+			pPlugIn->m_nSampleRate = nSampleRate;
+			pPlugIn->initialize();
+			float fElapsed_us = std::chrono::duration<float, std::micro>(clock::now() - t0).count();
+
+			createTimes.push_back(fElapsed_us);
+			dCreate_us += fElapsed_us;
+			plugins[i] = pPlugIn;
+		}
+		nFaults += minorFaults() - nFaultsBefore;
+
+		clock::time_point t0 = clock::now();
+		for(int i = 0; i < nInstances; i++)
+			delete plugins[i];
+		dDestroy_us += std::chrono::duration<double, std::micro>(clock::now() - t0).count();
+	}
+
+	int nTotal = nRepeats*nInstances;
+	printf("%6d %12.3f %9.3f %9.3f %12.3f %8.1f\n", nInstances, dCreate_us/nTotal,
+		   percentile(createTimes, 0.50), percentile(createTimes, 0.99), dDestroy_us/nTotal,
+		   (double)nFaults/nTotal);
+	fflush(stdout);
+}
+
+static std::vector<int> parseList(const char* pList)
+{
+	std::vector<int> list;
+	std::string s(pList);
+	size_t pos = 0;
+	while(pos < s.size())
+	{
+		size_t comma = s.find(',', pos);
+		if(comma == std::string::npos)
+			comma = s.size();
+		int n = atoi(s.substr(pos, comma - pos).c_str());
+		if(n > 0)
+			list.push_back(n);
+		pos = comma + 1;
+	}
+	return list;
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<int> instanceCounts = parseList("1,8,64,256");
+	std::vector<int> threadCounts;
+	double dSeconds = 1.0;
+	int nSampleRate = 44100;
+	bool bShared = false;
+	bool bConstruct = false;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			instanceCounts = parseList(argv[++i]);
+		else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			threadCounts = parseList(argv[++i]);
+		else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			dSeconds = atof(argv[++i]);
+		else if(strcmp(argv[i], "-fs") == 0 && i + 1 < argc)
+			nSampleRate = atoi(argv[++i]);
+		else if(strcmp(argv[i], "-shared") == 0)
+			bShared = true;
+		else if(strcmp(argv[i], "-construct") == 0)
+			bConstruct = true;
+		else
+		{
+			printf("usage: %s [-n 1,8,64,256] [-t 1,2,4] [-s seconds] [-fs 44100] [-shared] [-construct]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if(bConstruct)
+	{
+		printf("RAFX instance creation\n");
+		printf("%6s %12s %9s %9s %12s %8s\n", "inst", "create us", "p50 us", "p99 us", "destroy us", "faults");
+		for(size_t n = 0; n < instanceCounts.size(); n++)
+			runConstruct(instanceCounts[n], nSampleRate);
+		return 0;
+	}
+
+	// --- default thread sweep: 1, 2, 4 ... up to the core count
+	if(threadCounts.empty())
+	{
+		int nCores = (int)std::thread::hardware_concurrency();
+		if(nCores <= 0) nCores = 1;
+		for(int t = 1; t < nCores; t *= 2)
+			threadCounts.push_back(t);
+		threadCounts.push_back(nCores);
+	}
+
+	printf("RAFX stress harness: %d Hz, %.2f s per point, %s buffers\n", nSampleRate, dSeconds, bShared ? "shared" : "per-instance");
+	printf("%6s %4s %12s %10s %9s %9s %9s %9s %8s\n",
+		   "inst", "thr", "x realtime", "x rt/inst", "p50 us", "p99 us", "p99.9 us", "max us", "misses");
+
+	for(size_t n = 0; n < instanceCounts.size(); n++)
+	{
+		for(size_t t = 0; t < threadCounts.size(); t++)
+		{
+			// --- more threads than instances just leaves workers idle
+			if(threadCounts[t] > instanceCounts[n])
+				continue;
+
+			runPoint(instanceCounts[n], threadCounts[t], dSeconds, nSampleRate, bShared);
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,158 @@
+/*
+	ResponseCurveBench.cpp
+
+	Checks CResponseCurve against a double precision evaluation of the same
+	coefficients and times it.
+
+	Cases (48 kHz, all 256 display points):
+		b2hpf     2nd order Butterworth HPF at 20 Hz (the dynamic mode's filter)
+		b8hpf     8th order Butterworth HPF at 20 Hz, 4 sections
+		lr4       LR4 low band at -12 dB plus the high band at 100 Hz, two branches
+		fir       the linear phase HPF's 8191 tap FIR at 40 Hz
+
+	Error is the worst magnitude difference in dB over the points where the
+	reference is above -100 dB, and the worst phase difference there in
+	degrees. Speed is us per full evaluation, and ns per getSnapshot() that
+	finds the curve unchanged (what a view pays on every timer tick).
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source ResponseCurveBench.cpp \
+			../source/ResponseCurve.cpp ../source/FFTConvolver.cpp -o ResponseCurveBench
+
+	Usage:
+		ResponseCurveBench
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex>
+#include <chrono>
+#include <vector>
+
+#include "ResponseCurve.h"
+#include "filtercoeffs.h"
+#include "FFTConvolver.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+typedef std::complex<double> dComplex;
+
+const float BENCH_SAMPLE_RATE = 48000.0;
+
+// --- the same description, evaluated directly in double
+static dComplex referenceResponse(const CFilterDescription& desc, double w)
+{
+	dComplex z1 = std::polar(1.0, -w);
+	dComplex z2 = z1*z1;
+	dComplex H = desc.m_uBranches > 0 ? 0.0 : 1.0;
+
+	for(UINT b = 0; b < desc.m_uBranches; b++)
+	{
+		dComplex h = desc.m_fGain[b];
+		for(UINT k = 0; k < desc.m_uSections[b]; k++)
+		{
+			const float* c = &desc.m_fCoeffs[b][5*k];
+			h *= ((double)c[0] + (double)c[1]*z1 + (double)c[2]*z2)/(1.0 + (double)c[3]*z1 + (double)c[4]*z2);
+		}
+		H += h;
+	}
+
+	if(desc.m_pFIRTaps)
+	{
+		dComplex f = 0.0;
+		for(UINT n = 0; n < desc.m_uFIRLength; n++)
+			f += (double)desc.m_pFIRTaps[n]*std::polar(1.0, -w*n);
+		H *= f;
+	}
+
+	return H;
+}
+
+static void runCase(const char* pName, const CFilterDescription& desc)
+{
+	CResponseCurve curve;
+	curve.setSampleRate(BENCH_SAMPLE_RATE);
+
+	CResponseSnapshot* pSnapshot = new CResponseSnapshot;
+	curve.evaluate(desc, pSnapshot);
+
+	double dMaxdB = 0.0;
+	double dMaxDeg = 0.0;
+	for(UINT i = 0; i < pSnapshot->getCount(); i++)
+	{
+		double w = 2.0*pi*pSnapshot->getFrequencies()[i]/BENCH_SAMPLE_RATE;
+		dComplex H = referenceResponse(desc, w);
+		double dRef_dB = 20.0*log10(std::abs(H) + 1e-30);
+		if(dRef_dB < -100.0)
+			continue;
+
+		double dErr = fabs(pSnapshot->getMagnitude_dB()[i] - dRef_dB);
+		double dPhaseErr = fabs(remainder(pSnapshot->getPhase()[i] - std::arg(H), 2.0*pi))*180.0/pi;
+		if(dErr > dMaxdB) dMaxdB = dErr;
+		if(dPhaseErr > dMaxDeg) dMaxDeg = dPhaseErr;
+	}
+
+	const int nRuns = desc.m_pFIRTaps ? 20 : 2000;
+	benchClock::time_point start = benchClock::now();
+	for(int n = 0; n < nRuns; n++)
+		curve.evaluate(desc, pSnapshot);
+	double dUs = std::chrono::duration<double, std::micro>(benchClock::now() - start).count()/nRuns;
+
+	printf("%-8s  max error %8.5f dB %8.4f deg   %9.1f us/curve\n", pName, dMaxdB, dMaxDeg, dUs);
+	delete pSnapshot;
+}
+
+static void addB2(CFilterDescription& desc, float fCutoff_Hz, bool bHPF)
+{
+	float fCoeffs[5];
+	biquadCoeffArrays coeffs = {&fCoeffs[0], &fCoeffs[1], &fCoeffs[2], &fCoeffs[3], &fCoeffs[4]};
+	if(bHPF)
+		calculateB2HPFCoeffsBatch(&fCutoff_Hz, 1, BENCH_SAMPLE_RATE, coeffs);
+	else
+		calculateB2LPFCoeffsBatch(&fCutoff_Hz, 1, BENCH_SAMPLE_RATE, coeffs);
+	desc.addSections(&fCoeffs[0], 1);
+}
+
+int main()
+{
+	CFilterDescription desc;
+
+	desc.addBranch(1.0);
+	addB2(desc, 20.0, true);
+	runCase("b2hpf", desc);
+
+	float fCascade[20];
+	calculateButterworthHPFCascade(20.0, BENCH_SAMPLE_RATE, 8, &fCascade[0]);
+	desc.clear();
+	desc.addBranch(1.0);
+	desc.addSections(&fCascade[0], 4);
+	runCase("b8hpf", desc);
+
+	desc.clear();
+	desc.addBranch(pow(10.0, -12.0/20.0));
+	addB2(desc, 100.0, false);
+	addB2(desc, 100.0, false);
+	desc.addBranch(1.0);
+	addB2(desc, 100.0, true);
+	addB2(desc, 100.0, true);
+	runCase("lr4", desc);
+
+	std::vector<float> taps(8191);
+	CLinearPhaseHPF::designHPF(&taps[0], (UINT)taps.size(), 40.0, BENCH_SAMPLE_RATE);
+	desc.clear();
+	desc.setLinearPhaseFIR(&taps[0], (UINT)taps.size());
+	runCase("fir", desc);
+
+	// --- unchanged curve: one atomic load and a shared_ptr copy per call
+	CResponseCurve curve;
+	curve.getSnapshot();
+	const int nCalls = 10000000;
+	UINT uHits = 0;
+	benchClock::time_point start = benchClock::now();
+	for(int n = 0; n < nCalls; n++)
+		uHits += curve.getSnapshot() ? 0 : 1;
+	double dNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/nCalls;
+	printf("\ncached    %6.2f ns/getSnapshot() (%u calls)\n", dNs, uHits);
+
+	return 0;
+}
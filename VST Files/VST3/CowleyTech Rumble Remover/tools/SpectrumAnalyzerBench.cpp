@@ -0,0 +1,134 @@
+/*
+	SpectrumAnalyzerBench.cpp
+
+	Checks CSpectrumAnalyzer's level calibration and times both of its sides.
+
+	Calibration: full scale sines at 25 Hz ... 10 kHz, 48 kHz; the peak of the
+	display should read 0 dB (within about 1 dB at the low end, where the
+	1/6 octave band is narrower than a bin) at the sine's frequency.
+
+	Speed:
+		push      ns per stereo frame on the audio thread, with the worker
+		          running as it does while the view is open
+		idle      the same with no view open (the analyzer stopped)
+		analyze   us per update on the worker (copy, window, FFT, smoothing)
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source SpectrumAnalyzerBench.cpp \
+			../source/SpectrumAnalyzer.cpp ../source/FFTConvolver.cpp \
+			-o SpectrumAnalyzerBench -lpthread
+
+	Usage:
+		SpectrumAnalyzerBench [-s sample rate]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+
+#include "SpectrumAnalyzer.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+// --- the worker is stopped after the audio went in, so analyze() can be
+//     called here without racing it
+static bool checkSine(float fSampleRate, float fFrequency)
+{
+	CSpectrumAnalyzer* pAnalyzer = new CSpectrumAnalyzer;
+	pAnalyzer->setSampleRate(fSampleRate);
+	pAnalyzer->start();
+
+	for(int n = 0; n < 2*(int)SPECTRUM_MAX_FFT_SIZE; n++)
+	{
+		float fIn[2];
+		fIn[0] = fIn[1] = sin(2.0*pi*fFrequency*n/fSampleRate);
+		pAnalyzer->processFrame(fIn, 2);
+	}
+	pAnalyzer->stop();
+	pAnalyzer->analyze();
+	pAnalyzer->update();
+
+	const float* pSpectrum = pAnalyzer->getSpectrum();
+	const float* pFrequencies = pAnalyzer->getFrequencies();
+	UINT uPeak = 0;
+	for(UINT i = 1; i < SPECTRUM_POINTS; i++)
+		if(pSpectrum[i] > pSpectrum[uPeak])
+			uPeak = i;
+
+	float fOctaves = fabs(log2(pFrequencies[uPeak]/fFrequency));
+	bool bPass = fabs(pSpectrum[uPeak]) < 1.0 && fOctaves < SPECTRUM_SMOOTHING_OCT;
+	printf("%8.1f Hz   peak %6.2f dB at %8.1f Hz   %s\n", fFrequency, pSpectrum[uPeak], pFrequencies[uPeak], bPass ? "ok" : "FAIL");
+
+	delete pAnalyzer;
+	return bPass;
+}
+
+static double timePush(float fSampleRate, bool bRunning)
+{
+	CSpectrumAnalyzer* pAnalyzer = new CSpectrumAnalyzer;
+	pAnalyzer->setSampleRate(fSampleRate);
+	if(bRunning)
+		pAnalyzer->start();
+
+	const int nFrames = 20*(int)fSampleRate;
+	float fIn[2] = {0.0, 0.0};
+
+	benchClock::time_point start = benchClock::now();
+	for(int n = 0; n < nFrames; n++)
+	{
+		fIn[0] = 1e-7f*n;
+		fIn[1] = -fIn[0];
+		pAnalyzer->processFrame(fIn, 2);
+	}
+	double dNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/nFrames;
+
+	if(bRunning)
+		pAnalyzer->stop();
+	delete pAnalyzer;
+	return dNs;
+}
+
+static double timeAnalyze(float fSampleRate)
+{
+	CSpectrumAnalyzer* pAnalyzer = new CSpectrumAnalyzer;
+	pAnalyzer->setSampleRate(fSampleRate);
+	pAnalyzer->analyze();
+
+	const int nRuns = 500;
+	float fIn[2] = {0.1f, 0.2f};
+	double dTotal = 0.0;
+	for(int i = 0; i < nRuns; i++)
+	{
+		// --- one new frame so there is something to analyze
+		pAnalyzer->start();
+		pAnalyzer->processFrame(fIn, 2);
+		pAnalyzer->stop();
+
+		benchClock::time_point start = benchClock::now();
+		pAnalyzer->analyze();
+		dTotal += std::chrono::duration<double, std::micro>(benchClock::now() - start).count();
+	}
+
+	delete pAnalyzer;
+	return dTotal/nRuns;
+}
+
+int main(int argc, char* argv[])
+{
+	float fSampleRate = 48000.0;
+	for(int i = 1; i < argc - 1; i++)
+		if(strcmp(argv[i], "-s") == 0)
+			fSampleRate = (float)atof(argv[i + 1]);
+
+	static const float fFrequencies[] = {25.0, 31.5, 63.0, 100.0, 1000.0, 10000.0};
+	bool bPass = true;
+	for(UINT i = 0; i < sizeof(fFrequencies)/sizeof(float); i++)
+		bPass &= checkSine(fSampleRate, fFrequencies[i]);
+
+	printf("\npush     %6.2f ns/frame\n", timePush(fSampleRate, true));
+	printf("idle     %6.2f ns/frame\n", timePush(fSampleRate, false));
+	printf("analyze  %6.1f us/update (every %u ms)\n", timeAnalyze(fSampleRate), SPECTRUM_UPDATE_MSEC);
+
+	return bPass ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+/*
+	StereoAnalyzerBench.cpp
+
+	Checks CStereoAnalyzer's readings and times it on the audio thread.
+
+	Readings, 1 kHz sines at 0.5 after the averages settled:
+		mono          correlation +1, mid = channel RMS, no side
+		inverted      correlation -1, no mid
+		quadrature    R 90 degrees behind L: correlation 0, mid = side
+		left only     right silent: correlation 0 (nothing to correlate)
+	and the frame path and the block path publish the same snapshot.
+
+	Speed, ns per stereo frame:
+		frame     processFrame() with a view open, staging into blocks
+		block     processBlock() over 512 frame buffers
+		idle      processFrame() with no view open
+		naive     a per sample version (three one-pole averages updated every
+		          frame, correlation and mid/side worked out every frame), for
+		          comparison
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source StereoAnalyzerBench.cpp \
+			../source/StereoAnalyzer.cpp -o StereoAnalyzerBench
+
+	Usage:
+		StereoAnalyzerBench [-s sample rate]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "StereoAnalyzer.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+static void makeSines(float fSampleRate, float fPhase, UINT uFrames, std::vector<float>& left, std::vector<float>& right)
+{
+	left.resize(uFrames);
+	right.resize(uFrames);
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		left[n] = 0.5*sin(2.0*pi*1000.0*n/fSampleRate);
+		right[n] = 0.5*sin(2.0*pi*1000.0*n/fSampleRate - fPhase);
+	}
+}
+
+static bool near(float fValue, float fExpected, float fTolerance)
+{
+	return fabs(fValue - fExpected) <= fTolerance;
+}
+
+static bool checkCase(const char* pName, float fSampleRate, const std::vector<float>& left, const std::vector<float>& right,
+					  float fCorrelation, float fMidRMS, float fSideRMS)
+{
+	CStereoAnalyzer frames, blocks;
+	frames.setSampleRate(fSampleRate);
+	blocks.setSampleRate(fSampleRate);
+	frames.start();
+	blocks.start();
+
+	for(UINT n = 0; n < left.size(); n++)
+	{
+		float fIn[2] = {left[n], right[n]};
+		frames.processFrame(fIn, 2);
+	}
+	for(UINT n = 0; n < left.size(); n += 333)
+	{
+		UINT uFrames = left.size() - n < 333 ? left.size() - n : 333;
+		blocks.processBlock(&left[n], &right[n], uFrames);
+	}
+
+	frames.update();
+	blocks.update();
+	const stereoSnapshot& a = frames.getSnapshot();
+	const stereoSnapshot& b = blocks.getSnapshot();
+
+	bool bSame = a.fCorrelation == b.fCorrelation && a.fLeftRMS == b.fLeftRMS && a.fRightRMS == b.fRightRMS &&
+				 a.fMidRMS == b.fMidRMS && a.fSideRMS == b.fSideRMS && a.uPointCount == b.uPointCount &&
+				 memcmp(a.fSide, b.fSide, a.uPointCount*sizeof(float)) == 0 &&
+				 memcmp(a.fMid, b.fMid, a.uPointCount*sizeof(float)) == 0;
+	bool bPass = bSame && a.uPointCount > 0 && near(a.fCorrelation, fCorrelation, 0.02) &&
+				 near(a.fMidRMS, fMidRMS, 0.01) && near(a.fSideRMS, fSideRMS, 0.01);
+
+	printf("%-11s corr %+5.2f  L %5.3f  R %5.3f  mid %5.3f  side %5.3f  %3u points  %s%s\n", pName,
+		a.fCorrelation, a.fLeftRMS, a.fRightRMS, a.fMidRMS, a.fSideRMS, a.uPointCount, bPass ? "ok" : "FAIL", bSame ? "" : " (paths differ)");
+
+	frames.stop();
+	blocks.stop();
+	return bPass;
+}
+
+// --- what a per sample implementation costs
+class CNaiveStereo
+{
+public:
+	CNaiveStereo(float fSampleRate)
+	{
+		m_fCoeff = 1.0 - exp(-1000.0/(STEREO_INTEGRATION_MSEC*fSampleRate));
+		m_fLL = m_fRR = m_fLR = 0.0;
+		fCorrelation = fMid = fSide = 0.0;
+	}
+
+	inline void processFrame(const float* pInput)
+	{
+		m_fLL += m_fCoeff*(pInput[0]*pInput[0] - m_fLL);
+		m_fRR += m_fCoeff*(pInput[1]*pInput[1] - m_fRR);
+		m_fLR += m_fCoeff*(pInput[0]*pInput[1] - m_fLR);
+
+		float fPower = m_fLL*m_fRR;
+		fCorrelation = fPower > 1e-10f ? m_fLR/sqrt(fPower) : 0.0;
+		fMid = sqrt(fabs(0.25f*(m_fLL + m_fRR + 2.0f*m_fLR)));
+		fSide = sqrt(fabs(0.25f*(m_fLL + m_fRR - 2.0f*m_fLR)));
+	}
+
+	float fCorrelation, fMid, fSide;
+
+protected:
+	float m_fCoeff, m_fLL, m_fRR, m_fLR;
+};
+
+int main(int argc, char* argv[])
+{
+	float fSampleRate = 48000.0;
+	for(int i = 1; i < argc - 1; i++)
+		if(strcmp(argv[i], "-s") == 0)
+			fSampleRate = (float)atof(argv[i + 1]);
+
+	// --- 3 s settles the 300 ms averages well past the tolerance
+	UINT uFrames = 3*(UINT)fSampleRate;
+	float fRMS = 0.5/sqrt(2.0);
+	std::vector<float> left, right;
+	bool bPass = true;
+
+	makeSines(fSampleRate, 0.0, uFrames, left, right);
+	bPass &= checkCase("mono", fSampleRate, left, right, 1.0, fRMS, 0.0);
+
+	makeSines(fSampleRate, pi, uFrames, left, right);
+	bPass &= checkCase("inverted", fSampleRate, left, right, -1.0, 0.0, fRMS);
+
+	makeSines(fSampleRate, 0.5*pi, uFrames, left, right);
+	bPass &= checkCase("quadrature", fSampleRate, left, right, 0.0, fRMS/sqrt(2.0), fRMS/sqrt(2.0));
+
+	makeSines(fSampleRate, 0.0, uFrames, left, right);
+	memset(&right[0], 0, uFrames*sizeof(float));
+	bPass &= checkCase("left only", fSampleRate, left, right, 0.0, 0.5*fRMS, 0.5*fRMS);
+
+	// --- speed, over 20 s of decorrelated material
+	uFrames = 20*(UINT)fSampleRate;
+	makeSines(fSampleRate, 1.0, uFrames, left, right);
+	std::vector<float> interleaved(2*uFrames);
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		interleaved[2*n] = left[n];
+		interleaved[2*n + 1] = right[n];
+	}
+
+	double dNs[4];
+	for(int nCase = 0; nCase < 3; nCase++)
+	{
+		CStereoAnalyzer analyzer;
+		analyzer.setSampleRate(fSampleRate);
+		if(nCase != 2)
+			analyzer.start();
+
+		benchClock::time_point start = benchClock::now();
+		if(nCase == 1)
+		{
+			for(UINT n = 0; n + 512 <= uFrames; n += 512)
+				analyzer.processBlock(&left[n], &right[n], 512);
+		}
+		else
+		{
+			for(UINT n = 0; n < uFrames; n++)
+				analyzer.processFrame(&interleaved[2*n], 2);
+		}
+		dNs[nCase] = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/uFrames;
+
+		analyzer.update();
+		if(nCase != 2)
+			analyzer.stop();
+	}
+
+	CNaiveStereo naive(fSampleRate);
+	float fSum = 0.0;
+	benchClock::time_point start = benchClock::now();
+	for(UINT n = 0; n < uFrames; n++)
+	{
+		naive.processFrame(&interleaved[2*n]);
+		fSum += naive.fCorrelation + naive.fMid + naive.fSide;
+	}
+	dNs[3] = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/uFrames;
+
+	printf("\nframe  %6.2f ns/frame\n", dNs[0]);
+	printf("block  %6.2f ns/frame\n", dNs[1]);
+	printf("idle   %6.2f ns/frame\n", dNs[2]);
+	printf("naive  %6.2f ns/frame (%d)\n", dNs[3], (int)fSum & 1);
+
+	return bPass ? 0 : 1;
+}
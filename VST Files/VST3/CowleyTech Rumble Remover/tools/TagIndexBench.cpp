@@ -0,0 +1,148 @@
+/*
+	TagIndexBench.cpp
+
+	Checks CTagIndex against std::map and times the lookup VST3EditorWP does on
+	every mouse move of a drag (tag -> parameter listener), for editors with a
+	few hundred bound controls:
+
+		map       std::map<int32_t, T*>::find, what VST3Editor keeps
+		index     CTagIndex<T>::find over the same tags
+
+	Tags are looked up in a pseudo random order so the branch predictor and the
+	cache do not get to learn one path. "probes" is the worst number of slots
+	one lookup visits.
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -I../source TagIndexBench.cpp -o TagIndexBench
+
+	Usage:
+		TagIndexBench
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <chrono>
+#include <map>
+
+#include "TagIndex.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+// --- stands in for ParameterChangeListener
+typedef struct
+{
+	int32_t nTag;
+} benchListener;
+
+// --- same probing as CTagIndex::find(), counting slots
+class CProbeCounter : public CTagIndex<benchListener>
+{
+public:
+	size_t worstProbe() const
+	{
+		size_t uWorst = 0;
+		size_t uMask = m_Slots.size() - 1;
+		for(size_t s = 0; s < m_Slots.size(); s++)
+		{
+			if(!m_Slots[s].pValue)
+				continue;
+			size_t uProbes = 1;
+			for(size_t i = hash(m_Slots[s].nTag); m_Slots[i].nTag != m_Slots[s].nTag || !m_Slots[i].pValue; i = (i + 1) & uMask)
+				uProbes++;
+			if(uProbes > uWorst)
+				uWorst = uProbes;
+		}
+		return uWorst;
+	}
+};
+
+static bool runCase(const char* pName, const std::vector<int32_t>& tags)
+{
+	std::vector<benchListener> listeners(tags.size());
+	std::map<int32_t, benchListener*> map;
+	CProbeCounter index;
+	for(size_t i = 0; i < tags.size(); i++)
+	{
+		listeners[i].nTag = tags[i];
+		map[tags[i]] = &listeners[i];
+		index.insert(tags[i], &listeners[i]);
+	}
+
+	// --- every tag found, and nothing that is not there
+	for(size_t i = 0; i < tags.size(); i++)
+	{
+		if(index.find(tags[i]) != map[tags[i]])
+		{
+			printf("%-10s FAIL tag %d\n", pName, tags[i]);
+			return false;
+		}
+	}
+	if(index.find(-1) || index.find(1 << 30))
+	{
+		printf("%-10s FAIL found a tag that is not there\n", pName);
+		return false;
+	}
+
+	// --- the order of lookups, as a drag across different controls would be
+	const int nLookups = 20000000;
+	std::vector<int32_t> order(4096);
+	uint32_t uSeed = 1;
+	for(size_t i = 0; i < order.size(); i++)
+	{
+		uSeed = uSeed*1664525u + 1013904223u;
+		order[i] = tags[(uSeed >> 8) % tags.size()];
+	}
+
+	uintptr_t uSum = 0;
+	benchClock::time_point start = benchClock::now();
+	for(int n = 0; n < nLookups; n++)
+		uSum += (uintptr_t)map.find(order[n & 4095])->second;
+	double dMapNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/nLookups;
+
+	start = benchClock::now();
+	for(int n = 0; n < nLookups; n++)
+		uSum -= (uintptr_t)index.find(order[n & 4095]);
+	double dIndexNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/nLookups;
+
+	// --- rebuilding after the views were created
+	const int nRebuilds = 20000;
+	start = benchClock::now();
+	for(int n = 0; n < nRebuilds; n++)
+	{
+		index.clear();
+		index.reserve(map.size());
+		for(std::map<int32_t, benchListener*>::const_iterator it = map.begin(); it != map.end(); it++)
+			index.insert(it->first, it->second);
+	}
+	double dRebuildUs = std::chrono::duration<double, std::micro>(benchClock::now() - start).count()/nRebuilds;
+
+	printf("%-10s %4u tags   map %6.2f ns   index %6.2f ns   probes %u   rebuild %6.2f us (%d)\n",
+		pName, (unsigned int)tags.size(), dMapNs, dIndexNs, (unsigned int)index.worstProbe(), dRebuildUs, (int)(uSum & 1));
+	return true;
+}
+
+int main()
+{
+	bool bPass = true;
+	static const unsigned int uSizes[] = {64, 256, 512};
+	for(unsigned int s = 0; s < sizeof(uSizes)/sizeof(unsigned int); s++)
+	{
+		// --- RackAFX: 0...N-1
+		std::vector<int32_t> tags;
+		for(unsigned int i = 0; i < uSizes[s]; i++)
+			tags.push_back((int32_t)i);
+		bPass &= runCase("dense", tags);
+
+		// --- hand edited uidescs: scattered, and a block up high
+		tags.clear();
+		uint32_t uSeed = 7;
+		for(unsigned int i = 0; i < uSizes[s]; i++)
+		{
+			uSeed = uSeed*1664525u + 1013904223u;
+			tags.push_back(i < uSizes[s]/2 ? (int32_t)(uSeed >> 4) : (int32_t)(60000 + i));
+		}
+		bPass &= runCase("scattered", tags);
+	}
+
+	return bPass ? 0 : 1;
+}
@@ -0,0 +1,113 @@
+/*
+	UidescCompiler.cpp
+
+	The build step for the precompiled editor description: turns a .uidesc into
+	the .uidescbin CCompiledUIDescription loads (see CompiledUIDescription.h).
+	Run it whenever RackAFX.uidesc changes; until then the plugin notices the
+	XML no longer matches and parses the XML as before.
+
+	The XML is read with expat, the parser VSTGUI itself uses, so the events
+	(and the attribute values, entities resolved) are the ones the description
+	would have seen.
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source UidescCompiler.cpp \
+			../source/CompiledUIDescription.cpp -o UidescCompiler -lexpat
+
+	Usage:
+		UidescCompiler ../resources/RackAFX.uidesc ../resources/RackAFX.uidescbin
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <expat.h>
+
+#include "CompiledUIDescription.h"
+
+static void XMLCALL onStartElement(void* pUserData, const XML_Char* pName, const XML_Char** ppAttributes)
+{
+	((CUIDescriptionCompiler*)pUserData)->startElement(pName, ppAttributes);
+}
+
+static void XMLCALL onEndElement(void* pUserData, const XML_Char*)
+{
+	((CUIDescriptionCompiler*)pUserData)->endElement();
+}
+
+static void XMLCALL onCharacters(void* pUserData, const XML_Char* pText, int nLength)
+{
+	((CUIDescriptionCompiler*)pUserData)->characters(pText, (UINT)nLength);
+}
+
+static bool readFile(const char* pPath, std::vector<char>& data)
+{
+	FILE* pFile = fopen(pPath, "rb");
+	if(!pFile)
+		return false;
+
+	char buffer[65536];
+	size_t uRead;
+	while((uRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+		data.insert(data.end(), buffer, buffer + uRead);
+
+	fclose(pFile);
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	if(argc != 3)
+	{
+		printf("usage: UidescCompiler <in.uidesc> <out.uidescbin>\n");
+		return 1;
+	}
+
+	std::vector<char> xml;
+	if(!readFile(argv[1], xml) || xml.empty())
+	{
+		printf("can't read %s\n", argv[1]);
+		return 1;
+	}
+
+	CUIDescriptionCompiler compiler;
+	XML_Parser parser = XML_ParserCreate(NULL);
+	XML_SetUserData(parser, &compiler);
+	XML_SetElementHandler(parser, onStartElement, onEndElement);
+	XML_SetCharacterDataHandler(parser, onCharacters);
+
+	if(XML_Parse(parser, &xml[0], (int)xml.size(), 1) == XML_STATUS_ERROR)
+	{
+		printf("%s:%lu: %s\n", argv[1], (unsigned long)XML_GetCurrentLineNumber(parser), XML_ErrorString(XML_GetErrorCode(parser)));
+		XML_ParserFree(parser);
+		return 1;
+	}
+	XML_ParserFree(parser);
+
+	std::vector<unsigned char> binary;
+	if(!compiler.finish(&xml[0], (UINT)xml.size(), binary))
+	{
+		printf("%s: no complete document\n", argv[1]);
+		return 1;
+	}
+
+	// --- what the plugin will do with it
+	CCompiledUIDescription check;
+	if(!check.load(&binary[0], (UINT)binary.size()))
+	{
+		printf("internal error: the binary does not load\n");
+		return 1;
+	}
+
+	FILE* pFile = fopen(argv[2], "wb");
+	if(!pFile || fwrite(&binary[0], 1, binary.size(), pFile) != binary.size())
+	{
+		printf("can't write %s\n", argv[2]);
+		if(pFile)
+			fclose(pFile);
+		return 1;
+	}
+	fclose(pFile);
+
+	printf("%s: %u bytes of XML -> %s: %u bytes, %u nodes\n", argv[1], (UINT)xml.size(), argv[2], (UINT)binary.size(), check.getNodeCount());
+	return 0;
+}
@@ -0,0 +1,295 @@
+/*
+	UidescLoadBench.cpp
+
+	Times the description part of opening the editor both ways:
+
+		xml        expat (what VSTGUI parses with) over the .uidesc text,
+		           delivering into a node tree built the way UIDescription builds
+		           its UINodes (element name, attribute map, children)
+		compiled   what CCompiledUIDescriptionWP::parse() does instead: hash the
+		           XML to check the binary is current, load (validate) the binary
+		           and replay it into the same tree
+		tags       getTagForName() for every control tag: a scan of the
+		           <control-tags> children comparing names then strtol() as
+		           UIDescription does it, against CCompiledUIDescription::findTag()
+
+	The tree built both ways is compared node by node first.
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source UidescLoadBench.cpp \
+			../source/CompiledUIDescription.cpp -o UidescLoadBench -lexpat
+
+	Usage:
+		UidescLoadBench [file.uidesc ...]     (default ../resources/RackAFX.uidesc)
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <expat.h>
+#include <chrono>
+#include <map>
+
+#include "CompiledUIDescription.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+// --- stands in for UIDescription's UINode tree
+class CBenchNode
+{
+public:
+	CBenchNode(const char* pName, const char** ppAttributes, CBenchNode* pParent)
+	: name(pName)
+	, parent(pParent)
+	{
+		for(int i = 0; ppAttributes[i] && ppAttributes[i + 1]; i += 2)
+			attributes[ppAttributes[i]] = ppAttributes[i + 1];
+	}
+
+	~CBenchNode(void)
+	{
+		for(size_t i = 0; i < children.size(); i++)
+			delete children[i];
+	}
+
+	std::string name;
+	std::string data;
+	std::map<std::string, std::string> attributes;
+	std::vector<CBenchNode*> children;
+	CBenchNode* parent;
+};
+
+class CTreeBuilder : public IUIDescriptionHandler
+{
+public:
+	CTreeBuilder(void) {pRoot = NULL; pCurrent = NULL;}
+	~CTreeBuilder(void) {delete pRoot;}
+
+	void startElement(const char* pName, const char** ppAttributes)
+	{
+		CBenchNode* pNode = new CBenchNode(pName, ppAttributes, pCurrent);
+		if(pCurrent)
+			pCurrent->children.push_back(pNode);
+		else
+			pRoot = pNode;
+		pCurrent = pNode;
+	}
+
+	void characters(const char* pText, UINT uLength)
+	{
+		if(pCurrent)
+			pCurrent->data.append(pText, uLength);
+	}
+
+	void endElement(const char*)
+	{
+		if(pCurrent)
+			pCurrent = pCurrent->parent;
+	}
+
+	CBenchNode* pRoot;
+	CBenchNode* pCurrent;
+};
+
+static void XMLCALL onStartElement(void* pUserData, const XML_Char* pName, const XML_Char** ppAttributes)
+{
+	((CTreeBuilder*)pUserData)->startElement(pName, ppAttributes);
+}
+
+static void XMLCALL onEndElement(void* pUserData, const XML_Char* pName)
+{
+	((CTreeBuilder*)pUserData)->endElement(pName);
+}
+
+static void XMLCALL onCharacters(void* pUserData, const XML_Char* pText, int nLength)
+{
+	((CTreeBuilder*)pUserData)->characters(pText, (UINT)nLength);
+}
+
+static bool parseXML(const std::vector<char>& xml, CTreeBuilder& builder)
+{
+	XML_Parser parser = XML_ParserCreate(NULL);
+	XML_SetUserData(parser, &builder);
+	XML_SetElementHandler(parser, onStartElement, onEndElement);
+	XML_SetCharacterDataHandler(parser, onCharacters);
+	bool bOK = XML_Parse(parser, &xml[0], (int)xml.size(), 1) != XML_STATUS_ERROR;
+	XML_ParserFree(parser);
+	return bOK;
+}
+
+static bool loadCompiled(const std::vector<char>& xml, const std::vector<uint32_t>& binary, UINT uBinarySize, CCompiledUIDescription& compiled, CTreeBuilder& builder)
+{
+	if(!compiled.load(&binary[0], uBinarySize) || !compiled.matchesSource(&xml[0], (UINT)xml.size()))
+		return false;
+
+	compiled.replay(&builder);
+	return true;
+}
+
+// --- whitespace-only character data is dropped by the compiler, so compare trimmed
+static std::string trimmed(const std::string& str)
+{
+	size_t uFirst = str.find_first_not_of(" \t\r\n");
+	if(uFirst == std::string::npos)
+		return std::string();
+	return str.substr(uFirst, str.find_last_not_of(" \t\r\n") - uFirst + 1);
+}
+
+static bool sameTree(const CBenchNode* pA, const CBenchNode* pB)
+{
+	if(pA->name != pB->name || pA->attributes != pB->attributes || trimmed(pA->data) != trimmed(pB->data) || pA->children.size() != pB->children.size())
+		return false;
+
+	for(size_t i = 0; i < pA->children.size(); i++)
+		if(!sameTree(pA->children[i], pB->children[i]))
+			return false;
+
+	return true;
+}
+
+// --- UIDescription::getTagForName(): find the control-tag node, then the number
+static int scanTag(const CBenchNode* pRoot, const char* pName)
+{
+	for(size_t i = 0; i < pRoot->children.size(); i++)
+	{
+		const CBenchNode* pTags = pRoot->children[i];
+		if(pTags->name != "control-tags")
+			continue;
+
+		for(size_t t = 0; t < pTags->children.size(); t++)
+		{
+			std::map<std::string, std::string>::const_iterator it = pTags->children[t]->attributes.find("name");
+			if(it != pTags->children[t]->attributes.end() && it->second == pName)
+			{
+				std::map<std::string, std::string>::const_iterator tag = pTags->children[t]->attributes.find("tag");
+				return tag == pTags->children[t]->attributes.end() ? -1 : (int)strtol(tag->second.c_str(), 0, 10);
+			}
+		}
+	}
+	return -1;
+}
+
+static bool runFile(const char* pPath)
+{
+	std::vector<char> xml;
+	FILE* pFile = fopen(pPath, "rb");
+	if(!pFile)
+	{
+		printf("can't read %s\n", pPath);
+		return false;
+	}
+	char buffer[65536];
+	size_t uRead;
+	while((uRead = fread(buffer, 1, sizeof(buffer), pFile)) > 0)
+		xml.insert(xml.end(), buffer, buffer + uRead);
+	fclose(pFile);
+
+	// --- compile, as tools/UidescCompiler does
+	CUIDescriptionCompiler compiler;
+	{
+		CTreeBuilder reference;
+		if(!parseXML(xml, reference))
+		{
+			printf("%s: not well formed\n", pPath);
+			return false;
+		}
+	}
+	XML_Parser parser = XML_ParserCreate(NULL);
+	XML_SetUserData(parser, &compiler);
+	XML_SetElementHandler(parser,
+		[](void* p, const XML_Char* pName, const XML_Char** ppAttributes) {((CUIDescriptionCompiler*)p)->startElement(pName, ppAttributes);},
+		[](void* p, const XML_Char*) {((CUIDescriptionCompiler*)p)->endElement();});
+	XML_SetCharacterDataHandler(parser, [](void* p, const XML_Char* pText, int nLength) {((CUIDescriptionCompiler*)p)->characters(pText, (UINT)nLength);});
+	XML_Parse(parser, &xml[0], (int)xml.size(), 1);
+	XML_ParserFree(parser);
+
+	std::vector<unsigned char> bytes;
+	compiler.finish(&xml[0], (UINT)xml.size(), bytes);
+	std::vector<uint32_t> binary((bytes.size() + 3)/4);
+	memcpy(&binary[0], &bytes[0], bytes.size());
+
+	// --- same tree both ways
+	CTreeBuilder fromXML, fromBinary;
+	CCompiledUIDescription compiled;
+	parseXML(xml, fromXML);
+	if(!loadCompiled(xml, binary, (UINT)bytes.size(), compiled, fromBinary) || !sameTree(fromXML.pRoot, fromBinary.pRoot))
+	{
+		printf("%s: FAIL, the replayed tree differs\n", pPath);
+		return false;
+	}
+
+	std::vector<std::string> tagNames;
+	for(size_t i = 0; i < fromXML.pRoot->children.size(); i++)
+		if(fromXML.pRoot->children[i]->name == "control-tags")
+			for(size_t t = 0; t < fromXML.pRoot->children[i]->children.size(); t++)
+				tagNames.push_back(fromXML.pRoot->children[i]->children[t]->attributes["name"]);
+
+	for(size_t i = 0; i < tagNames.size(); i++)
+	{
+		int nTag = -1;
+		compiled.findTag(tagNames[i].c_str(), nTag);
+		if(nTag != scanTag(fromXML.pRoot, tagNames[i].c_str()))
+		{
+			printf("%s: FAIL, tag %s differs\n", pPath, tagNames[i].c_str());
+			return false;
+		}
+	}
+
+	const int nRuns = 2000;
+	benchClock::time_point start = benchClock::now();
+	for(int n = 0; n < nRuns; n++)
+	{
+		CTreeBuilder builder;
+		parseXML(xml, builder);
+	}
+	double dXMLUs = std::chrono::duration<double, std::micro>(benchClock::now() - start).count()/nRuns;
+
+	start = benchClock::now();
+	for(int n = 0; n < nRuns; n++)
+	{
+		CTreeBuilder builder;
+		CCompiledUIDescription description;
+		loadCompiled(xml, binary, (UINT)bytes.size(), description, builder);
+	}
+	double dCompiledUs = std::chrono::duration<double, std::micro>(benchClock::now() - start).count()/nRuns;
+
+	// --- tag lookups, every name many times
+	const int nLookups = 200000;
+	int nSum = 0;
+	double dScanNs = 0.0, dFindNs = 0.0;
+	if(!tagNames.empty())
+	{
+		start = benchClock::now();
+		for(int n = 0; n < nLookups; n++)
+			nSum += scanTag(fromXML.pRoot, tagNames[n % tagNames.size()].c_str());
+		dScanNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/nLookups;
+
+		start = benchClock::now();
+		for(int n = 0; n < nLookups; n++)
+		{
+			int nTag = -1;
+			compiled.findTag(tagNames[n % tagNames.size()].c_str(), nTag);
+			nSum += nTag;
+		}
+		dFindNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count()/nLookups;
+	}
+
+	printf("%s: %u bytes XML, %u bytes binary, %u nodes, %u tags\n", pPath, (UINT)xml.size(), (UINT)bytes.size(), compiled.getNodeCount(), (UINT)tagNames.size());
+	printf("    xml       %8.1f us/open\n", dXMLUs);
+	printf("    compiled  %8.1f us/open  (%.1fx)\n", dCompiledUs, dXMLUs/dCompiledUs);
+	if(!tagNames.empty())
+		printf("    tags      %8.1f ns scan, %6.1f ns findTag (%d)\n", dScanNs, dFindNs, nSum & 1);
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	bool bPass = true;
+	if(argc < 2)
+		bPass = runFile("../resources/RackAFX.uidesc");
+
+	for(int i = 1; i < argc; i++)
+		bPass &= runFile(argv[i]);
+
+	return bPass ? 0 : 1;
+}
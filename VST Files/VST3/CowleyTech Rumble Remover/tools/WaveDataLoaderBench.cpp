@@ -0,0 +1,240 @@
+/*
+	WaveDataLoaderBench.cpp
+
+	Checks CWaveDataLoader's hand over to the audio thread and times it.
+
+	Checks, on 32-bit float mono files each filled with one value:
+		load        progress rises to WAVE_LOAD_PROGRESS_MAX, the wave is READY
+		            and acquire() returns it
+		failed      a missing file is FAILED and the old wave stays published
+		cancel      a cancelled load is IDLE and publishes nothing
+		swaps       an "audio thread" plays whatever is published, block by
+		            block, while the "GUI thread" keeps loading other files and
+		            collecting garbage; every sample of every block must come
+		            from one file (a freed or partial wave would not); build
+		            with -fsanitize=address or thread to catch the rest
+
+	Speed, on the audio thread while the swaps run:
+		acquire()   worst and average; the worst includes the scheduler, so
+		            run it on an idle machine with more cores than threads
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -pthread -I../source WaveDataLoaderBench.cpp \
+			../source/pluginobjects.cpp -o WaveDataLoaderBench
+
+	Usage:
+		WaveDataLoaderBench [-m megabytes per file] [-d temp folder]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pluginconstants.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+static void put32(FILE* pFile, UINT u)
+{
+	unsigned char b[4] = {(unsigned char)u, (unsigned char)(u >> 8), (unsigned char)(u >> 16), (unsigned char)(u >> 24)};
+	fwrite(b, 1, 4, pFile);
+}
+
+static void put16(FILE* pFile, UINT u)
+{
+	unsigned char b[2] = {(unsigned char)u, (unsigned char)(u >> 8)};
+	fwrite(b, 1, 2, pFile);
+}
+
+// --- mono float32, every sample fValue
+static bool writeWave(const std::string& path, float fValue, UINT uFrames)
+{
+	FILE* pFile = fopen(path.c_str(), "wb");
+	if(!pFile)
+		return false;
+
+	fwrite("RIFF", 1, 4, pFile);
+	put32(pFile, 36 + 4*uFrames);
+	fwrite("WAVEfmt ", 1, 8, pFile);
+	put32(pFile, 16);
+	put16(pFile, 3);
+	put16(pFile, 1);
+	put32(pFile, 48000);
+	put32(pFile, 4*48000);
+	put16(pFile, 4);
+	put16(pFile, 32);
+	fwrite("data", 1, 4, pFile);
+	put32(pFile, 4*uFrames);
+
+	std::vector<float> block(65536, fValue);
+	for(UINT n = 0; n < uFrames; n += block.size())
+	{
+		UINT uCount = uFrames - n < block.size() ? uFrames - n : (UINT)block.size();
+		fwrite(&block[0], sizeof(float), uCount, pFile);
+	}
+	return fclose(pFile) == 0;
+}
+
+static bool waitFor(CWaveDataLoader& loader, UINT& uMaxProgress, bool& bMonotonic)
+{
+	UINT uLast = 0;
+	while(loader.getState() == WAVE_LOAD_LOADING)
+	{
+		UINT uProgress = loader.getProgress();
+		bMonotonic &= uProgress >= uLast;
+		uLast = uProgress;
+		std::this_thread::sleep_for(std::chrono::microseconds(200));
+	}
+	uMaxProgress = loader.getProgress();
+	return loader.getState() == WAVE_LOAD_READY;
+}
+
+// --- the audio thread's view of one block; false if the block is not all one file's
+static bool playBlock(CWaveDataLoader& loader, UINT uBlock, UINT& uPosition, float& fValue, bool& bChanged, double& dAcquireNs)
+{
+	benchClock::time_point start = benchClock::now();
+	CWaveData* pWave = loader.acquire();
+	dAcquireNs = std::chrono::duration<double, std::nano>(benchClock::now() - start).count();
+	bool bOK = true;
+	bChanged = false;
+	if(pWave)
+	{
+		if(uPosition >= pWave->m_uSampleCount)
+			uPosition = 0;
+
+		float fFirst = pWave->m_pWaveBuffer[uPosition];
+		bChanged = fFirst != fValue;
+		fValue = fFirst;
+		for(UINT i = 0; i < uBlock && uPosition < pWave->m_uSampleCount; i++)
+			bOK &= pWave->m_pWaveBuffer[uPosition++] == fValue;
+
+		// --- and the far end, which a partial conversion would not have reached
+		bOK &= pWave->m_pWaveBuffer[pWave->m_uSampleCount - 1] == fValue;
+	}
+	loader.release();
+	return bOK;
+}
+
+int main(int argc, char* argv[])
+{
+	UINT uMegabytes = 64;
+	std::string folder = "/tmp";
+	for(int i = 1; i < argc - 1; i++)
+	{
+		if(strcmp(argv[i], "-m") == 0)
+			uMegabytes = (UINT)atoi(argv[i + 1]);
+		else if(strcmp(argv[i], "-d") == 0)
+			folder = argv[i + 1];
+	}
+
+	const UINT uFiles = 4;
+	UINT uFrames = uMegabytes*1024*1024/4;
+	std::vector<std::string> paths;
+	for(UINT i = 0; i < uFiles; i++)
+	{
+		char name[64];
+		sprintf(name, "/WaveDataLoaderBench%u.wav", i);
+		paths.push_back(folder + name);
+		if(!writeWave(paths.back(), (float)(i + 1)/uFiles, uFrames))
+		{
+			printf("cannot write %s\n", paths.back().c_str());
+			return 1;
+		}
+	}
+
+	bool bPass = true;
+	CWaveDataLoader loader;
+
+	// --- load
+	UINT uProgress = 0;
+	bool bMonotonic = true;
+	benchClock::time_point start = benchClock::now();
+	loader.load(paths[0].c_str());
+	double dLoadMs = std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+	bool bReady = waitFor(loader, uProgress, bMonotonic);
+	double dReadyMs = std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+	CWaveData* pFirst = loader.acquire();
+	loader.release();
+	bool bLoad = bReady && bMonotonic && uProgress == WAVE_LOAD_PROGRESS_MAX && pFirst &&
+				 pFirst->m_uSampleCount == uFrames && pFirst->m_pWaveBuffer[uFrames - 1] == 0.25f;
+	printf("load     load() %.3f ms, ready %.1f ms  %s\n", dLoadMs, dReadyMs, bLoad ? "ok" : "FAIL");
+	bPass &= bLoad;
+
+	// --- failed
+	loader.load((folder + "/WaveDataLoaderBenchMissing.wav").c_str());
+	bool bFailed = !waitFor(loader, uProgress, bMonotonic) && loader.getState() == WAVE_LOAD_FAILED && loader.acquire() == pFirst;
+	loader.release();
+	printf("failed   %s\n", bFailed ? "ok" : "FAIL");
+	bPass &= bFailed;
+
+	// --- cancel, straight after starting
+	loader.load(paths[1].c_str());
+	loader.cancel();
+	bool bCancel = loader.getState() == WAVE_LOAD_IDLE && loader.acquire() == pFirst;
+	loader.release();
+	printf("cancel   %s\n", bCancel ? "ok" : "FAIL");
+	bPass &= bCancel;
+
+	// --- swaps under playback
+	std::atomic<bool> bStop(false);
+	std::atomic<UINT> uBadBlocks(0), uBlocks(0), uSwaps(0);
+	double dWorstNs = 0.0, dTotalNs = 0.0;
+	std::thread audio([&]()
+	{
+		UINT uPosition = 0;
+		float fValue = 0.0;
+		while(!bStop.load())
+		{
+			bool bChanged = false;
+			double dNs = 0.0;
+			bool bOK = playBlock(loader, 512, uPosition, fValue, bChanged, dNs);
+
+			dWorstNs = dNs > dWorstNs ? dNs : dWorstNs;
+			dTotalNs += dNs;
+			uBlocks++;
+			if(!bOK)
+				uBadBlocks++;
+			if(bChanged)
+				uSwaps++;
+		}
+	});
+
+	UINT uLoads = 0;
+	for(UINT n = 0; n < 12; n++)
+	{
+		loader.load(paths[(n + 1) % uFiles].c_str());
+
+		// --- every third one is interrupted by the next
+		if(n % 3 != 2)
+			bPass &= waitFor(loader, uProgress, bMonotonic);
+		else
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		for(UINT i = 0; i < 5; i++)
+		{
+			loader.collectGarbage();
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+		}
+		uLoads++;
+	}
+	waitFor(loader, uProgress, bMonotonic);
+
+	bStop.store(true);
+	audio.join();
+	loader.collectGarbage();
+
+	bool bSwaps = uBadBlocks.load() == 0 && uSwaps.load() > 0 && bMonotonic;
+	printf("swaps    %u loads, %u swaps heard, %u blocks, %u bad  %s\n",
+		uLoads, uSwaps.load(), uBlocks.load(), uBadBlocks.load(), bSwaps ? "ok" : "FAIL");
+	bPass &= bSwaps;
+
+	printf("\nacquire  worst %.0f ns, average %.1f ns\n", dWorstNs, dTotalNs/uBlocks.load());
+
+	for(UINT i = 0; i < uFiles; i++)
+		remove(paths[i].c_str());
+
+	return bPass ? 0 : 1;
+}
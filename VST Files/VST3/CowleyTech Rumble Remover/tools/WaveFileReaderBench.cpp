@@ -0,0 +1,373 @@
+/*
+	WaveFileReaderBench.cpp
+
+	Checks CWaveFileReader and CWaveData against WAV files it writes itself,
+	and times them against reading through a stream.
+
+	Formats, one stereo ramp each, every sample checked after conversion:
+		int16, int24, int24 in 4 bytes, int32, float32, float64
+		extensible    WAVE_FORMAT_EXTENSIBLE around 24-bit PCM
+		smpl          a 'smpl' chunk with one loop and an odd sized chunk
+		              before the data, which must be skipped with its pad byte
+		truncated     a data chunk claiming more than the file holds
+	and getBlock() is zero-copy for float32 and converts the rest.
+
+	Speed, for a large 24-bit stereo file:
+		open      CWaveFileReader::open(), headers only
+		blocks    getBlock() over the whole file, 512 frames at a time
+		load      CWaveData, the whole file into one float buffer
+		stream    ifstream and a sample at a time conversion, as CWaveData
+		          used to load, for comparison
+
+	Build (Linux/macOS, from this folder):
+		g++ -std=c++11 -O2 -D__stdcall= -I../source WaveFileReaderBench.cpp \
+			../source/pluginobjects.cpp -o WaveFileReaderBench
+
+	Usage:
+		WaveFileReaderBench [-m megabytes for the speed file] [-d temp folder]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "pluginconstants.h"
+
+typedef std::chrono::high_resolution_clock benchClock;
+
+static void put16(std::vector<unsigned char>& out, UINT u)
+{
+	out.push_back(u & 0xFF);
+	out.push_back((u >> 8) & 0xFF);
+}
+
+static void put32(std::vector<unsigned char>& out, UINT u)
+{
+	put16(out, u & 0xFFFF);
+	put16(out, u >> 16);
+}
+
+static void putTag(std::vector<unsigned char>& out, const char* pTag)
+{
+	out.insert(out.end(), pTag, pTag + 4);
+}
+
+// --- the test signal: a ramp across the full scale, different per channel
+static double testSample(UINT uFrame, UINT uChannel, UINT uFrames)
+{
+	double dRamp = -1.0 + 2.0*uFrame/uFrames;
+	return uChannel == 0 ? 0.9*dRamp : -0.5*dRamp;
+}
+
+static void putSample(std::vector<unsigned char>& out, UINT uFormat, UINT uBits, double dSample)
+{
+	switch(uFormat)
+	{
+		case WAVE_SAMPLE_INT16: put16(out, (UINT)(int)floor(dSample*32767.0)); break;
+		case WAVE_SAMPLE_INT24:
+		{
+			UINT u = (UINT)(int)floor(dSample*8388607.0);
+			out.push_back(u & 0xFF);
+			out.push_back((u >> 8) & 0xFF);
+			out.push_back((u >> 16) & 0xFF);
+			break;
+		}
+		case WAVE_SAMPLE_INT32:
+		{
+			// --- 24 bits in 4 bytes are left justified
+			if(uBits == 24)
+				put32(out, (UINT)(int)floor(dSample*8388607.0) << 8);
+			else
+				put32(out, (UINT)(int)floor(dSample*2147483647.0));
+			break;
+		}
+		case WAVE_SAMPLE_FLOAT32:
+		{
+			float f = (float)dSample;
+			UINT u;
+			memcpy(&u, &f, 4);
+			put32(out, u);
+			break;
+		}
+		case WAVE_SAMPLE_FLOAT64:
+		{
+			unsigned long long u;
+			memcpy(&u, &dSample, 8);
+			put32(out, (UINT)u);
+			put32(out, (UINT)(u >> 32));
+			break;
+		}
+	}
+}
+
+typedef struct
+{
+	const char* pName;
+	UINT uFormat;		// waveSampleFormat written
+	UINT uBytes;
+	UINT uBits;
+	bool bExtensible;
+	bool bSampler;
+	bool bTruncated;
+} waveCase;
+
+static std::vector<unsigned char> makeWave(const waveCase& test, UINT uFrames)
+{
+	const UINT uChannels = 2;
+	bool bFloat = test.uFormat == WAVE_SAMPLE_FLOAT32 || test.uFormat == WAVE_SAMPLE_FLOAT64;
+	std::vector<unsigned char> out;
+
+	putTag(out, "RIFF");
+	put32(out, 0);
+	putTag(out, "WAVE");
+
+	putTag(out, "fmt ");
+	put32(out, test.bExtensible ? 40 : 16);
+	put16(out, test.bExtensible ? 0xFFFE : (bFloat ? 3 : 1));
+	put16(out, uChannels);
+	put32(out, 44100);
+	put32(out, 44100*uChannels*test.uBytes);
+	put16(out, uChannels*test.uBytes);
+	put16(out, test.uBits);
+	if(test.bExtensible)
+	{
+		put16(out, 22);
+		put16(out, test.uBits);
+		put32(out, 3);
+		// --- KSDATAFORMAT_SUBTYPE_PCM / _IEEE_FLOAT
+		static const unsigned char guid[14] = {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+		put16(out, bFloat ? 3 : 1);
+		out.insert(out.end(), guid, guid + 14);
+	}
+
+	if(test.bSampler)
+	{
+		// --- an odd sized chunk first; its pad byte must be skipped
+		putTag(out, "junk");
+		put32(out, 3);
+		out.push_back('a'); out.push_back('b'); out.push_back('c'); out.push_back(0);
+
+		putTag(out, "smpl");
+		put32(out, 36 + 24);
+		put32(out, 0); put32(out, 0); put32(out, 22676);
+		put32(out, 60);			// unity note
+		put32(out, 0x80000000);	// pitch fraction
+		put32(out, 25);
+		put32(out, 0x01020304);
+		put32(out, 1);			// loops
+		put32(out, 0);
+		put32(out, 0);			// cue point
+		put32(out, 1);			// type
+		put32(out, 100);		// start
+		put32(out, uFrames - 1);// end
+		put32(out, 0);
+		put32(out, 0);
+	}
+
+	putTag(out, "data");
+	UINT uDataBytes = uFrames*uChannels*test.uBytes;
+	put32(out, test.bTruncated ? uDataBytes + 1000 : uDataBytes);
+	for(UINT n = 0; n < uFrames; n++)
+		for(UINT c = 0; c < uChannels; c++)
+			putSample(out, test.uFormat, test.uBits, testSample(n, c, uFrames));
+
+	UINT uRiff = (UINT)out.size() - 8;
+	memcpy(&out[4], &uRiff, 4);
+	return out;
+}
+
+static bool writeFile(const std::string& path, const std::vector<unsigned char>& data)
+{
+	FILE* pFile = fopen(path.c_str(), "wb");
+	if(!pFile)
+		return false;
+	bool bOK = fwrite(&data[0], 1, data.size(), pFile) == data.size();
+	return fclose(pFile) == 0 && bOK;
+}
+
+static double tolerance(UINT uFormat)
+{
+	switch(uFormat)
+	{
+		case WAVE_SAMPLE_INT16: return 2.0/32768.0;
+		case WAVE_SAMPLE_INT24: return 2.0/8388608.0;
+		default: return 1e-6;
+	}
+}
+
+static bool checkCase(const waveCase& test, const std::string& path)
+{
+	// --- odd, so the SIMD loops all have tails
+	const UINT uFrames = 1001;
+	if(!writeFile(path, makeWave(test, uFrames)))
+	{
+		printf("%-12s cannot write %s\n", test.pName, path.c_str());
+		return false;
+	}
+
+	CWaveFileReader reader;
+	bool bOpen = reader.open(path.c_str());
+	bool bPass = bOpen && reader.getChannelCount() == 2 && reader.getSampleRate() == 44100 &&
+				 reader.getFrameCount() == uFrames && reader.getFormat() == test.uFormat;
+
+	// --- every sample through read() and getBlock(), in uneven blocks
+	double dError = 0.0;
+	bool bZeroCopy = false;
+	std::vector<float> buffer(2*uFrames), scratch(2*77);
+	if(bOpen)
+	{
+		bPass &= reader.read(0, &buffer[0], uFrames + 10) == uFrames;
+		for(UINT n = 0; n < uFrames; n++)
+			for(UINT c = 0; c < 2; c++)
+				dError = fmax(dError, fabs(buffer[2*n + c] - testSample(n, c, uFrames)));
+
+		for(UINT n = 0; n < uFrames;)
+		{
+			UINT uRead = 0;
+			const float* pBlock = reader.getBlock(n, 77, &scratch[0], uRead);
+			bZeroCopy |= pBlock != &scratch[0];
+			if(!pBlock || uRead == 0 || memcmp(pBlock, &buffer[2*n], 2*uRead*sizeof(float)) != 0)
+			{
+				bPass = false;
+				break;
+			}
+			n += uRead;
+		}
+		bPass &= dError <= tolerance(test.uFormat);
+		bPass &= bZeroCopy == (test.uFormat == WAVE_SAMPLE_FLOAT32);
+		bPass &= (reader.getSamplerInfo() != NULL) == test.bSampler;
+	}
+
+	// --- and CWaveData, all at once
+	CWaveData wave((char*)path.c_str());
+	bPass &= wave.m_bWaveLoaded && wave.m_uNumChannels == 2 && wave.m_uSampleRate == 44100 &&
+			 wave.m_uSampleCount == 2*uFrames && bOpen &&
+			 memcmp(wave.m_pWaveBuffer, &buffer[0], 2*uFrames*sizeof(float)) == 0;
+	if(test.bSampler)
+		bPass &= wave.m_uMIDINote == 60 && wave.m_uMIDIPitchFraction == 0x80000000 && wave.m_uSMPTEFormat == 25 &&
+				 wave.m_uSMPTEOffset == 0x01020304 && wave.m_uLoopCount == 1 && wave.m_uLoopType == 1 &&
+				 wave.m_uLoopStartIndex == 200 && wave.m_uLoopEndIndex == 2*(uFrames - 1);
+	else
+		bPass &= wave.m_uLoopCount == 0 && wave.m_uLoopStartIndex == 0 && wave.m_uLoopEndIndex == 0;
+
+	printf("%-12s error %.2e  %s  %s\n", test.pName, dError, bZeroCopy ? "zero-copy" : "converted", bPass ? "ok" : "FAIL");
+	return bPass;
+}
+
+// --- what CWaveData did before: a stream, then one sample at a time
+static float* streamLoad24(const std::string& path, UINT& uSamples)
+{
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+	file.seekg(0, std::ios::end);
+	size_t uSize = (size_t)file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	// --- the speed file is 44 bytes of header, then data
+	const size_t uHeader = 44;
+	uSamples = (UINT)((uSize - uHeader)/3);
+	float* pBuffer = new float[uSamples];
+	file.seekg(uHeader, std::ios::beg);
+	for(UINT i = 0; i < uSamples; i++)
+	{
+		unsigned char b[3];
+		file.read((char*)b, 3);
+		int n = (int)(((UINT)b[0] << 8) | ((UINT)b[1] << 16) | ((UINT)b[2] << 24));
+		pBuffer[i] = (float)(n >> 8)/8388608.0;
+	}
+	return pBuffer;
+}
+
+static double elapsedMs(benchClock::time_point start)
+{
+	return std::chrono::duration<double, std::milli>(benchClock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+	UINT uMegabytes = 256;
+	std::string folder = "/tmp";
+	for(int i = 1; i < argc - 1; i++)
+	{
+		if(strcmp(argv[i], "-m") == 0)
+			uMegabytes = (UINT)atoi(argv[i + 1]);
+		else if(strcmp(argv[i], "-d") == 0)
+			folder = argv[i + 1];
+	}
+	std::string path = folder + "/WaveFileReaderBench.wav";
+
+	static const waveCase cases[] =
+	{
+		{"int16", WAVE_SAMPLE_INT16, 2, 16, false, false, false},
+		{"int24", WAVE_SAMPLE_INT24, 3, 24, false, false, false},
+		{"int24 in 32", WAVE_SAMPLE_INT32, 4, 24, false, false, false},
+		{"int32", WAVE_SAMPLE_INT32, 4, 32, false, false, false},
+		{"float32", WAVE_SAMPLE_FLOAT32, 4, 32, false, false, false},
+		{"float64", WAVE_SAMPLE_FLOAT64, 8, 64, false, false, false},
+		{"extensible", WAVE_SAMPLE_INT24, 3, 24, true, false, false},
+		{"ext float", WAVE_SAMPLE_FLOAT32, 4, 32, true, false, false},
+		{"smpl", WAVE_SAMPLE_INT16, 2, 16, false, true, false},
+		{"truncated", WAVE_SAMPLE_INT24, 3, 24, false, false, true},
+	};
+
+	bool bPass = true;
+	for(UINT i = 0; i < sizeof(cases)/sizeof(cases[0]); i++)
+		bPass &= checkCase(cases[i], path);
+
+	// --- not a WAV file
+	std::vector<unsigned char> junk(100, 'x');
+	writeFile(path, junk);
+	CWaveFileReader reader;
+	bool bRejected = !reader.open(path.c_str()) && !CWaveData((char*)path.c_str()).m_bWaveLoaded;
+	printf("%-12s %s\n", "not a wave", bRejected ? "ok" : "FAIL");
+	bPass &= bRejected;
+
+	// --- speed: a large 24-bit stereo file
+	waveCase big = {"big", WAVE_SAMPLE_INT24, 3, 24, false, false, false};
+	UINT uFrames = uMegabytes*1024*1024/6;
+	if(!writeFile(path, makeWave(big, uFrames)))
+		return 1;
+
+	benchClock::time_point start = benchClock::now();
+	bool bOpen = reader.open(path.c_str());
+	double dOpen = elapsedMs(start);
+
+	std::vector<float> scratch(2*512);
+	double dSum = 0.0;
+	start = benchClock::now();
+	for(unsigned long long n = 0; bOpen && n < reader.getFrameCount();)
+	{
+		UINT uRead = 0;
+		const float* pBlock = reader.getBlock(n, 512, &scratch[0], uRead);
+		dSum += pBlock[0];
+		n += uRead;
+	}
+	double dBlocks = elapsedMs(start);
+	reader.close();
+
+	start = benchClock::now();
+	CWaveData* pWave = new CWaveData((char*)path.c_str());
+	double dLoad = elapsedMs(start);
+
+	UINT uSamples = 0;
+	start = benchClock::now();
+	float* pStream = streamLoad24(path, uSamples);
+	double dStream = elapsedMs(start);
+
+	bool bSame = pWave->m_bWaveLoaded && uSamples == pWave->m_uSampleCount &&
+				 memcmp(pStream, pWave->m_pWaveBuffer, uSamples*sizeof(float)) == 0;
+	delete pWave;
+	delete [] pStream;
+	remove(path.c_str());
+
+	printf("\n%u MB, 24-bit stereo%s\n", uMegabytes, bSame ? "" : " (load and stream differ)");
+	printf("open    %9.3f ms\n", dOpen);
+	printf("blocks  %9.3f ms (%d)\n", dBlocks, (int)dSum & 1);
+	printf("load    %9.3f ms\n", dLoad);
+	printf("stream  %9.3f ms\n", dStream);
+
+	return bPass && bOpen && bSame ? 0 : 1;
+}